@@ -0,0 +1,223 @@
+/*
+ * arena.c
+ * A bump allocator for scratch buffers. Chunks form a singly linked list;
+ * allocation bumps an offset in the current chunk and moves on to the next
+ * one (allocating it if needed) when the current chunk is full. Resetting to
+ * a mark makes the marked chunk current again, and later chunks are reused
+ * from the start as allocation reaches them.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "arena.h"
+
+#define THREAD_CHUNK_SIZE (64 * 1024)
+
+// Chunk header; the chunk's memory follows it, ARENA_ALIGN bytes in
+struct arena_chunk {
+    struct arena_chunk *next;
+    size_t size;
+    size_t used;
+};
+
+struct arena {
+    struct arena_chunk *head;
+    struct arena_chunk *current;
+    uint64_t chunk_allocs;
+};
+
+static pthread_once_t thread_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_key;
+static __thread struct arena *thread_arena;
+
+// Private functions
+static struct arena_chunk *new_chunk(struct arena *arena, size_t size);
+static uint8_t *chunk_data(struct arena_chunk *chunk);
+static void free_thread_arena(void *arena);
+static void init_thread_key(void);
+
+/*
+ * Create an arena
+ * @param chunk_size size of the first chunk; later ones double in size, or
+ *        are as large as a single allocation needs
+ * @return pointer to the new arena, or NULL if it could not be allocated
+ */
+struct arena *arena_create(size_t chunk_size)
+{
+    struct arena *arena = calloc(1, sizeof *arena);
+    if (!arena)
+        return NULL;
+    if (chunk_size < ARENA_ALIGN)
+        chunk_size = ARENA_ALIGN;
+    arena->head = new_chunk(arena, chunk_size);
+    if (!arena->head) {
+        free(arena);
+        return NULL;
+    }
+    arena->current = arena->head;
+    return arena;
+}
+
+/*
+ * Free an arena and every chunk it holds
+ */
+void arena_destroy(struct arena *arena)
+{
+    if (!arena)
+        return;
+    struct arena_chunk *chunk = arena->head;
+    while (chunk) {
+        struct arena_chunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+/*
+ * Allocate from an arena
+ * @param arena arena to allocate from
+ * @param size number of bytes
+ * @return pointer aligned to ARENA_ALIGN, valid until the arena is reset to
+ *         a mark taken before this call, or NULL on allocation failure
+ */
+void *arena_alloc(struct arena *arena, size_t size)
+{
+    if (!arena || size > SIZE_MAX / 2)
+        return NULL;
+    size = (size + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+    struct arena_chunk *chunk = arena->current;
+    if (chunk->size - chunk->used < size) {
+        // chunks past the current one are free; drop any too small to use
+        while (chunk->next && chunk->next->size < size) {
+            struct arena_chunk *small = chunk->next;
+            chunk->next = small->next;
+            free(small);
+        }
+        if (!chunk->next) {
+            size_t next_size = chunk->size * 2;
+            if (next_size < size)
+                next_size = size;
+            struct arena_chunk *next = new_chunk(arena, next_size);
+            if (!next)
+                return NULL;
+            chunk->next = next;
+        }
+        chunk = chunk->next;
+        chunk->used = 0;
+        arena->current = chunk;
+    }
+    void *p = chunk_data(chunk) + chunk->used;
+    chunk->used += size;
+    return p;
+}
+
+/*
+ * Get the current position of an arena
+ */
+struct arena_mark arena_get_mark(const struct arena *arena)
+{
+    struct arena_mark mark = { NULL, 0 };
+    if (arena) {
+        mark.chunk = arena->current;
+        mark.used = arena->current->used;
+    }
+    return mark;
+}
+
+/*
+ * Free everything allocated since a mark was taken, keeping the chunks
+ * @param arena arena to reset
+ * @param mark position from arena_get_mark on the same arena
+ */
+void arena_reset(struct arena *arena, struct arena_mark mark)
+{
+    if (!arena || !mark.chunk)
+        return;
+    arena->current = mark.chunk;
+    arena->current->used = mark.used;
+}
+
+/*
+ * Read the size counters of an arena
+ * @param arena arena to read
+ * @param out pointer to stats struct to fill in
+ */
+void arena_get_stats(const struct arena *arena, struct arena_stats *out)
+{
+    if (!out)
+        return;
+    memset(out, 0, sizeof *out);
+    if (!arena)
+        return;
+    int past_current = 0;
+    for (struct arena_chunk *c = arena->head; c; c = c->next) {
+        out->capacity += c->size;
+        if (!past_current)
+            out->used += c->used;
+        past_current |= c == arena->current;
+    }
+    out->chunk_allocs = arena->chunk_allocs;
+}
+
+/*
+ * Get the calling thread's arena, creating it on first use
+ * @return pointer to the arena, or NULL if it could not be allocated
+ */
+struct arena *arena_thread(void)
+{
+    if (thread_arena)
+        return thread_arena;
+    pthread_once(&thread_once, init_thread_key);
+    thread_arena = arena_create(THREAD_CHUNK_SIZE);
+    if (thread_arena)
+        pthread_setspecific(thread_key, thread_arena);
+    return thread_arena;
+}
+
+/*
+ * Allocate a chunk with room for size bytes after its header
+ * @return pointer to the chunk, or NULL on allocation failure
+ */
+static struct arena_chunk *new_chunk(struct arena *arena, size_t size)
+{
+    void *p;
+    if (size > SIZE_MAX - ARENA_ALIGN ||
+            posix_memalign(&p, ARENA_ALIGN, ARENA_ALIGN + size) != 0)
+        return NULL;
+    struct arena_chunk *chunk = p;
+    chunk->next = NULL;
+    chunk->size = size;
+    chunk->used = 0;
+    ++arena->chunk_allocs;
+    return chunk;
+}
+
+/*
+ * Start of a chunk's memory
+ */
+static uint8_t *chunk_data(struct arena_chunk *chunk)
+{
+    return (uint8_t *) chunk + ARENA_ALIGN;
+}
+
+/*
+ * Thread exit destructor for arena_thread
+ */
+static void free_thread_arena(void *arena)
+{
+    arena_destroy(arena);
+    thread_arena = NULL;
+}
+
+/*
+ * Create the key whose destructor frees each thread's arena
+ */
+static void init_thread_key(void)
+{
+    pthread_key_create(&thread_key, free_thread_arena);
+}
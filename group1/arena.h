@@ -0,0 +1,83 @@
+/*
+ * arena.h
+ * A bump allocator for scratch buffers. Allocations are carved out of large
+ * chunks and are never freed individually; instead, take a mark before a
+ * piece of work and reset to it afterwards. Chunks are kept across resets, so
+ * once an arena has grown to fit a workload it stops allocating from the
+ * heap altogether.
+ *
+ * An arena must only be used by one thread at a time. arena_thread() gives
+ * each thread its own, freed when the thread exits.
+ */
+
+#ifndef ___arena_h___
+#define ___arena_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ARENA_ALIGN 64      // alignment of every allocation, a cache line
+
+struct arena;
+struct arena_chunk;
+
+// A position in an arena to reset back to
+struct arena_mark {
+    struct arena_chunk *chunk;
+    size_t used;
+};
+
+struct arena_stats {
+    size_t capacity;        // bytes held in chunks
+    size_t used;            // bytes allocated since the last full reset
+    uint64_t chunk_allocs;  // chunks taken from the heap over the lifetime
+};
+
+/*
+ * Create an arena
+ * @param chunk_size size of the first chunk; later ones double in size, or
+ *        are as large as a single allocation needs
+ * @return pointer to the new arena, or NULL if it could not be allocated
+ */
+struct arena *arena_create(size_t chunk_size);
+
+/*
+ * Free an arena and every chunk it holds
+ */
+void arena_destroy(struct arena *arena);
+
+/*
+ * Allocate from an arena
+ * @param arena arena to allocate from
+ * @param size number of bytes
+ * @return pointer aligned to ARENA_ALIGN, valid until the arena is reset to
+ *         a mark taken before this call, or NULL on allocation failure
+ */
+void *arena_alloc(struct arena *arena, size_t size);
+
+/*
+ * Get the current position of an arena
+ */
+struct arena_mark arena_get_mark(const struct arena *arena);
+
+/*
+ * Free everything allocated since a mark was taken, keeping the chunks
+ * @param arena arena to reset
+ * @param mark position from arena_get_mark on the same arena
+ */
+void arena_reset(struct arena *arena, struct arena_mark mark);
+
+/*
+ * Read the size counters of an arena
+ * @param arena arena to read
+ * @param out pointer to stats struct to fill in
+ */
+void arena_get_stats(const struct arena *arena, struct arena_stats *out);
+
+/*
+ * Get the calling thread's arena, creating it on first use
+ * @return pointer to the arena, or NULL if it could not be allocated
+ */
+struct arena *arena_thread(void);
+
+#endif  // ___arena_h___
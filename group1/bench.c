@@ -0,0 +1,614 @@
+/*
+ * bench.c
+ * Microbenchmarks for the library's public kernels. Each kernel is run over
+ * input sizes from 16 bytes up to 1 GiB (growing by 4x), after a warmup, on a
+ * single pinned core. For each size, the median and 99th percentile time per
+ * call, the throughput and the cycles per byte are reported, both as a table
+ * and as JSON for comparison against a stored baseline (see bench_compare.py).
+ *
+ * usage: bench [--min-size N] [--max-size N] [--kernel NAME] [--json FILE]
+ *              [--cpu N] [--budget-ms N] [--corpus DIR]
+ * Sizes take an optional K, M or G suffix. The kernel level in use (see
+ * cpu_dispatch.h, and MATASANO_CPU_LEVEL to force one) is recorded with the
+ * results.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <dirent.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#include "cpu_dispatch.h"
+#include "convert.h"
+#include "xor.h"
+#include "text_score.h"
+#include "cipher.h"
+#include "hamming_matrix.h"
+
+#define MIN_SAMPLES 5
+#define MAX_SAMPLES 1000
+#define MIN_SAMPLE_NS 2000.0    // batch calls until a sample takes this long
+#define WARMUP_NS 20e6
+#define CORPUS_MAX (1u << 20)
+#define BREAK_KEY_MAX 40
+
+enum input_kind { INPUT_RANDOM, INPUT_TEXT, INPUT_XOR_TEXT, INPUT_HEX,
+    INPUT_BASE64 };
+
+// Buffers for one run of a kernel at one size
+struct bench_case {
+    uint8_t *in;
+    uint8_t *out;
+    size_t size;
+};
+
+struct kernel {
+    const char *name;
+    enum input_kind input;
+    size_t out_factor;      // output buffer bytes per input byte
+    size_t min_size;
+    size_t max_size;        // keeps super-linear kernels to sane sizes
+    void (*run)(struct bench_case *c);
+};
+
+struct result {
+    size_t samples;
+    double median_ns;
+    double p99_ns;
+    double bytes_per_sec;
+    double cycles_per_byte;
+};
+
+// Results of kernels returning a value are summed here so they can't be
+// optimized away
+static volatile size_t sink;
+static const uint8_t bench_key[] = "YELLOW SUBMARINE";
+static uint8_t bench_long_key[300];
+static const struct aes128_schedule *bench_schedule;
+static uint8_t *corpus;
+static size_t corpus_len;
+
+// Private functions
+static void run_read_base16(struct bench_case *c);
+static void run_read_base64(struct bench_case *c);
+static void run_sprint_base16(struct bench_case *c);
+static void run_sprint_base64(struct bench_case *c);
+static void run_fixed_xor(struct bench_case *c);
+static void run_repeated_byte_xor(struct bench_case *c);
+static void run_repeated_key_xor(struct bench_case *c);
+static void run_repeated_key_xor_1(struct bench_case *c);
+static void run_repeated_key_xor_3(struct bench_case *c);
+static void run_repeated_key_xor_29(struct bench_case *c);
+static void run_repeated_key_xor_64(struct bench_case *c);
+static void run_repeated_key_xor_256(struct bench_case *c);
+static void run_repeated_key_xor_300(struct bench_case *c);
+static void run_detect_repeated_byte_xor(struct bench_case *c);
+static void run_detect_repeated_byte_xor_sampled(struct bench_case *c);
+static void run_break_repeated_key_xor(struct bench_case *c);
+static void run_hamming_distance(struct bench_case *c);
+static void run_hamming_matrix(struct bench_case *c);
+static void sum_first_distance(void *arg, size_t row, size_t col,
+        size_t rows, size_t cols, const uint32_t *dist, size_t stride);
+static void run_transpose(struct bench_case *c);
+static void run_letter_frequencies(struct bench_case *c);
+static void run_is_ecb_encrypted(struct bench_case *c);
+static void run_find_ecb_alignment(struct bench_case *c);
+static void run_aes128_ecb_encrypt(struct bench_case *c);
+static void run_aes128_cbc_decrypt(struct bench_case *c);
+static int measure(const struct kernel *k, struct bench_case *c,
+        double budget_ns, struct result *out);
+static void fill_input(enum input_kind kind, uint8_t *buf, size_t size);
+static void load_corpus(const char *dir);
+static size_t parse_size(const char *s);
+static double now_ns(void);
+static uint64_t read_tsc(void);
+static int compare_doubles(const void *a, const void *b);
+
+static const struct kernel kernels[] = {
+    { "read_base16", INPUT_HEX, 1, 16, SIZE_MAX, run_read_base16 },
+    { "read_base64", INPUT_BASE64, 1, 16, SIZE_MAX, run_read_base64 },
+    { "sprint_base16", INPUT_RANDOM, 3, 16, SIZE_MAX, run_sprint_base16 },
+    { "sprint_base64", INPUT_RANDOM, 2, 16, SIZE_MAX, run_sprint_base64 },
+    { "fixed_xor", INPUT_RANDOM, 1, 16, SIZE_MAX, run_fixed_xor },
+    { "repeated_byte_xor", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_byte_xor },
+    { "repeated_key_xor", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor },
+    // key sizes with kernels of their own, and one without
+    { "repeated_key_xor/1", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_1 },
+    { "repeated_key_xor/3", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_3 },
+    { "repeated_key_xor/29", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_29 },
+    { "repeated_key_xor/64", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_64 },
+    { "repeated_key_xor/256", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_256 },
+    { "repeated_key_xor/300", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_repeated_key_xor_300 },
+    { "detect_repeated_byte_xor", INPUT_XOR_TEXT, 0, 16, 4u << 20,
+        run_detect_repeated_byte_xor },
+    { "detect_repeated_byte_xor_sampled", INPUT_XOR_TEXT, 0, 16, SIZE_MAX,
+        run_detect_repeated_byte_xor_sampled },
+    { "break_repeated_key_xor", INPUT_XOR_TEXT, 0, 12 * BREAK_KEY_MAX,
+        1u << 20, run_break_repeated_key_xor },
+    { "hamming_distance", INPUT_RANDOM, 0, 16, SIZE_MAX,
+        run_hamming_distance },
+    { "hamming_matrix", INPUT_RANDOM, 0, 16, 256u << 10,
+        run_hamming_matrix },
+    { "transpose", INPUT_RANDOM, 1, 16, SIZE_MAX, run_transpose },
+    { "calculate_letter_frequencies", INPUT_TEXT, 0, 16, SIZE_MAX,
+        run_letter_frequencies },
+    { "is_ecb_encrypted", INPUT_RANDOM, 0, 16, 64u << 10,
+        run_is_ecb_encrypted },
+    { "find_ecb_alignment", INPUT_RANDOM, 0, 32, 16u << 20,
+        run_find_ecb_alignment },
+    { "aes128_ecb_encrypt", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_aes128_ecb_encrypt },
+    { "aes128_cbc_decrypt", INPUT_RANDOM, 1, 16, SIZE_MAX,
+        run_aes128_cbc_decrypt },
+};
+
+int main(int argc, char **argv)
+{
+    size_t min_size = 16;
+    size_t max_size = (size_t) 1 << 30;
+    const char *only = NULL;
+    const char *json_path = NULL;
+    const char *corpus_dir = "SampleText";
+    double budget_ns = 200e6;
+    int cpu = sched_getcpu();
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *val = i + 1 < argc ? argv[i + 1] : NULL;
+        if (!val) {
+            fprintf(stderr, "%s: missing value for %s\n", argv[0], arg);
+            return 2;
+        }
+        ++i;
+        if (strcmp(arg, "--min-size") == 0)
+            min_size = parse_size(val);
+        else if (strcmp(arg, "--max-size") == 0)
+            max_size = parse_size(val);
+        else if (strcmp(arg, "--kernel") == 0)
+            only = val;
+        else if (strcmp(arg, "--json") == 0)
+            json_path = val;
+        else if (strcmp(arg, "--cpu") == 0)
+            cpu = atoi(val);
+        else if (strcmp(arg, "--budget-ms") == 0)
+            budget_ns = atof(val) * 1e6;
+        else if (strcmp(arg, "--corpus") == 0)
+            corpus_dir = val;
+        else {
+            fprintf(stderr, "%s: unknown option %s\n", argv[0], arg);
+            return 2;
+        }
+    }
+
+    // keep the scheduler from moving us between cores mid-measurement
+    int pinned = 0;
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pinned = sched_setaffinity(0, sizeof set, &set) == 0;
+    }
+    if (!pinned)
+        fprintf(stderr, "warning: not pinned to a cpu\n");
+    struct aes128_schedule ks;
+    aes128_expand_key(&ks, bench_key);
+    bench_schedule = &ks;
+    for (size_t i = 0; i < sizeof bench_long_key; ++i)
+        bench_long_key[i] = (uint8_t) (i * 151 + 7);
+    load_corpus(corpus_dir);
+
+    struct cpu_dispatch_info info;
+    cpu_dispatch_get_info(&info);
+    printf("cpu level %s (detected %s): xor %s, popcount %s, hex %s, aes %s, "
+            "key xor %s, hamming %s\n", cpu_level_name(info.active),
+            cpu_level_name(info.detected), info.xor_kernel,
+            info.popcount_kernel, info.hex_kernel, info.aes_kernel,
+            info.key_xor_kernel, info.hamming_kernel);
+
+    FILE *json = NULL;
+    if (json_path) {
+        json = fopen(json_path, "w");
+        if (!json) {
+            perror(json_path);
+            return 1;
+        }
+        fprintf(json, "{\n  \"cpu\": %d,\n  \"pinned\": %s,\n"
+                "  \"tsc\": %s,\n  \"cpu_level\": \"%s\",\n"
+                "  \"results\": [", pinned ? cpu : -1,
+                pinned ? "true" : "false", HAVE_TSC ? "true" : "false",
+                cpu_level_name(info.active));
+    }
+    printf("%-30s %10s %7s %14s %14s %12s %10s\n", "kernel", "bytes",
+            "samples", "median ns/op", "p99 ns/op", "MB/s", "cycles/B");
+    int first = 1;
+    for (size_t i = 0; i < sizeof kernels / sizeof kernels[0]; ++i) {
+        const struct kernel *k = &kernels[i];
+        if (only && strcmp(only, k->name) != 0)
+            continue;
+        for (size_t size = 16; size <= max_size && size <= k->max_size;
+                size *= 4) {
+            if (size < min_size || size < k->min_size)
+                continue;
+            struct bench_case c = { NULL, NULL, size };
+            // +1 for the terminator some encoders write
+            c.in = malloc(size + 1);
+            c.out = malloc(k->out_factor * size + 4);
+            if (!c.in || !c.out) {
+                fprintf(stderr, "%s: skipping %zu bytes, out of memory\n",
+                        k->name, size);
+                free(c.in);
+                free(c.out);
+                break;
+            }
+            fill_input(k->input, c.in, size);
+            struct result r;
+            if (measure(k, &c, budget_ns, &r) == 0) {
+                printf("%-30s %10zu %7zu %14.1f %14.1f %12.1f %10.2f\n",
+                        k->name, size, r.samples, r.median_ns, r.p99_ns,
+                        r.bytes_per_sec / 1e6, r.cycles_per_byte);
+                fflush(stdout);
+                if (json)
+                    fprintf(json, "%s\n    {\"kernel\": \"%s\", "
+                            "\"size\": %zu, \"samples\": %zu, "
+                            "\"median_ns\": %.3f, \"p99_ns\": %.3f, "
+                            "\"bytes_per_sec\": %.1f, "
+                            "\"cycles_per_byte\": %.4f}", first ? "" : ",",
+                            k->name, size, r.samples, r.median_ns, r.p99_ns,
+                            r.bytes_per_sec, r.cycles_per_byte);
+                first = 0;
+            }
+            free(c.in);
+            free(c.out);
+        }
+    }
+    if (json) {
+        fprintf(json, "\n  ]\n}\n");
+        fclose(json);
+    }
+    free(corpus);
+    return 0;
+}
+
+static void run_read_base16(struct bench_case *c)
+{
+    read_base16(c->out, (const char *) c->in, c->size);
+}
+
+static void run_read_base64(struct bench_case *c)
+{
+    sink += read_base64(c->out, (const char *) c->in, c->size);
+}
+
+static void run_sprint_base16(struct bench_case *c)
+{
+    sprint_base16((char *) c->out, c->in, c->size);
+}
+
+static void run_sprint_base64(struct bench_case *c)
+{
+    sprint_base64((char *) c->out, c->in, c->size);
+}
+
+static void run_fixed_xor(struct bench_case *c)
+{
+    fixed_xor(c->out, c->in, c->in, c->size);
+}
+
+static void run_repeated_byte_xor(struct bench_case *c)
+{
+    repeated_byte_xor(0x5a, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor(struct bench_case *c)
+{
+    repeated_key_xor(bench_key, sizeof bench_key - 1, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_1(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 1, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_3(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 3, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_29(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 29, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_64(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 64, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_256(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 256, c->in, c->out, c->size);
+}
+
+static void run_repeated_key_xor_300(struct bench_case *c)
+{
+    repeated_key_xor(bench_long_key, 300, c->in, c->out, c->size);
+}
+
+static void run_detect_repeated_byte_xor(struct bench_case *c)
+{
+    sink += detect_repeated_byte_xor(c->in, c->size);
+}
+
+static void run_detect_repeated_byte_xor_sampled(struct bench_case *c)
+{
+    sink += detect_repeated_byte_xor_sampled(c->in, c->size,
+            XOR_SAMPLE_CONFIDENCE, NULL);
+}
+
+static void run_break_repeated_key_xor(struct bench_case *c)
+{
+    uint8_t key[BREAK_KEY_MAX];
+    sink += break_repeated_key_xor(c->in, c->size, key, BREAK_KEY_MAX);
+}
+
+static void run_hamming_distance(struct bench_case *c)
+{
+    sink += hamming_distance(c->in, c->in + c->size / 2, c->size / 2);
+}
+
+// Every pair of the input's 16 byte blocks
+static void run_hamming_matrix(struct bench_case *c)
+{
+    hamming_matrix_tiles(c->in, c->size / 16, NULL, 0, 16,
+            sum_first_distance, NULL);
+}
+
+static void sum_first_distance(void *arg, size_t row, size_t col,
+        size_t rows, size_t cols, const uint32_t *dist, size_t stride)
+{
+    (void) arg;
+    (void) row;
+    (void) col;
+    (void) rows;
+    (void) cols;
+    (void) stride;
+    __atomic_add_fetch(&sink, dist[0], __ATOMIC_RELAXED);
+}
+
+static void run_transpose(struct bench_case *c)
+{
+    transpose(c->out, c->in, c->size, 16);
+}
+
+static void run_letter_frequencies(struct bench_case *c)
+{
+    struct letter_frequencies lf;
+    calculate_letter_frequencies((const char *) c->in, c->size, &lf);
+    sink += (size_t) lf.freqs[LF_SPACE_INDEX];
+}
+
+static void run_is_ecb_encrypted(struct bench_case *c)
+{
+    sink += is_ecb_encrypted(c->in, c->size);
+}
+
+static void run_find_ecb_alignment(struct bench_case *c)
+{
+    sink += find_ecb_alignment(c->in, c->size, AES_BLOCK_SIZE, NULL);
+}
+
+static void run_aes128_ecb_encrypt(struct bench_case *c)
+{
+    aes128_ecb_encrypt(bench_schedule, c->in, c->out, c->size);
+}
+
+static void run_aes128_cbc_decrypt(struct bench_case *c)
+{
+    aes128_cbc_decrypt(bench_schedule, bench_key, c->in, c->out, c->size);
+}
+
+/*
+ * Time a kernel at one size. Calls are batched so that each sample lasts at
+ * least MIN_SAMPLE_NS, and samples are taken until the time budget is spent
+ * (but at least MIN_SAMPLES and at most MAX_SAMPLES of them).
+ * @return 0 on success, -1 on allocation failure
+ */
+static int measure(const struct kernel *k, struct bench_case *c,
+        double budget_ns, struct result *out)
+{
+    // warm up caches, page tables and branch predictors, and estimate the
+    // cost of one call
+    size_t calls = 0;
+    double start = now_ns();
+    double elapsed;
+    do {
+        k->run(c);
+        ++calls;
+        elapsed = now_ns() - start;
+    } while (elapsed < WARMUP_NS && calls < 1000000);
+    double per_call = elapsed / calls;
+    size_t batch = per_call >= MIN_SAMPLE_NS ? 1 :
+        (size_t) (MIN_SAMPLE_NS / (per_call > 1 ? per_call : 1)) + 1;
+    size_t samples = (size_t) (budget_ns / (per_call * batch));
+    if (samples < MIN_SAMPLES)
+        samples = MIN_SAMPLES;
+    if (samples > MAX_SAMPLES)
+        samples = MAX_SAMPLES;
+
+    double *ns = malloc(samples * sizeof *ns);
+    double *cycles = malloc(samples * sizeof *cycles);
+    if (!ns || !cycles) {
+        free(ns);
+        free(cycles);
+        return -1;
+    }
+    for (size_t s = 0; s < samples; ++s) {
+        uint64_t tsc = read_tsc();
+        double t = now_ns();
+        for (size_t b = 0; b < batch; ++b)
+            k->run(c);
+        ns[s] = (now_ns() - t) / batch;
+        cycles[s] = (double) (read_tsc() - tsc) / batch;
+    }
+    qsort(ns, samples, sizeof *ns, compare_doubles);
+    qsort(cycles, samples, sizeof *cycles, compare_doubles);
+    out->samples = samples;
+    out->median_ns = ns[samples / 2];
+    out->p99_ns = ns[(samples * 99) / 100 < samples ?
+        (samples * 99) / 100 : samples - 1];
+    out->bytes_per_sec = c->size / (out->median_ns * 1e-9);
+    out->cycles_per_byte = cycles[samples / 2] / c->size;
+    free(ns);
+    free(cycles);
+    return 0;
+}
+
+/*
+ * Fill an input buffer of the given kind. Random bytes come from a fixed
+ * seed so runs are comparable.
+ */
+static void fill_input(enum input_kind kind, uint8_t *buf, size_t size)
+{
+    uint64_t x = 0x9e3779b97f4a7c15ull;
+    switch (kind) {
+    case INPUT_RANDOM:
+        for (size_t i = 0; i < size; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            buf[i] = (uint8_t) x;
+        }
+        break;
+    case INPUT_TEXT:
+    case INPUT_XOR_TEXT:
+        for (size_t i = 0; i < size; i += corpus_len)
+            memcpy(buf + i, corpus,
+                    size - i < corpus_len ? size - i : corpus_len);
+        if (kind == INPUT_XOR_TEXT)
+            repeated_key_xor(bench_key, 5, buf, buf, size);
+        break;
+    case INPUT_HEX: {
+        const char digits[] = "0123456789abcdef";
+        for (size_t i = 0; i < size; ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+            buf[i] = (uint8_t) digits[x & 15];
+        }
+        break;
+    }
+    case INPUT_BASE64: {
+        // encode random bytes in place, from the back so nothing is
+        // overwritten before it is read
+        size_t raw = size / 4 * 3;
+        fill_input(INPUT_RANDOM, buf + size - raw, raw);
+        for (size_t g = 0; g < size / 4; ++g) {
+            uint8_t group[3];
+            memcpy(group, buf + size - raw + 3 * g, 3);
+            char text[5];
+            sprint_base64(text, group, 3);
+            memcpy(buf + 4 * g, text, 4);
+        }
+        break;
+    }
+    }
+}
+
+/*
+ * Load up to CORPUS_MAX bytes of english text from the files in a directory,
+ * falling back to a built-in sentence
+ */
+static void load_corpus(const char *dir)
+{
+    static const char fallback[] = "Now that the party is jumping with the "
+        "bass kicked in and the Vega's are pumpin', quick to the point, to "
+        "the point, no faking.\n";
+    corpus = malloc(CORPUS_MAX);
+    corpus_len = 0;
+    DIR *d = corpus ? opendir(dir) : NULL;
+    struct dirent *entry;
+    while (d && corpus_len < CORPUS_MAX && (entry = readdir(d))) {
+        if (entry->d_name[0] == '.')
+            continue;
+        char path[4096];
+        snprintf(path, sizeof path, "%s/%s", dir, entry->d_name);
+        FILE *f = fopen(path, "rb");
+        if (!f)
+            continue;
+        corpus_len += fread(corpus + corpus_len, 1, CORPUS_MAX - corpus_len,
+                f);
+        fclose(f);
+    }
+    if (d)
+        closedir(d);
+    if (corpus && corpus_len == 0) {
+        memcpy(corpus, fallback, sizeof fallback - 1);
+        corpus_len = sizeof fallback - 1;
+    }
+}
+
+/*
+ * Parse a size with an optional K, M or G suffix
+ */
+static size_t parse_size(const char *s)
+{
+    char *end;
+    size_t n = strtoul(s, &end, 10);
+    switch (*end) {
+    case 'K': case 'k': return n << 10;
+    case 'M': case 'm': return n << 20;
+    case 'G': case 'g': return n << 30;
+    default: return n;
+    }
+}
+
+/*
+ * Monotonic time in nanoseconds
+ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/*
+ * Read the timestamp counter, which ticks at a constant reference rate on
+ * current x86 cpus; 0 where there is none
+ */
+static uint64_t read_tsc(void)
+{
+#if HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*
+ * qsort comparator for doubles, ascending
+ */
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+
+"""Compare two JSON result files written by `bench --json` and flag kernels
+whose median time per call got worse by more than a threshold.
+
+usage: bench_compare.py BASELINE CURRENT [--threshold PERCENT]
+
+Exits with status 1 if any kernel/size regressed."""
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+  """Read a bench JSON file into a dictionary of (kernel, size) => result"""
+  with open(path) as f:
+    data = json.load(f)
+  return {(r['kernel'], r['size']): r for r in data['results']}
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+  parser.add_argument('baseline')
+  parser.add_argument('current')
+  parser.add_argument('--threshold', type=float, default=10.0,
+                      help='allowed slowdown in percent (default 10)')
+  args = parser.parse_args()
+
+  baseline = load_results(args.baseline)
+  current = load_results(args.current)
+  regressions = 0
+  print('%-30s %10s %12s %12s %8s %8s' %
+        ('kernel', 'bytes', 'base ns/op', 'new ns/op', 'change', 'speedup'))
+  for key in sorted(set(baseline) & set(current)):
+    old = baseline[key]['median_ns']
+    new = current[key]['median_ns']
+    change = (new - old) / old * 100 if old else 0.0
+    speedup = old / new if new else 0.0
+    flag = ''
+    if change > args.threshold:
+      flag = '  REGRESSION'
+      regressions += 1
+    print('%-30s %10d %12.1f %12.1f %+7.1f%% %7.2fx%s' %
+          (key[0], key[1], old, new, change, speedup, flag))
+  for key in sorted(set(baseline) ^ set(current)):
+    where = 'baseline' if key in baseline else 'current'
+    print('%-30s %10d only in %s' % (key[0], key[1], where))
+  return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
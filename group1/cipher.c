@@ -2,12 +2,102 @@
  * cipher.c
  * Functions related to block ciphers, particularly aes-ecb, for the Matasano
  * crypto challenges.
- *  1) Detect if something has been ecb encrypted
+ *  1) Detect if something has been ecb encrypted, even at an unknown offset
+ *  2) AES-128 key expansion and block encryption/decryption
+ *  3) AES-128 in ecb and cbc modes, one buffer or a batch of messages at a time
+ *  4) PKCS#7 padding
  */
 
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "cipher.h"
+#include "cpu_dispatch.h"
+#include "stats.h"
+#include "probes.h"
+#include "thread_pool.h"
+
+#define WINDOW_HASH_BASE 0x100000001b3ull
+#define EMPTY_SLOT SIZE_MAX
+#define BATCH_PARALLEL_MIN (64 * 1024)  // smaller batches aren't worth a wakeup
+
+enum batch_op {
+    ECB_ENCRYPT,
+    ECB_DECRYPT,
+    CBC_ENCRYPT,
+    CBC_DECRYPT
+};
+
+// Shared state for one batch call run over the thread pool
+struct batch_job {
+    const struct aes128_schedule *ks;
+    const struct cipher_message *msgs;
+    enum batch_op op;
+};
+
+// Private functions
+static size_t window_slot(uint64_t hash, size_t alignment, size_t mask);
+static uint8_t xtime(uint8_t x);
+static void sub_bytes(uint8_t *state, const uint8_t *box);
+static void shift_rows(uint8_t *state);
+static void inv_shift_rows(uint8_t *state);
+static void mix_columns(uint8_t *state);
+static void inv_mix_columns(uint8_t *state);
+static void add_round_key(uint8_t *state, const uint8_t *round_key);
+static void run_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num, enum batch_op op);
+static void batch_range(void *arg, size_t begin, size_t end);
+
+static const uint8_t sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b,
+    0xfe, 0xd7, 0xab, 0x76, 0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0,
+    0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0, 0xb7, 0xfd, 0x93, 0x26,
+    0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2,
+    0xeb, 0x27, 0xb2, 0x75, 0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0,
+    0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84, 0x53, 0xd1, 0x00, 0xed,
+    0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f,
+    0x50, 0x3c, 0x9f, 0xa8, 0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5,
+    0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2, 0xcd, 0x0c, 0x13, 0xec,
+    0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14,
+    0xde, 0x5e, 0x0b, 0xdb, 0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c,
+    0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79, 0xe7, 0xc8, 0x37, 0x6d,
+    0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f,
+    0x4b, 0xbd, 0x8b, 0x8a, 0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e,
+    0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e, 0xe1, 0xf8, 0x98, 0x11,
+    0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f,
+    0xb0, 0x54, 0xbb, 0x16
+};
+
+static const uint8_t inv_sbox[256] = {
+    0x52, 0x09, 0x6a, 0xd5, 0x30, 0x36, 0xa5, 0x38, 0xbf, 0x40, 0xa3, 0x9e,
+    0x81, 0xf3, 0xd7, 0xfb, 0x7c, 0xe3, 0x39, 0x82, 0x9b, 0x2f, 0xff, 0x87,
+    0x34, 0x8e, 0x43, 0x44, 0xc4, 0xde, 0xe9, 0xcb, 0x54, 0x7b, 0x94, 0x32,
+    0xa6, 0xc2, 0x23, 0x3d, 0xee, 0x4c, 0x95, 0x0b, 0x42, 0xfa, 0xc3, 0x4e,
+    0x08, 0x2e, 0xa1, 0x66, 0x28, 0xd9, 0x24, 0xb2, 0x76, 0x5b, 0xa2, 0x49,
+    0x6d, 0x8b, 0xd1, 0x25, 0x72, 0xf8, 0xf6, 0x64, 0x86, 0x68, 0x98, 0x16,
+    0xd4, 0xa4, 0x5c, 0xcc, 0x5d, 0x65, 0xb6, 0x92, 0x6c, 0x70, 0x48, 0x50,
+    0xfd, 0xed, 0xb9, 0xda, 0x5e, 0x15, 0x46, 0x57, 0xa7, 0x8d, 0x9d, 0x84,
+    0x90, 0xd8, 0xab, 0x00, 0x8c, 0xbc, 0xd3, 0x0a, 0xf7, 0xe4, 0x58, 0x05,
+    0xb8, 0xb3, 0x45, 0x06, 0xd0, 0x2c, 0x1e, 0x8f, 0xca, 0x3f, 0x0f, 0x02,
+    0xc1, 0xaf, 0xbd, 0x03, 0x01, 0x13, 0x8a, 0x6b, 0x3a, 0x91, 0x11, 0x41,
+    0x4f, 0x67, 0xdc, 0xea, 0x97, 0xf2, 0xcf, 0xce, 0xf0, 0xb4, 0xe6, 0x73,
+    0x96, 0xac, 0x74, 0x22, 0xe7, 0xad, 0x35, 0x85, 0xe2, 0xf9, 0x37, 0xe8,
+    0x1c, 0x75, 0xdf, 0x6e, 0x47, 0xf1, 0x1a, 0x71, 0x1d, 0x29, 0xc5, 0x89,
+    0x6f, 0xb7, 0x62, 0x0e, 0xaa, 0x18, 0xbe, 0x1b, 0xfc, 0x56, 0x3e, 0x4b,
+    0xc6, 0xd2, 0x79, 0x20, 0x9a, 0xdb, 0xc0, 0xfe, 0x78, 0xcd, 0x5a, 0xf4,
+    0x1f, 0xdd, 0xa8, 0x33, 0x88, 0x07, 0xc7, 0x31, 0xb1, 0x12, 0x10, 0x59,
+    0x27, 0x80, 0xec, 0x5f, 0x60, 0x51, 0x7f, 0xa9, 0x19, 0xb5, 0x4a, 0x0d,
+    0x2d, 0xe5, 0x7a, 0x9f, 0x93, 0xc9, 0x9c, 0xef, 0xa0, 0xe0, 0x3b, 0x4d,
+    0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
+    0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63,
+    0x55, 0x21, 0x0c, 0x7d
+};
 
 /*
  * Guess whether a given cipher text has been encrypted using aes in 128-bit
@@ -20,11 +110,577 @@ uint32_t is_ecb_encrypted(const uint8_t *ciphertext, size_t len)
 {
     if (!ciphertext)
         return 0;
+    PROBE1(is_ecb_encrypted__entry, len);
+    STATS_SCOPE(STATS_IS_ECB_ENCRYPTED, len);
     size_t blocks = len / 16;
-    for (size_t i = 0; i < blocks; ++i)
-        for (size_t j = i + 1; j < blocks; ++j)
-            if (memcmp(ciphertext + 16*i, ciphertext + 16*j, 16) == 0)
-                return 1;
-    return 0;
+    uint32_t found = 0;
+    for (size_t i = 0; i < blocks && !found; ++i)
+        for (size_t j = i + 1; j < blocks && !found; ++j)
+            found = memcmp(ciphertext + 16*i, ciphertext + 16*j, 16) == 0;
+    PROBE2(is_ecb_encrypted__return, len, found);
+    return found;
+}
+
+/*
+ * Look for ecb structure at any alignment, e.g. behind a header of unknown
+ * length. Every block_size-byte window is hashed with a rolling hash, and
+ * windows whose contents match an earlier window a whole number of blocks
+ * back count as repeats for their alignment. Matches are verified byte for
+ * byte, and the scan takes expected linear time.
+ * @param ciphertext buffer to search
+ * @param len length of the buffer
+ *        precondition: length of ciphertext buffer >= len
+ * @param block_size window size
+ * @param out pointer to struct to write the best alignment to; may be NULL
+ * @return number of repeats at the alignment with the most of them (the
+ *         earliest alignment on a tie), 0 if there are none, or SIZE_MAX on
+ *         allocation failure
+ */
+size_t find_ecb_alignment(const uint8_t *ciphertext, size_t len,
+        size_t block_size, struct ecb_alignment *out)
+{
+    if (out)
+        memset(out, 0, sizeof *out);
+    // written so that a huge block_size can't overflow
+    if (!ciphertext || block_size == 0 || block_size > len / 2)
+        return 0;
+    STATS_SCOPE(STATS_FIND_ECB_ALIGNMENT, len);
+    size_t windows = len - block_size + 1;
+    // one slot per distinct (contents, alignment) pair, at most half full
+    size_t num_slots = 1;
+    while (num_slots < 2 * windows)
+        num_slots *= 2;
+    size_t *slots = malloc(num_slots * sizeof *slots);
+    // repeats and first window for each alignment
+    size_t *repeats = calloc(2 * block_size, sizeof *repeats);
+    if (!slots || !repeats) {
+        free(slots);
+        free(repeats);
+        return SIZE_MAX;
+    }
+    size_t *first = repeats + block_size;
+    for (size_t i = 0; i < num_slots; ++i)
+        slots[i] = EMPTY_SLOT;
+
+    // hash = sum of window[k] * base^(block_size - 1 - k), mod 2^64
+    uint64_t top = 1;
+    uint64_t hash = 0;
+    for (size_t k = 0; k < block_size; ++k) {
+        hash = hash * WINDOW_HASH_BASE + ciphertext[k];
+        if (k)
+            top *= WINDOW_HASH_BASE;
+    }
+    for (size_t i = 0; i < windows; ++i) {
+        if (i) {
+            hash -= ciphertext[i - 1] * top;
+            hash = hash * WINDOW_HASH_BASE + ciphertext[i + block_size - 1];
+        }
+        // windows are only compared with earlier windows at the same
+        // alignment, so each slot holds the first window of its kind
+        size_t alignment = i % block_size;
+        size_t slot = window_slot(hash, alignment, num_slots - 1);
+        for (;;) {
+            size_t j = slots[slot];
+            if (j == EMPTY_SLOT) {
+                slots[slot] = i;
+                break;
+            }
+            if (j % block_size == alignment &&
+                    memcmp(ciphertext + j, ciphertext + i, block_size) == 0) {
+                if (repeats[alignment]++ == 0)
+                    first[alignment] = i;
+                break;
+            }
+            slot = (slot + 1) & (num_slots - 1);
+        }
+    }
+    free(slots);
+
+    size_t best = 0;
+    for (size_t a = 1; a < block_size; ++a)
+        if (repeats[a] > repeats[best])
+            best = a;
+    size_t found = repeats[best];
+    if (out && found) {
+        out->offset = best;
+        out->repeats = found;
+        out->first = first[best];
+    }
+    free(repeats);
+    return found;
+}
+
+/*
+ * Find the first pair of identical adjacent blocks in a buffer
+ * @param ciphertext buffer to search
+ * @param len length of the buffer
+ *        precondition: length of ciphertext buffer >= len
+ * @param block_size size of the blocks to compare
+ * @param start index of the first block to consider
+ * @return index of the first block of the pair, or SIZE_MAX if there is none
+ */
+size_t find_adjacent_repeated_blocks(const uint8_t *ciphertext, size_t len,
+        size_t block_size, size_t start)
+{
+    if (!ciphertext || block_size == 0)
+        return SIZE_MAX;
+    size_t blocks = len / block_size;
+    for (size_t i = start; i + 1 < blocks; ++i)
+        if (memcmp(ciphertext + block_size * i,
+                    ciphertext + block_size * (i + 1), block_size) == 0)
+            return i;
+    return SIZE_MAX;
+}
+
+/*
+ * Append PKCS#7 padding to a buffer in place
+ * @param buf buffer holding the data to pad
+ *        precondition: length of buf >= len + block_size - len % block_size
+ * @param len number of data bytes in buf
+ * @param block_size block size to pad to
+ *        precondition: 0 < block_size <= 255
+ * @return length of the padded data
+ */
+size_t pkcs7_pad(uint8_t *buf, size_t len, size_t block_size)
+{
+    if (!buf || block_size == 0 || block_size > UINT8_MAX)
+        return len;
+    size_t padding = block_size - len % block_size;
+    memset(buf + len, (int) padding, padding);
+    return len + padding;
+}
+
+/*
+ * Check and strip PKCS#7 padding
+ * @param buf padded data
+ * @param len length of the padded data
+ *        precondition: length of buf >= len
+ * @param block_size block size the data was padded to
+ * @return length of the data without padding, or SIZE_MAX if the padding is
+ *         not valid
+ */
+size_t pkcs7_unpad(const uint8_t *buf, size_t len, size_t block_size)
+{
+    if (!buf || len == 0 || block_size == 0 || len % block_size != 0)
+        return SIZE_MAX;
+    uint8_t padding = buf[len - 1];
+    if (padding == 0 || padding > block_size)
+        return SIZE_MAX;
+    for (size_t i = len - padding; i < len; ++i)
+        if (buf[i] != padding)
+            return SIZE_MAX;
+    return len - padding;
+}
+
+/*
+ * Expand an AES-128 key into its encryption and decryption round keys
+ * @param out pointer to schedule to write the round keys to
+ * @param key raw key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ */
+void aes128_expand_key(struct aes128_schedule *out, const uint8_t *key)
+{
+    if (!out || !key)
+        return;
+    uint8_t *w = out->enc;
+    memcpy(w, key, AES128_KEY_SIZE);
+    uint8_t rcon = 1;
+    for (size_t i = AES128_KEY_SIZE; i < AES128_SCHEDULE_SIZE; i += 4) {
+        uint8_t temp[4];
+        memcpy(temp, w + i - 4, 4);
+        if (i % AES128_KEY_SIZE == 0) {
+            // RotWord, SubWord and the round constant
+            uint8_t first = temp[0];
+            temp[0] = sbox[temp[1]] ^ rcon;
+            temp[1] = sbox[temp[2]];
+            temp[2] = sbox[temp[3]];
+            temp[3] = sbox[first];
+            rcon = xtime(rcon);
+        }
+        for (size_t j = 0; j < 4; ++j)
+            w[i + j] = w[i + j - AES128_KEY_SIZE] ^ temp[j];
+    }
+    // equivalent inverse cipher: reverse the round keys and run the middle
+    // ones through InvMixColumns
+    for (size_t round = 0; round <= AES128_ROUNDS; ++round) {
+        uint8_t *dk = out->dec + round * AES_BLOCK_SIZE;
+        memcpy(dk, w + (AES128_ROUNDS - round) * AES_BLOCK_SIZE,
+                AES_BLOCK_SIZE);
+        if (round != 0 && round != AES128_ROUNDS)
+            inv_mix_columns(dk);
+    }
 }
 
+/*
+ * Encrypt a single block with AES-128
+ * @param ks expanded key
+ * @param src block to encrypt
+ * @param dest buffer to write the encrypted block to; may be the same as src
+ *        precondition: length of src and dest buffers >= AES_BLOCK_SIZE
+ */
+void aes128_encrypt_block(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest)
+{
+    if (!ks || !src || !dest)
+        return;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->aes128_encrypt_blocks) {
+        k->aes128_encrypt_blocks(ks, src, dest, 1);
+        return;
+    }
+    uint8_t state[AES_BLOCK_SIZE];
+    memcpy(state, src, AES_BLOCK_SIZE);
+    add_round_key(state, ks->enc);
+    for (size_t round = 1; round < AES128_ROUNDS; ++round) {
+        sub_bytes(state, sbox);
+        shift_rows(state);
+        mix_columns(state);
+        add_round_key(state, ks->enc + round * AES_BLOCK_SIZE);
+    }
+    sub_bytes(state, sbox);
+    shift_rows(state);
+    add_round_key(state, ks->enc + AES128_ROUNDS * AES_BLOCK_SIZE);
+    memcpy(dest, state, AES_BLOCK_SIZE);
+}
+
+/*
+ * Decrypt a single block with AES-128
+ * @param ks expanded key
+ * @param src block to decrypt
+ * @param dest buffer to write the decrypted block to; may be the same as src
+ *        precondition: length of src and dest buffers >= AES_BLOCK_SIZE
+ */
+void aes128_decrypt_block(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest)
+{
+    if (!ks || !src || !dest)
+        return;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->aes128_decrypt_blocks) {
+        k->aes128_decrypt_blocks(ks, src, dest, 1);
+        return;
+    }
+    uint8_t state[AES_BLOCK_SIZE];
+    memcpy(state, src, AES_BLOCK_SIZE);
+    add_round_key(state, ks->dec);
+    for (size_t round = 1; round < AES128_ROUNDS; ++round) {
+        sub_bytes(state, inv_sbox);
+        inv_shift_rows(state);
+        inv_mix_columns(state);
+        add_round_key(state, ks->dec + round * AES_BLOCK_SIZE);
+    }
+    sub_bytes(state, inv_sbox);
+    inv_shift_rows(state);
+    add_round_key(state, ks->dec + AES128_ROUNDS * AES_BLOCK_SIZE);
+    memcpy(dest, state, AES_BLOCK_SIZE);
+}
+
+/*
+ * Encrypt a buffer with AES-128 in ecb mode. No padding is applied.
+ * @param ks expanded key
+ * @param src buffer to encrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to encrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_ecb_encrypt(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest, size_t len)
+{
+    if (!ks || !src || !dest)
+        return;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->aes128_encrypt_blocks) {
+        k->aes128_encrypt_blocks(ks, src, dest, len / AES_BLOCK_SIZE);
+        return;
+    }
+    for (size_t i = 0; i + AES_BLOCK_SIZE <= len; i += AES_BLOCK_SIZE)
+        aes128_encrypt_block(ks, src + i, dest + i);
+}
+
+/*
+ * Decrypt a buffer with AES-128 in ecb mode. No padding is removed.
+ * @param ks expanded key
+ * @param src buffer to decrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to decrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_ecb_decrypt(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest, size_t len)
+{
+    if (!ks || !src || !dest)
+        return;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->aes128_decrypt_blocks) {
+        k->aes128_decrypt_blocks(ks, src, dest, len / AES_BLOCK_SIZE);
+        return;
+    }
+    for (size_t i = 0; i + AES_BLOCK_SIZE <= len; i += AES_BLOCK_SIZE)
+        aes128_decrypt_block(ks, src + i, dest + i);
+}
+
+/*
+ * Encrypt a buffer with AES-128 in cbc mode. No padding is applied.
+ * @param ks expanded key
+ * @param iv initialization vector
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src buffer to encrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to encrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_cbc_encrypt(const struct aes128_schedule *ks, const uint8_t *iv,
+        const uint8_t *src, uint8_t *dest, size_t len)
+{
+    if (!ks || !iv || !src || !dest)
+        return;
+    uint8_t chain[AES_BLOCK_SIZE];
+    memcpy(chain, iv, AES_BLOCK_SIZE);
+    for (size_t i = 0; i + AES_BLOCK_SIZE <= len; i += AES_BLOCK_SIZE) {
+        for (size_t j = 0; j < AES_BLOCK_SIZE; ++j)
+            chain[j] ^= src[i + j];
+        aes128_encrypt_block(ks, chain, chain);
+        memcpy(dest + i, chain, AES_BLOCK_SIZE);
+    }
+}
+
+/*
+ * Decrypt a buffer with AES-128 in cbc mode. No padding is removed.
+ * @param ks expanded key
+ * @param iv initialization vector
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src buffer to decrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to decrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_cbc_decrypt(const struct aes128_schedule *ks, const uint8_t *iv,
+        const uint8_t *src, uint8_t *dest, size_t len)
+{
+    if (!ks || !iv || !src || !dest)
+        return;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->aes128_cbc_decrypt) {
+        k->aes128_cbc_decrypt(ks, iv, src, dest, len / AES_BLOCK_SIZE);
+        return;
+    }
+    uint8_t chain[AES_BLOCK_SIZE];
+    uint8_t block[AES_BLOCK_SIZE];
+    memcpy(chain, iv, AES_BLOCK_SIZE);
+    for (size_t i = 0; i + AES_BLOCK_SIZE <= len; i += AES_BLOCK_SIZE) {
+        // keep a copy of the ciphertext in case src and dest are the same
+        memcpy(block, src + i, AES_BLOCK_SIZE);
+        aes128_decrypt_block(ks, block, dest + i);
+        for (size_t j = 0; j < AES_BLOCK_SIZE; ++j)
+            dest[i + j] ^= chain[j];
+        memcpy(chain, block, AES_BLOCK_SIZE);
+    }
+}
+
+/*
+ * Encrypt a batch of messages under one key in ecb mode. The key is expanded
+ * (or looked up) once by the caller rather than once per message. This and
+ * the other batch functions spread large batches over the default thread
+ * pool, up to thread_pool_batch_limit() threads; messages must not overlap.
+ * @param ks expanded key
+ * @param msgs messages to encrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_ecb_encrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num)
+{
+    if (!ks || !msgs)
+        return;
+    run_batch(ks, msgs, num, ECB_ENCRYPT);
+}
+
+/*
+ * Decrypt a batch of messages under one key in ecb mode
+ * @param ks expanded key
+ * @param msgs messages to decrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_ecb_decrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num)
+{
+    if (!ks || !msgs)
+        return;
+    run_batch(ks, msgs, num, ECB_DECRYPT);
+}
+
+/*
+ * Encrypt a batch of messages under one key in cbc mode, each with its own iv
+ * @param ks expanded key
+ * @param msgs messages to encrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_cbc_encrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num)
+{
+    if (!ks || !msgs)
+        return;
+    run_batch(ks, msgs, num, CBC_ENCRYPT);
+}
+
+/*
+ * Decrypt a batch of messages under one key in cbc mode, each with its own iv
+ * @param ks expanded key
+ * @param msgs messages to decrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_cbc_decrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num)
+{
+    if (!ks || !msgs)
+        return;
+    run_batch(ks, msgs, num, CBC_DECRYPT);
+}
+
+/*
+ * Run a batch operation, spreading the messages over the default thread pool
+ * when there is enough work, up to the library's batch limit
+ */
+static void run_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num, enum batch_op op)
+{
+    struct batch_job job = { ks, msgs, op };
+    size_t limit = thread_pool_batch_limit();
+    size_t total = 0;
+    for (size_t i = 0; i < num && total < BATCH_PARALLEL_MIN; ++i)
+        total += msgs[i].len;
+    if (limit == 1 || num < 2 || total < BATCH_PARALLEL_MIN)
+        batch_range(&job, 0, num);
+    else
+        thread_pool_parallel_for(NULL, 0, num, 1, limit, batch_range, &job);
+}
+
+/*
+ * Apply a batch operation to messages [begin, end)
+ */
+static void batch_range(void *arg, size_t begin, size_t end)
+{
+    const struct batch_job *job = arg;
+    const struct cipher_message *m = job->msgs;
+    for (size_t i = begin; i < end; ++i) {
+        switch (job->op) {
+        case ECB_ENCRYPT:
+            aes128_ecb_encrypt(job->ks, m[i].src, m[i].dest, m[i].len);
+            break;
+        case ECB_DECRYPT:
+            aes128_ecb_decrypt(job->ks, m[i].src, m[i].dest, m[i].len);
+            break;
+        case CBC_ENCRYPT:
+            aes128_cbc_encrypt(job->ks, m[i].iv, m[i].src, m[i].dest,
+                    m[i].len);
+            break;
+        case CBC_DECRYPT:
+            aes128_cbc_decrypt(job->ks, m[i].iv, m[i].src, m[i].dest,
+                    m[i].len);
+            break;
+        }
+    }
+}
+
+/*
+ * Pick the hash table slot for a window, mixing in its alignment so windows
+ * with the same contents at different alignments spread out
+ */
+static size_t window_slot(uint64_t hash, size_t alignment, size_t mask)
+{
+    uint64_t h = (hash ^ alignment) * 0x9e3779b97f4a7c15ull;
+    return (size_t) (h ^ (h >> 32)) & mask;
+}
+
+/*
+ * Multiply by x (i.e. 2) in GF(2^8)
+ */
+static uint8_t xtime(uint8_t x)
+{
+    return (uint8_t) ((x << 1) ^ ((x & 0x80) ? 0x1b : 0x00));
+}
+
+/*
+ * Substitute each byte of the state through an s-box
+ * @param state 16-byte aes state
+ * @param box either sbox or inv_sbox
+ */
+static void sub_bytes(uint8_t *state, const uint8_t *box)
+{
+    for (size_t i = 0; i < AES_BLOCK_SIZE; ++i)
+        state[i] = box[state[i]];
+}
+
+/*
+ * Rotate row r of the (column-major) state left by r bytes
+ */
+static void shift_rows(uint8_t *state)
+{
+    uint8_t t[AES_BLOCK_SIZE];
+    for (size_t c = 0; c < 4; ++c)
+        for (size_t r = 0; r < 4; ++r)
+            t[4 * c + r] = state[4 * ((c + r) % 4) + r];
+    memcpy(state, t, AES_BLOCK_SIZE);
+}
+
+/*
+ * Rotate row r of the (column-major) state right by r bytes
+ */
+static void inv_shift_rows(uint8_t *state)
+{
+    uint8_t t[AES_BLOCK_SIZE];
+    for (size_t c = 0; c < 4; ++c)
+        for (size_t r = 0; r < 4; ++r)
+            t[4 * ((c + r) % 4) + r] = state[4 * c + r];
+    memcpy(state, t, AES_BLOCK_SIZE);
+}
+
+/*
+ * Multiply each column of the state by the MixColumns polynomial
+ */
+static void mix_columns(uint8_t *state)
+{
+    for (size_t c = 0; c < 4; ++c) {
+        uint8_t *col = state + 4 * c;
+        uint8_t a0 = col[0], a1 = col[1], a2 = col[2], a3 = col[3];
+        uint8_t all = a0 ^ a1 ^ a2 ^ a3;
+        col[0] ^= all ^ xtime(a0 ^ a1);
+        col[1] ^= all ^ xtime(a1 ^ a2);
+        col[2] ^= all ^ xtime(a2 ^ a3);
+        col[3] ^= all ^ xtime(a3 ^ a0);
+    }
+}
+
+/*
+ * Multiply each column of the state by the inverse MixColumns polynomial
+ */
+static void inv_mix_columns(uint8_t *state)
+{
+    // InvMixColumns = MixColumns after multiplying by {04}x^2 + {05}
+    for (size_t c = 0; c < 4; ++c) {
+        uint8_t *col = state + 4 * c;
+        uint8_t u = xtime(xtime(col[0] ^ col[2]));
+        uint8_t v = xtime(xtime(col[1] ^ col[3]));
+        col[0] ^= u;
+        col[1] ^= v;
+        col[2] ^= u;
+        col[3] ^= v;
+    }
+    mix_columns(state);
+}
+
+/*
+ * Xor a round key into the state
+ */
+static void add_round_key(uint8_t *state, const uint8_t *round_key)
+{
+    for (size_t i = 0; i < AES_BLOCK_SIZE; ++i)
+        state[i] ^= round_key[i];
+}
@@ -2,7 +2,10 @@
  * cipher.h
  * Functions related to block ciphers, particularly aes-ecb, for the Matasano
  * crypto challenges.
- *  1) Detect if something has been ecb encrypted
+ *  1) Detect if something has been ecb encrypted, even at an unknown offset
+ *  2) AES-128 key expansion and block encryption/decryption
+ *  3) AES-128 in ecb and cbc modes, one buffer or a batch of messages at a time
+ *  4) PKCS#7 padding
  */
 
 #ifndef ___cipher_h___
@@ -11,6 +14,34 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#define AES_BLOCK_SIZE 16
+#define AES128_KEY_SIZE 16
+#define AES128_ROUNDS 10
+#define AES128_SCHEDULE_SIZE ((AES128_ROUNDS + 1) * AES_BLOCK_SIZE)
+
+// Expanded round keys for a single AES-128 key. The decryption schedule holds
+// the round keys for the equivalent inverse cipher, i.e. in reverse order with
+// InvMixColumns already applied to the middle rounds.
+struct aes128_schedule {
+    uint8_t enc[AES128_SCHEDULE_SIZE];
+    uint8_t dec[AES128_SCHEDULE_SIZE];
+};
+
+// Where ecb structure was found by find_ecb_alignment
+struct ecb_alignment {
+    size_t offset;      // alignment of the repeated windows, < block_size
+    size_t repeats;     // windows at that alignment repeating an earlier one
+    size_t first;       // index of the first repeating window
+};
+
+// One message of a batch operation. For ecb, iv is ignored.
+struct cipher_message {
+    const uint8_t *src;
+    uint8_t *dest;
+    size_t len;         // must be a multiple of AES_BLOCK_SIZE
+    const uint8_t *iv;  // AES_BLOCK_SIZE bytes, cbc only
+};
+
 /*
  * Guess whether a given cipher text has been encrypted using aes in 128-bit
  * ecb mode. Since ecb under a given key will always map the same 16-byte
@@ -20,5 +51,180 @@
  */
 uint32_t is_ecb_encrypted(const uint8_t *ciphertext, size_t len);
 
+/*
+ * Look for ecb structure at any alignment, e.g. behind a header of unknown
+ * length. Every block_size-byte window is hashed with a rolling hash, and
+ * windows whose contents match an earlier window a whole number of blocks
+ * back count as repeats for their alignment. Matches are verified byte for
+ * byte, and the scan takes expected linear time.
+ * @param ciphertext buffer to search
+ * @param len length of the buffer
+ *        precondition: length of ciphertext buffer >= len
+ * @param block_size window size
+ * @param out pointer to struct to write the best alignment to; may be NULL
+ * @return number of repeats at the alignment with the most of them (the
+ *         earliest alignment on a tie), 0 if there are none, or SIZE_MAX on
+ *         allocation failure
+ */
+size_t find_ecb_alignment(const uint8_t *ciphertext, size_t len,
+        size_t block_size, struct ecb_alignment *out);
+
+/*
+ * Find the first pair of identical adjacent blocks in a buffer
+ * @param ciphertext buffer to search
+ * @param len length of the buffer
+ *        precondition: length of ciphertext buffer >= len
+ * @param block_size size of the blocks to compare
+ * @param start index of the first block to consider
+ * @return index of the first block of the pair, or SIZE_MAX if there is none
+ */
+size_t find_adjacent_repeated_blocks(const uint8_t *ciphertext, size_t len,
+        size_t block_size, size_t start);
+
+/*
+ * Append PKCS#7 padding to a buffer in place
+ * @param buf buffer holding the data to pad
+ *        precondition: length of buf >= len + block_size - len % block_size
+ * @param len number of data bytes in buf
+ * @param block_size block size to pad to
+ *        precondition: 0 < block_size <= 255
+ * @return length of the padded data
+ */
+size_t pkcs7_pad(uint8_t *buf, size_t len, size_t block_size);
+
+/*
+ * Check and strip PKCS#7 padding
+ * @param buf padded data
+ * @param len length of the padded data
+ *        precondition: length of buf >= len
+ * @param block_size block size the data was padded to
+ * @return length of the data without padding, or SIZE_MAX if the padding is
+ *         not valid
+ */
+size_t pkcs7_unpad(const uint8_t *buf, size_t len, size_t block_size);
+
+/*
+ * Expand an AES-128 key into its encryption and decryption round keys
+ * @param out pointer to schedule to write the round keys to
+ * @param key raw key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ */
+void aes128_expand_key(struct aes128_schedule *out, const uint8_t *key);
+
+/*
+ * Encrypt a single block with AES-128
+ * @param ks expanded key
+ * @param src block to encrypt
+ * @param dest buffer to write the encrypted block to; may be the same as src
+ *        precondition: length of src and dest buffers >= AES_BLOCK_SIZE
+ */
+void aes128_encrypt_block(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest);
+
+/*
+ * Decrypt a single block with AES-128
+ * @param ks expanded key
+ * @param src block to decrypt
+ * @param dest buffer to write the decrypted block to; may be the same as src
+ *        precondition: length of src and dest buffers >= AES_BLOCK_SIZE
+ */
+void aes128_decrypt_block(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest);
+
+/*
+ * Encrypt a buffer with AES-128 in ecb mode. No padding is applied.
+ * @param ks expanded key
+ * @param src buffer to encrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to encrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_ecb_encrypt(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest, size_t len);
+
+/*
+ * Decrypt a buffer with AES-128 in ecb mode. No padding is removed.
+ * @param ks expanded key
+ * @param src buffer to decrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to decrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_ecb_decrypt(const struct aes128_schedule *ks, const uint8_t *src,
+        uint8_t *dest, size_t len);
+
+/*
+ * Encrypt a buffer with AES-128 in cbc mode. No padding is applied.
+ * @param ks expanded key
+ * @param iv initialization vector
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src buffer to encrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to encrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_cbc_encrypt(const struct aes128_schedule *ks, const uint8_t *iv,
+        const uint8_t *src, uint8_t *dest, size_t len);
+
+/*
+ * Decrypt a buffer with AES-128 in cbc mode. No padding is removed.
+ * @param ks expanded key
+ * @param iv initialization vector
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src buffer to decrypt
+ * @param dest buffer to hold the result; may be the same as src
+ * @param len number of bytes to decrypt
+ *        precondition: len % AES_BLOCK_SIZE == 0
+ *        precondition: length of src and dest buffers >= len
+ */
+void aes128_cbc_decrypt(const struct aes128_schedule *ks, const uint8_t *iv,
+        const uint8_t *src, uint8_t *dest, size_t len);
+
+/*
+ * Encrypt a batch of messages under one key in ecb mode. The key is expanded
+ * (or looked up) once by the caller rather than once per message. This and
+ * the other batch functions spread large batches over the default thread
+ * pool, up to thread_pool_batch_limit() threads; messages must not overlap.
+ * @param ks expanded key
+ * @param msgs messages to encrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_ecb_encrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num);
+
+/*
+ * Decrypt a batch of messages under one key in ecb mode
+ * @param ks expanded key
+ * @param msgs messages to decrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_ecb_decrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num);
+
+/*
+ * Encrypt a batch of messages under one key in cbc mode, each with its own iv
+ * @param ks expanded key
+ * @param msgs messages to encrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_cbc_encrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num);
+
+/*
+ * Decrypt a batch of messages under one key in cbc mode, each with its own iv
+ * @param ks expanded key
+ * @param msgs messages to decrypt
+ * @param num number of messages
+ *        precondition: length of msgs array >= num
+ */
+void aes128_cbc_decrypt_batch(const struct aes128_schedule *ks,
+        const struct cipher_message *msgs, size_t num);
+
 #endif  // ___cipher_h___
 
@@ -4,6 +4,11 @@
 #include <assert.h>
 
 #include "convert.h"
+#include "cpu_dispatch.h"
+#include "stats.h"
+#include "probes.h"
+
+#define HISTOGRAM_BLOCK 256     // bytes decoded at a time by base16_histogram
 
 // Private functions
 static void read_3bytes_base64(const uint8_t *src, char *out);
@@ -13,6 +18,11 @@ static void decode_4bytes_base64(const char *src, uint8_t *dest);
 static uint8_t char64_to_raw(char char64);
 static void read_base64_with_padding(char *dest, const uint8_t *src,
         size_t len);
+static int is_space(char c);
+static int hex_value(char c);
+static int base64_value(char c);
+static void count_block(uint32_t hist[256], uint32_t sub[3][256],
+        const uint8_t *src, size_t len);
 
 /*
  * print the bytes in a buffer as hexadecimal characters
@@ -183,14 +193,21 @@ void read_base16(uint8_t *dest, const char *src, size_t len)
 {
     if (!dest || !src)
         return;
-    for (size_t i = 0; i < len; ++i) {
+    PROBE1(read_base16__entry, len);
+    STATS_SCOPE(STATS_READ_BASE16, len);
+    // the vector kernel stops at the first bad pair, and the loop below picks
+    // up from there to decode the tail and report the error
+    const struct cpu_kernels *k = cpu_kernels();
+    size_t i = k->hex_decode ? k->hex_decode(dest, src, len) : 0;
+    for (; i < len; ++i) {
         char char16 = src[i];
         uint8_t raw = char16_to_raw(char16);
         if (raw > 15)
-            return;     // error detected
+            break;      // error detected
         uint32_t shift = 4 * (1 - (i % 2));
         dest[i/2] = (dest[i/2] & (0xf0 >> shift)) | (raw << shift);
     }
+    PROBE2(read_base16__return, len, i);
 }
 
 /*
@@ -224,6 +241,8 @@ size_t read_base64(uint8_t *dest, const char *src, size_t len)
 {
     if (!dest || !src)
         return 0;
+    PROBE1(read_base64__entry, len);
+    STATS_SCOPE(STATS_READ_BASE64, len);
     size_t groups_of_4 = len / 4;  // groups of 4 base 64 numbers
     size_t out_index = 0;
     // decode in groups of 4
@@ -238,6 +257,7 @@ size_t read_base64(uint8_t *dest, const char *src, size_t len)
         if (src[len - 2] == padding)
             --out_index;
     }
+    PROBE2(read_base64__return, len, out_index);
     return out_index;
 }
 
@@ -283,4 +303,265 @@ static uint8_t char64_to_raw(char char64)
     return UINT8_MAX;
 }
 
+/*
+ * Decode the next piece of a base 16 stream. Whitespace is skipped.
+ * @param d decoder state
+ * @param dest buffer for decoded bytes
+ *        precondition: length of dest buffer >= (len + 1) / 2
+ * @param src next piece of the stream
+ * @param len number of characters in src
+ * @return number of bytes written to dest, or SIZE_MAX if src holds a
+ *         character that is neither a hex digit nor whitespace
+ */
+size_t base16_decode_update(struct base16_decoder *d, uint8_t *dest,
+        const char *src, size_t len)
+{
+    if (!d || !dest || !src)
+        return SIZE_MAX;
+    const struct cpu_kernels *k = cpu_kernels();
+    size_t out = 0;
+    size_t i = 0;
+    while (i < len) {
+        // each run of digits between whitespace goes through the vector
+        // kernel, which stops at the first invalid pair or the run's tail
+        if (!d->pending && k->hex_decode) {
+            size_t run = 0;
+            while (i + run < len && !is_space(src[i + run]))
+                ++run;
+            size_t done = k->hex_decode(dest + out, src + i,
+                    run & ~(size_t) 1);
+            out += done / 2;
+            i += done;
+        }
+        for (; i < len && !is_space(src[i]); ++i) {
+            int v = hex_value(src[i]);
+            if (v < 0)
+                return SIZE_MAX;
+            if (d->pending)
+                dest[out++] = (d->high << 4) | v;
+            else
+                d->high = v;
+            d->pending = !d->pending;
+        }
+        while (i < len && is_space(src[i]))
+            ++i;
+    }
+    return out;
+}
+
+/*
+ * Check that a base 16 stream ended on a whole byte
+ * @return 0 if so, or -1 if a digit was left over
+ */
+int base16_decode_final(const struct base16_decoder *d)
+{
+    return d && !d->pending ? 0 : -1;
+}
+
+/*
+ * Decode the next piece of a base 64 stream. Whitespace is skipped, and '='
+ * padding may end any group, so concatenated streams decode as one.
+ * @param d decoder state
+ * @param dest buffer for decoded bytes
+ *        precondition: length of dest buffer >= 3 * ((len + 3) / 4)
+ * @param src next piece of the stream
+ * @param len number of characters in src
+ * @return number of bytes written to dest, or SIZE_MAX if src holds a
+ *         character outside the base 64 alphabet, or misplaced padding
+ */
+size_t base64_decode_update(struct base64_decoder *d, uint8_t *dest,
+        const char *src, size_t len)
+{
+    if (!d || !dest || !src)
+        return SIZE_MAX;
+    size_t out = 0;
+    for (size_t i = 0; i < len; ++i) {
+        int v = base64_value(src[i]);
+        if (v == -2)
+            continue;   // whitespace
+        if (v == -3)
+            return SIZE_MAX;
+        if (v == -1) {
+            // padding only fills the last one or two places of a group
+            if (d->count < 2)
+                return SIZE_MAX;
+            ++d->padding;
+            v = 0;
+        } else if (d->padding) {
+            return SIZE_MAX;
+        }
+        d->group = (d->group << 6) | v;
+        if (++d->count < 4)
+            continue;
+        dest[out] = d->group >> 16;
+        dest[out + 1] = d->group >> 8;
+        dest[out + 2] = d->group;
+        out += 3 - d->padding;
+        d->group = 0;
+        d->count = 0;
+        d->padding = 0;
+    }
+    return out;
+}
+
+/*
+ * Check that a base 64 stream ended on a whole group
+ * @return 0 if so, or -1 if characters were left over
+ */
+int base64_decode_final(const struct base64_decoder *d)
+{
+    return d && d->count == 0 ? 0 : -1;
+}
 
+/*
+ * Encode the next piece of a stream in base 64. Output is not terminated.
+ * @param e encoder state
+ * @param dest buffer for the encoded characters
+ *        precondition: length of dest buffer >= 4 * ((len + 2) / 3)
+ * @param src next piece of the stream
+ * @param len number of bytes in src
+ * @return number of characters written to dest
+ */
+size_t base64_encode_update(struct base64_encoder *e, char *dest,
+        const uint8_t *src, size_t len)
+{
+    if (!e || !dest || !src)
+        return 0;
+    size_t out = 0;
+    size_t i = 0;
+    if (e->count) {
+        while (e->count < 3 && i < len)
+            e->pending[e->count++] = src[i++];
+        if (e->count < 3)
+            return 0;
+        read_3bytes_base64(e->pending, dest);
+        out += 4;
+        e->count = 0;
+    }
+    for (; i + 3 <= len; i += 3) {
+        read_3bytes_base64(src + i, dest + out);
+        out += 4;
+    }
+    for (; i < len; ++i)
+        e->pending[e->count++] = src[i];
+    return out;
+}
+
+/*
+ * Encode the bytes left at the end of a stream, with padding
+ * @param e encoder state
+ * @param dest buffer for the encoded characters
+ *        precondition: length of dest buffer >= 4
+ * @return number of characters written to dest, 0 or 4
+ */
+size_t base64_encode_final(struct base64_encoder *e, char *dest)
+{
+    if (!e || !dest || !e->count)
+        return 0;
+    read_base64_with_padding(dest, e->pending, e->count);
+    e->count = 0;
+    return 4;
+}
+
+/*
+ * Count the bytes a base 16 string decodes to, without writing them out.
+ * The string is decoded a small block at a time into a buffer that stays
+ * in L1, so the text is only read once, and the blocks are counted into
+ * the same split counters, which are folded together once at the end.
+ * @param hist output for the count of each byte value
+ * @param src base 16 string
+ * @param len number of characters in src; a trailing odd digit is ignored
+ *        precondition: length of src buffer >= len
+ * @return number of bytes counted, or SIZE_MAX if src holds a character
+ *         that isn't a hex digit
+ */
+size_t base16_histogram(uint32_t hist[256], const char *src, size_t len)
+{
+    if (!hist || !src)
+        return SIZE_MAX;
+    memset(hist, 0, 256 * sizeof hist[0]);
+    const struct cpu_kernels *k = cpu_kernels();
+    uint8_t block[HISTOGRAM_BLOCK];
+    uint32_t sub[3][256];
+    memset(sub, 0, sizeof sub);
+    len &= ~(size_t) 1;
+    for (size_t i = 0; i < len; i += 2 * HISTOGRAM_BLOCK) {
+        size_t chars = len - i < 2 * HISTOGRAM_BLOCK ? len - i :
+            2 * HISTOGRAM_BLOCK;
+        size_t done = k->hex_decode ? k->hex_decode(block, src + i, chars) : 0;
+        for (; done < chars; done += 2) {
+            int high = hex_value(src[i + done]);
+            int low = hex_value(src[i + done + 1]);
+            if (high < 0 || low < 0)
+                return SIZE_MAX;
+            block[done / 2] = (high << 4) | low;
+        }
+        count_block(hist, sub, block, chars / 2);
+    }
+    for (size_t b = 0; b < 256; ++b)
+        hist[b] += sub[0][b] + sub[1][b] + sub[2][b];
+    return len / 2;
+}
+
+/*
+ * @return whether c is a space, tab or line break
+ */
+static int is_space(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/*
+ * Value of a hex digit, without complaining about bad ones
+ * @return 0 to 15, or -1 if c isn't a hex digit
+ */
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/*
+ * Value of a base 64 character, without complaining about bad ones
+ * @return 0 to 63, -1 for padding, -2 for whitespace, or -3 otherwise
+ */
+static int base64_value(char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    if (c == '=')
+        return -1;
+    return is_space(c) ? -2 : -3;
+}
+
+/*
+ * Count a block of bytes as byte_histogram does, spread over hist and three
+ * more sets of counters so that runs of one byte don't stall on a single
+ * counter, leaving the sets for the caller to add up
+ */
+static void count_block(uint32_t hist[256], uint32_t sub[3][256],
+        const uint8_t *src, size_t len)
+{
+    size_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        ++hist[src[i]];
+        ++sub[0][src[i + 1]];
+        ++sub[1][src[i + 2]];
+        ++sub[2][src[i + 3]];
+    }
+    for (; i < len; ++i)
+        ++hist[src[i]];
+}
@@ -5,6 +5,28 @@
 #include <stdint.h>
 #include <stddef.h>
 
+// State for decoding base 16 a piece at a time. Zero it before the first
+// call; a digit pair may be split across calls.
+struct base16_decoder {
+    uint8_t high;       // first digit of an unfinished pair
+    int pending;        // whether high holds a digit
+};
+
+// State for decoding base 64 a piece at a time. Zero it before the first
+// call; a group of 4 characters may be split across calls.
+struct base64_decoder {
+    uint32_t group;     // 6-bit values of the unfinished group
+    unsigned count;     // number of values in group
+    unsigned padding;   // '=' characters in group
+};
+
+// State for encoding base 64 a piece at a time. Zero it before the first
+// call.
+struct base64_encoder {
+    uint8_t pending[3]; // bytes not yet encoded, as they don't make a group
+    size_t count;
+};
+
 /*
  * print the bytes in a buffer as hexadecimal characters
  * @param src pointer to data to print
@@ -68,5 +90,78 @@ void read_base16(uint8_t *dest, const char *src, size_t len);
  */
 size_t read_base64(uint8_t *dest, const char *src, size_t len);
 
+/*
+ * Decode the next piece of a base 16 stream. Whitespace is skipped.
+ * @param d decoder state
+ * @param dest buffer for decoded bytes
+ *        precondition: length of dest buffer >= (len + 1) / 2
+ * @param src next piece of the stream
+ * @param len number of characters in src
+ * @return number of bytes written to dest, or SIZE_MAX if src holds a
+ *         character that is neither a hex digit nor whitespace
+ */
+size_t base16_decode_update(struct base16_decoder *d, uint8_t *dest,
+        const char *src, size_t len);
+
+/*
+ * Check that a base 16 stream ended on a whole byte
+ * @return 0 if so, or -1 if a digit was left over
+ */
+int base16_decode_final(const struct base16_decoder *d);
+
+/*
+ * Decode the next piece of a base 64 stream. Whitespace is skipped, and '='
+ * padding may end any group, so concatenated streams decode as one.
+ * @param d decoder state
+ * @param dest buffer for decoded bytes
+ *        precondition: length of dest buffer >= 3 * ((len + 3) / 4)
+ * @param src next piece of the stream
+ * @param len number of characters in src
+ * @return number of bytes written to dest, or SIZE_MAX if src holds a
+ *         character outside the base 64 alphabet, or misplaced padding
+ */
+size_t base64_decode_update(struct base64_decoder *d, uint8_t *dest,
+        const char *src, size_t len);
+
+/*
+ * Check that a base 64 stream ended on a whole group
+ * @return 0 if so, or -1 if characters were left over
+ */
+int base64_decode_final(const struct base64_decoder *d);
+
+/*
+ * Encode the next piece of a stream in base 64. Output is not terminated.
+ * @param e encoder state
+ * @param dest buffer for the encoded characters
+ *        precondition: length of dest buffer >= 4 * ((len + 2) / 3)
+ * @param src next piece of the stream
+ * @param len number of bytes in src
+ * @return number of characters written to dest
+ */
+size_t base64_encode_update(struct base64_encoder *e, char *dest,
+        const uint8_t *src, size_t len);
+
+/*
+ * Encode the bytes left at the end of a stream, with padding
+ * @param e encoder state
+ * @param dest buffer for the encoded characters
+ *        precondition: length of dest buffer >= 4
+ * @return number of characters written to dest, 0 or 4
+ */
+size_t base64_encode_final(struct base64_encoder *e, char *dest);
+
+/*
+ * Count the bytes a base 16 string decodes to, without writing them out.
+ * The string is decoded a small block at a time into a buffer that stays
+ * in L1, so the text is only read once.
+ * @param hist output for the count of each byte value
+ * @param src base 16 string
+ * @param len number of characters in src; a trailing odd digit is ignored
+ *        precondition: length of src buffer >= len
+ * @return number of bytes counted, or SIZE_MAX if src holds a character
+ *         that isn't a hex digit
+ */
+size_t base16_histogram(uint32_t hist[256], const char *src, size_t len);
+
 #endif  // ___convert_h___
 
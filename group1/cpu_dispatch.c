@@ -0,0 +1,864 @@
+/*
+ * cpu_dispatch.c
+ * Runtime selection of SIMD kernels. The cpu is probed once, on first use, and
+ * each accelerated operation is bound to the best kernel the cpu supports.
+ * The x86 kernels are compiled with per-function target attributes, so the
+ * rest of the library needs no special compiler flags and still runs on any
+ * x86-64 host.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "cpu_dispatch.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define HAVE_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define HAVE_X86_KERNELS 0
+#endif
+
+static pthread_once_t probe_once = PTHREAD_ONCE_INIT;
+static enum cpu_level detected_level = CPU_LEVEL_SCALAR;
+static int has_aesni;
+static int has_vpopcntdq;
+static struct cpu_kernels kernels;
+static struct cpu_dispatch_info info;
+
+static const char *const level_names[] = {
+    "scalar", "sse4.2", "avx2", "avx512"
+};
+
+// Private functions
+static void probe(void);
+static void bind(enum cpu_level level);
+#if HAVE_X86_KERNELS
+static void xor_bytes_sse2(uint8_t *dest, const uint8_t *a, const uint8_t *b,
+        size_t len);
+static void xor_bytes_avx2(uint8_t *dest, const uint8_t *a, const uint8_t *b,
+        size_t len);
+static void xor_bytes_avx512(uint8_t *dest, const uint8_t *a,
+        const uint8_t *b, size_t len);
+static uint64_t popcount_xor_popcnt(const uint8_t *a, const uint8_t *b,
+        size_t len);
+static uint64_t popcount_xor_avx2(const uint8_t *a, const uint8_t *b,
+        size_t len);
+static uint64_t popcount_xor_avx512(const uint8_t *a, const uint8_t *b,
+        size_t len);
+static void hamming_panel_popcnt(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride);
+static void hamming_panel_avx2(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride);
+static void hamming_panel_avx512(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride);
+static size_t hex_decode_sse(uint8_t *dest, const char *src, size_t len);
+static size_t hex_decode_avx2(uint8_t *dest, const char *src, size_t len);
+static void aes128_encrypt_blocks_aesni(const struct aes128_schedule *ks,
+        const uint8_t *src, uint8_t *dest, size_t blocks);
+static void aes128_decrypt_blocks_aesni(const struct aes128_schedule *ks,
+        const uint8_t *src, uint8_t *dest, size_t blocks);
+static void aes128_cbc_decrypt_aesni(const struct aes128_schedule *ks,
+        const uint8_t *iv, const uint8_t *src, uint8_t *dest, size_t blocks);
+static int64_t trigram_sum_avx2(const uint8_t *classes, size_t len,
+        const int16_t *table);
+static int64_t trigram_sum_avx512(const uint8_t *classes, size_t len,
+        const int16_t *table);
+static int64_t trigram_sum_tail(const uint8_t *classes, size_t len,
+        const int16_t *table);
+
+// Every key size with a key_xor kernel, in slot order
+#define KEY_XOR_SIZES(X) \
+    X(1) \
+    X(2) \
+    X(3) \
+    X(4) \
+    X(5) \
+    X(6) \
+    X(7) \
+    X(8) \
+    X(9) \
+    X(10) \
+    X(11) \
+    X(12) \
+    X(13) \
+    X(14) \
+    X(15) \
+    X(16) \
+    X(17) \
+    X(18) \
+    X(19) \
+    X(20) \
+    X(21) \
+    X(22) \
+    X(23) \
+    X(24) \
+    X(25) \
+    X(26) \
+    X(27) \
+    X(28) \
+    X(29) \
+    X(30) \
+    X(31) \
+    X(32) \
+    X(64) \
+    X(128) \
+    X(256)
+
+#define DECLARE_KEY_XOR(size) \
+    static void key_xor_avx2_##size(const uint8_t *key, const uint8_t *src, \
+            uint8_t *dest, size_t len); \
+    static void key_xor_avx512_##size(const uint8_t *key, \
+            const uint8_t *src, uint8_t *dest, size_t len);
+KEY_XOR_SIZES(DECLARE_KEY_XOR)
+
+#define LIST_KEY_XOR_AVX2(size) key_xor_avx2_##size,
+#define LIST_KEY_XOR_AVX512(size) key_xor_avx512_##size,
+static void (*const key_xor_avx2[KEY_XOR_KERNELS])(const uint8_t *key,
+        const uint8_t *src, uint8_t *dest, size_t len) = {
+    KEY_XOR_SIZES(LIST_KEY_XOR_AVX2)
+};
+static void (*const key_xor_avx512[KEY_XOR_KERNELS])(const uint8_t *key,
+        const uint8_t *src, uint8_t *dest, size_t len) = {
+    KEY_XOR_SIZES(LIST_KEY_XOR_AVX512)
+};
+#endif
+
+/*
+ * Get the kernel table, probing the cpu on the first call
+ */
+const struct cpu_kernels *cpu_kernels(void)
+{
+    pthread_once(&probe_once, probe);
+    return &kernels;
+}
+
+/*
+ * Rebind every kernel for a given level, capped at what the cpu supports.
+ * Not safe to call while other threads are using the library.
+ * @param level level to use
+ * @return the level actually bound
+ */
+enum cpu_level cpu_dispatch_set_level(enum cpu_level level)
+{
+    pthread_once(&probe_once, probe);
+    if (level > detected_level)
+        level = detected_level;
+    bind(level);
+    return level;
+}
+
+/*
+ * Describe the detected cpu and the bound kernels
+ * @param out pointer to info struct to fill in
+ */
+void cpu_dispatch_get_info(struct cpu_dispatch_info *out)
+{
+    if (!out)
+        return;
+    pthread_once(&probe_once, probe);
+    *out = info;
+}
+
+/*
+ * Name of a level, as accepted in MATASANO_CPU_LEVEL
+ */
+const char *cpu_level_name(enum cpu_level level)
+{
+    if ((size_t) level >= sizeof level_names / sizeof level_names[0])
+        return "unknown";
+    return level_names[level];
+}
+
+/*
+ * Find the best level the cpu supports, apply any override from the
+ * environment and bind the kernels
+ */
+static void probe(void)
+{
+#if HAVE_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+        detected_level = CPU_LEVEL_SSE42;
+    if (detected_level == CPU_LEVEL_SSE42 && __builtin_cpu_supports("avx2"))
+        detected_level = CPU_LEVEL_AVX2;
+    if (detected_level == CPU_LEVEL_AVX2 &&
+            __builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512bw"))
+        detected_level = CPU_LEVEL_AVX512;
+    has_aesni = __builtin_cpu_supports("aes");
+    has_vpopcntdq = __builtin_cpu_supports("avx512vpopcntdq");
+#endif
+    enum cpu_level level = detected_level;
+    const char *forced = getenv(CPU_LEVEL_ENV);
+    for (size_t i = 0; forced && i < sizeof level_names /
+            sizeof level_names[0]; ++i)
+        if (strcmp(forced, level_names[i]) == 0 &&
+                (enum cpu_level) i < level)
+            level = (enum cpu_level) i;
+    bind(level);
+}
+
+/*
+ * Fill in the kernel table and info for a level
+ */
+static void bind(enum cpu_level level)
+{
+    memset(&kernels, 0, sizeof kernels);
+    const char *xor_name = "scalar";
+    const char *popcount_name = "scalar";
+    const char *hex_name = "scalar";
+    const char *aes_name = "scalar";
+    const char *trigram_name = "scalar";
+    const char *key_xor_name = "none";
+    const char *hamming_name = "scalar";
+#if HAVE_X86_KERNELS
+    if (level >= CPU_LEVEL_SSE42) {
+        kernels.xor_bytes = xor_bytes_sse2;
+        kernels.popcount_xor = popcount_xor_popcnt;
+        kernels.hex_decode = hex_decode_sse;
+        kernels.hamming_panel = hamming_panel_popcnt;
+        xor_name = "sse2";
+        popcount_name = hamming_name = "popcnt";
+        hex_name = "ssse3";
+        if (has_aesni) {
+            kernels.aes128_encrypt_blocks = aes128_encrypt_blocks_aesni;
+            kernels.aes128_decrypt_blocks = aes128_decrypt_blocks_aesni;
+            kernels.aes128_cbc_decrypt = aes128_cbc_decrypt_aesni;
+            aes_name = "aesni";
+        }
+    }
+    if (level >= CPU_LEVEL_AVX2) {
+        kernels.xor_bytes = xor_bytes_avx2;
+        kernels.popcount_xor = popcount_xor_avx2;
+        kernels.hex_decode = hex_decode_avx2;
+        kernels.trigram_sum = trigram_sum_avx2;
+        memcpy(kernels.key_xor, key_xor_avx2, sizeof kernels.key_xor);
+        kernels.hamming_panel = hamming_panel_avx2;
+        xor_name = popcount_name = hex_name = trigram_name = "avx2";
+        hamming_name = "avx2";
+        key_xor_name = "avx2";
+    }
+    if (level >= CPU_LEVEL_AVX512) {
+        kernels.xor_bytes = xor_bytes_avx512;
+        kernels.trigram_sum = trigram_sum_avx512;
+        memcpy(kernels.key_xor, key_xor_avx512, sizeof kernels.key_xor);
+        xor_name = trigram_name = key_xor_name = "avx512";
+        if (has_vpopcntdq) {
+            kernels.popcount_xor = popcount_xor_avx512;
+            kernels.hamming_panel = hamming_panel_avx512;
+            popcount_name = hamming_name = "avx512vpopcntdq";
+        }
+    }
+#endif
+    info.detected = detected_level;
+    info.active = level;
+    info.aesni = kernels.aes128_encrypt_blocks != NULL;
+    info.xor_kernel = xor_name;
+    info.popcount_kernel = popcount_name;
+    info.hex_kernel = hex_name;
+    info.aes_kernel = aes_name;
+    info.trigram_kernel = trigram_name;
+    info.key_xor_kernel = key_xor_name;
+    info.hamming_kernel = hamming_name;
+}
+
+#if HAVE_X86_KERNELS
+
+__attribute__((target("sse2")))
+static void xor_bytes_sse2(uint8_t *dest, const uint8_t *a, const uint8_t *b,
+        size_t len)
+{
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+        __m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_xor_si128(x, y));
+    }
+    for (; i < len; ++i)
+        dest[i] = a[i] ^ b[i];
+}
+
+__attribute__((target("avx2")))
+static void xor_bytes_avx2(uint8_t *dest, const uint8_t *a, const uint8_t *b,
+        size_t len)
+{
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i *) (a + i));
+        __m256i x1 = _mm256_loadu_si256((const __m256i *) (a + i + 32));
+        __m256i y0 = _mm256_loadu_si256((const __m256i *) (b + i));
+        __m256i y1 = _mm256_loadu_si256((const __m256i *) (b + i + 32));
+        _mm256_storeu_si256((__m256i *) (dest + i), _mm256_xor_si256(x0, y0));
+        _mm256_storeu_si256((__m256i *) (dest + i + 32),
+                _mm256_xor_si256(x1, y1));
+    }
+    for (; i + 16 <= len; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i *) (a + i));
+        __m128i y = _mm_loadu_si128((const __m128i *) (b + i));
+        _mm_storeu_si128((__m128i *) (dest + i), _mm_xor_si128(x, y));
+    }
+    for (; i < len; ++i)
+        dest[i] = a[i] ^ b[i];
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void xor_bytes_avx512(uint8_t *dest, const uint8_t *a,
+        const uint8_t *b, size_t len)
+{
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m512i x = _mm512_loadu_si512(a + i);
+        __m512i y = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(dest + i, _mm512_xor_si512(x, y));
+    }
+    if (i < len) {
+        // masked loads never touch bytes past the end
+        __mmask64 m = (__mmask64) -1 >> (64 - (len - i));
+        __m512i x = _mm512_maskz_loadu_epi8(m, a + i);
+        __m512i y = _mm512_maskz_loadu_epi8(m, b + i);
+        _mm512_mask_storeu_epi8(dest + i, m, _mm512_xor_si512(x, y));
+    }
+}
+
+__attribute__((target("popcnt")))
+static uint64_t popcount_xor_popcnt(const uint8_t *a, const uint8_t *b,
+        size_t len)
+{
+    uint64_t count = 0;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, a + i, 8);
+        memcpy(&y, b + i, 8);
+        count += (uint64_t) __builtin_popcountll(x ^ y);
+    }
+    for (; i < len; ++i)
+        count += (uint64_t) __builtin_popcount(a[i] ^ b[i]);
+    return count;
+}
+
+// Nibble lookup (Mula) popcount: pshufb counts the bits of each nibble and
+// psadbw sums the byte counts into 64-bit lanes
+__attribute__((target("avx2,popcnt")))
+static uint64_t popcount_xor_avx2(const uint8_t *a, const uint8_t *b,
+        size_t len)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2,
+            3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_xor_si256(
+                _mm256_loadu_si256((const __m256i *) (a + i)),
+                _mm256_loadu_si256((const __m256i *) (b + i)));
+        __m256i lo = _mm256_and_si256(v, low);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+        __m256i bits = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+                _mm256_shuffle_epi8(lookup, hi));
+        acc = _mm256_add_epi64(acc,
+                _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *) lanes, acc);
+    uint64_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < len; ++i)
+        count += (uint64_t) __builtin_popcount(a[i] ^ b[i]);
+    return count;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vpopcntdq")))
+static uint64_t popcount_xor_avx512(const uint8_t *a, const uint8_t *b,
+        size_t len)
+{
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m512i v = _mm512_xor_si512(_mm512_loadu_si512(a + i),
+                _mm512_loadu_si512(b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    if (i < len) {
+        __mmask64 m = (__mmask64) -1 >> (64 - (len - i));
+        __m512i v = _mm512_xor_si512(_mm512_maskz_loadu_epi8(m, a + i),
+                _mm512_maskz_loadu_epi8(m, b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    return (uint64_t) _mm512_reduce_add_epi64(acc);
+}
+
+// The hamming_panel kernels keep a grid of rows by columns of distances in
+// registers, so each word of a row is loaded once per group of columns and
+// each panel word once per group of rows. Past the last row, a kernel
+// repeats the last one and throws its sums away.
+
+__attribute__((target("popcnt")))
+static void hamming_panel_popcnt(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride)
+{
+    for (size_t r = 0; r < rows; r += 2) {
+        const uint64_t *a0 = a + r * words;
+        const uint64_t *a1 = r + 1 < rows ? a0 + words : a0;
+        for (size_t j = 0; j < cols; j += 4) {
+            uint64_t c0[4] = { 0 };
+            uint64_t c1[4] = { 0 };
+            for (size_t w = 0; w < words; ++w) {
+                const uint64_t *b = panel + w * cols + j;
+                for (size_t k = 0; k < 4; ++k) {
+                    c0[k] += (uint64_t) __builtin_popcountll(a0[w] ^ b[k]);
+                    c1[k] += (uint64_t) __builtin_popcountll(a1[w] ^ b[k]);
+                }
+            }
+            for (size_t k = 0; k < 4; ++k) {
+                out[r * stride + j + k] = (uint32_t) c0[k];
+                if (r + 1 < rows)
+                    out[(r + 1) * stride + j + k] = (uint32_t) c1[k];
+            }
+        }
+    }
+}
+
+// 2 rows by 8 columns; popcounts use the nibble lookup of popcount_xor_avx2
+__attribute__((target("avx2")))
+static void hamming_panel_avx2(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride)
+{
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2,
+            3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    // moves the low halves of the 64-bit lanes into the low 128 bits
+    const __m256i narrow = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+#define HP_POPCOUNT(v) _mm256_sad_epu8(_mm256_add_epi8( \
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256((v), low)), \
+            _mm256_shuffle_epi8(lookup, _mm256_and_si256( \
+                    _mm256_srli_epi16((v), 4), low))), zero)
+#define HP_STORE(p, v) _mm_storeu_si128((__m128i *) (p), \
+        _mm256_castsi256_si128(_mm256_permutevar8x32_epi32((v), narrow)))
+    for (size_t r = 0; r < rows; r += 2) {
+        const uint64_t *a0 = a + r * words;
+        const uint64_t *a1 = r + 1 < rows ? a0 + words : a0;
+        for (size_t j = 0; j < cols; j += 8) {
+            __m256i c00 = zero, c01 = zero, c10 = zero, c11 = zero;
+            for (size_t w = 0; w < words; ++w) {
+                const uint64_t *b = panel + w * cols + j;
+                __m256i b0 = _mm256_loadu_si256((const __m256i *) b);
+                __m256i b1 = _mm256_loadu_si256((const __m256i *) (b + 4));
+                __m256i x0 = _mm256_set1_epi64x((long long) a0[w]);
+                __m256i x1 = _mm256_set1_epi64x((long long) a1[w]);
+                c00 = _mm256_add_epi64(c00,
+                        HP_POPCOUNT(_mm256_xor_si256(x0, b0)));
+                c01 = _mm256_add_epi64(c01,
+                        HP_POPCOUNT(_mm256_xor_si256(x0, b1)));
+                c10 = _mm256_add_epi64(c10,
+                        HP_POPCOUNT(_mm256_xor_si256(x1, b0)));
+                c11 = _mm256_add_epi64(c11,
+                        HP_POPCOUNT(_mm256_xor_si256(x1, b1)));
+            }
+            HP_STORE(out + r * stride + j, c00);
+            HP_STORE(out + r * stride + j + 4, c01);
+            if (r + 1 < rows) {
+                HP_STORE(out + (r + 1) * stride + j, c10);
+                HP_STORE(out + (r + 1) * stride + j + 4, c11);
+            }
+        }
+    }
+#undef HP_POPCOUNT
+#undef HP_STORE
+}
+
+// 8 rows by 8 columns, one vector of columns per row. The rows are spelled
+// out so that their sums stay in registers.
+#define HP_ROWS(X) X(0) X(1) X(2) X(3) X(4) X(5) X(6) X(7)
+#define HP_ZERO(k) __m512i c##k = _mm512_setzero_si512();
+#define HP_ADD(k) c##k = _mm512_add_epi64(c##k, _mm512_popcnt_epi64( \
+            _mm512_xor_si512(b, _mm512_set1_epi64((long long) a##k[w]))));
+#define HP_STORE(k) if (r + (k) < rows) \
+        _mm256_storeu_si256((__m256i *) (out + (r + (k)) * stride + j), \
+                _mm512_cvtepi64_epi32(c##k));
+#define HP_ROW(k) const uint64_t *a##k = a + (r + (k) < rows ? r + (k) : \
+        rows - 1) * words;
+__attribute__((target("avx512f,avx512vpopcntdq")))
+static void hamming_panel_avx512(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride)
+{
+    for (size_t r = 0; r < rows; r += 8) {
+        HP_ROWS(HP_ROW)
+        for (size_t j = 0; j < cols; j += 8) {
+            HP_ROWS(HP_ZERO)
+            for (size_t w = 0; w < words; ++w) {
+                __m512i b = _mm512_loadu_si512(panel + w * cols + j);
+                HP_ROWS(HP_ADD)
+            }
+            HP_ROWS(HP_STORE)
+        }
+    }
+}
+#undef HP_ROWS
+#undef HP_ZERO
+#undef HP_ADD
+#undef HP_STORE
+#undef HP_ROW
+
+/*
+ * Turn 16 hex characters into their values
+ * @return 1 if every character is a hex digit, otherwise 0
+ */
+__attribute__((target("sse4.2")))
+static int hex_nibbles_sse(__m128i v, __m128i *out)
+{
+    const __m128i zero = _mm_setzero_si128();
+    // digits map to 0-9 and letters of either case to 0-5; everything else
+    // lands outside those ranges
+    __m128i d = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    __m128i l = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)),
+            _mm_set1_epi8('a'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_subs_epu8(d, _mm_set1_epi8(9)),
+            zero);
+    __m128i is_letter = _mm_cmpeq_epi8(_mm_subs_epu8(l, _mm_set1_epi8(5)),
+            zero);
+    *out = _mm_blendv_epi8(_mm_add_epi8(l, _mm_set1_epi8(10)), d, is_digit);
+    return _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) == 0xffff;
+}
+
+__attribute__((target("sse4.2")))
+static size_t hex_decode_sse(uint8_t *dest, const char *src, size_t len)
+{
+    // multiply-add pairs of nibbles into high * 16 + low
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m128i n0, n1;
+        if (!hex_nibbles_sse(_mm_loadu_si128((const __m128i *) (src + i)),
+                    &n0) ||
+                !hex_nibbles_sse(_mm_loadu_si128(
+                        (const __m128i *) (src + i + 16)), &n1))
+            break;
+        __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(n0, weights),
+                _mm_maddubs_epi16(n1, weights));
+        _mm_storeu_si128((__m128i *) (dest + i / 2), bytes);
+    }
+    return i;
+}
+
+/*
+ * Turn 32 hex characters into their values
+ * @return 1 if every character is a hex digit, otherwise 0
+ */
+__attribute__((target("avx2")))
+static int hex_nibbles_avx2(__m256i v, __m256i *out)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+    __m256i l = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)),
+            _mm256_set1_epi8('a'));
+    __m256i is_digit = _mm256_cmpeq_epi8(
+            _mm256_subs_epu8(d, _mm256_set1_epi8(9)), zero);
+    __m256i is_letter = _mm256_cmpeq_epi8(
+            _mm256_subs_epu8(l, _mm256_set1_epi8(5)), zero);
+    *out = _mm256_blendv_epi8(_mm256_add_epi8(l, _mm256_set1_epi8(10)), d,
+            is_digit);
+    return _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) == -1;
+}
+
+__attribute__((target("avx2")))
+static size_t hex_decode_avx2(uint8_t *dest, const char *src, size_t len)
+{
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m256i n0, n1;
+        if (!hex_nibbles_avx2(_mm256_loadu_si256(
+                        (const __m256i *) (src + i)), &n0) ||
+                !hex_nibbles_avx2(_mm256_loadu_si256(
+                        (const __m256i *) (src + i + 32)), &n1))
+            break;
+        // packus works within 128-bit lanes, so put the quarters back in
+        // order afterwards
+        __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(n0, weights),
+                _mm256_maddubs_epi16(n1, weights));
+        bytes = _mm256_permute4x64_epi64(bytes, 0xd8);
+        _mm256_storeu_si256((__m256i *) (dest + i / 2), bytes);
+    }
+    return i + hex_decode_sse(dest + i / 2, src + i, len - i);
+}
+
+// Blocks are processed four at a time so the aes units can overlap rounds of
+// independent blocks
+
+__attribute__((target("aes,sse4.2")))
+static void aes128_encrypt_blocks_aesni(const struct aes128_schedule *ks,
+        const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+    __m128i rk[AES128_ROUNDS + 1];
+    for (size_t r = 0; r <= AES128_ROUNDS; ++r)
+        rk[r] = _mm_loadu_si128((const __m128i *) (ks->enc +
+                    r * AES_BLOCK_SIZE));
+    size_t i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        __m128i b[4];
+        for (size_t k = 0; k < 4; ++k)
+            b[k] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (src +
+                            (i + k) * AES_BLOCK_SIZE)), rk[0]);
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            for (size_t k = 0; k < 4; ++k)
+                b[k] = _mm_aesenc_si128(b[k], rk[r]);
+        for (size_t k = 0; k < 4; ++k)
+            _mm_storeu_si128((__m128i *) (dest + (i + k) * AES_BLOCK_SIZE),
+                    _mm_aesenclast_si128(b[k], rk[AES128_ROUNDS]));
+    }
+    for (; i < blocks; ++i) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (src +
+                        i * AES_BLOCK_SIZE)), rk[0]);
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            b = _mm_aesenc_si128(b, rk[r]);
+        _mm_storeu_si128((__m128i *) (dest + i * AES_BLOCK_SIZE),
+                _mm_aesenclast_si128(b, rk[AES128_ROUNDS]));
+    }
+}
+
+// The decryption schedule is already in the form aesdec expects: reversed,
+// with InvMixColumns applied to the middle round keys
+
+__attribute__((target("aes,sse4.2")))
+static void aes128_decrypt_blocks_aesni(const struct aes128_schedule *ks,
+        const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+    __m128i rk[AES128_ROUNDS + 1];
+    for (size_t r = 0; r <= AES128_ROUNDS; ++r)
+        rk[r] = _mm_loadu_si128((const __m128i *) (ks->dec +
+                    r * AES_BLOCK_SIZE));
+    size_t i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        __m128i b[4];
+        for (size_t k = 0; k < 4; ++k)
+            b[k] = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (src +
+                            (i + k) * AES_BLOCK_SIZE)), rk[0]);
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            for (size_t k = 0; k < 4; ++k)
+                b[k] = _mm_aesdec_si128(b[k], rk[r]);
+        for (size_t k = 0; k < 4; ++k)
+            _mm_storeu_si128((__m128i *) (dest + (i + k) * AES_BLOCK_SIZE),
+                    _mm_aesdeclast_si128(b[k], rk[AES128_ROUNDS]));
+    }
+    for (; i < blocks; ++i) {
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *) (src +
+                        i * AES_BLOCK_SIZE)), rk[0]);
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            b = _mm_aesdec_si128(b, rk[r]);
+        _mm_storeu_si128((__m128i *) (dest + i * AES_BLOCK_SIZE),
+                _mm_aesdeclast_si128(b, rk[AES128_ROUNDS]));
+    }
+}
+
+// Unlike encryption, cbc decryption has no dependency between blocks beyond
+// the xor with the previous ciphertext, so it pipelines like ecb
+__attribute__((target("aes,sse4.2")))
+static void aes128_cbc_decrypt_aesni(const struct aes128_schedule *ks,
+        const uint8_t *iv, const uint8_t *src, uint8_t *dest, size_t blocks)
+{
+    __m128i rk[AES128_ROUNDS + 1];
+    for (size_t r = 0; r <= AES128_ROUNDS; ++r)
+        rk[r] = _mm_loadu_si128((const __m128i *) (ks->dec +
+                    r * AES_BLOCK_SIZE));
+    __m128i chain = _mm_loadu_si128((const __m128i *) iv);
+    size_t i = 0;
+    for (; i + 4 <= blocks; i += 4) {
+        // load every ciphertext block before storing, in case src == dest
+        __m128i c[4], b[4];
+        for (size_t k = 0; k < 4; ++k) {
+            c[k] = _mm_loadu_si128((const __m128i *) (src +
+                        (i + k) * AES_BLOCK_SIZE));
+            b[k] = _mm_xor_si128(c[k], rk[0]);
+        }
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            for (size_t k = 0; k < 4; ++k)
+                b[k] = _mm_aesdec_si128(b[k], rk[r]);
+        for (size_t k = 0; k < 4; ++k) {
+            b[k] = _mm_aesdeclast_si128(b[k], rk[AES128_ROUNDS]);
+            b[k] = _mm_xor_si128(b[k], k ? c[k - 1] : chain);
+            _mm_storeu_si128((__m128i *) (dest + (i + k) * AES_BLOCK_SIZE),
+                    b[k]);
+        }
+        chain = c[3];
+    }
+    for (; i < blocks; ++i) {
+        __m128i c = _mm_loadu_si128((const __m128i *) (src +
+                    i * AES_BLOCK_SIZE));
+        __m128i b = _mm_xor_si128(c, rk[0]);
+        for (size_t r = 1; r < AES128_ROUNDS; ++r)
+            b = _mm_aesdec_si128(b, rk[r]);
+        b = _mm_xor_si128(_mm_aesdeclast_si128(b, rk[AES128_ROUNDS]), chain);
+        _mm_storeu_si128((__m128i *) (dest + i * AES_BLOCK_SIZE), b);
+        chain = c;
+    }
+}
+
+// The trigram kernels widen each class to 32 bits, build the table indices
+// for 8 or 16 positions at once and gather their entries. A gather reads 4
+// bytes per index, so the entry is the low half, sign extended; lane sums
+// are moved to 64 bits before 2^15 entries could overflow them.
+
+__attribute__((target("avx2")))
+static int64_t trigram_sum_avx2(const uint8_t *classes, size_t len,
+        const int16_t *table)
+{
+    int64_t sum = 0;
+    size_t i = 0;
+    while (i + 10 <= len) {
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t n = 0; n < (1 << 15) && i + 10 <= len; ++n, i += 8) {
+            __m256i a = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                        (const __m128i *) (classes + i)));
+            __m256i b = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                        (const __m128i *) (classes + i + 1)));
+            __m256i c = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+                        (const __m128i *) (classes + i + 2)));
+            __m256i index = _mm256_or_si256(_mm256_or_si256(
+                        _mm256_slli_epi32(a, 10), _mm256_slli_epi32(b, 5)),
+                    c);
+            __m256i v = _mm256_i32gather_epi32((const int *) table, index, 2);
+            acc = _mm256_add_epi32(acc,
+                    _mm256_srai_epi32(_mm256_slli_epi32(v, 16), 16));
+        }
+        int32_t lanes[8];
+        _mm256_storeu_si256((__m256i *) lanes, acc);
+        for (size_t l = 0; l < 8; ++l)
+            sum += lanes[l];
+    }
+    return sum + trigram_sum_tail(classes + i, len - i, table);
+}
+
+__attribute__((target("avx512f")))
+static int64_t trigram_sum_avx512(const uint8_t *classes, size_t len,
+        const int16_t *table)
+{
+    int64_t sum = 0;
+    size_t i = 0;
+    while (i + 18 <= len) {
+        __m512i acc = _mm512_setzero_si512();
+        for (size_t n = 0; n < (1 << 15) && i + 18 <= len; ++n, i += 16) {
+            __m512i a = _mm512_cvtepu8_epi32(_mm_loadu_si128(
+                        (const __m128i *) (classes + i)));
+            __m512i b = _mm512_cvtepu8_epi32(_mm_loadu_si128(
+                        (const __m128i *) (classes + i + 1)));
+            __m512i c = _mm512_cvtepu8_epi32(_mm_loadu_si128(
+                        (const __m128i *) (classes + i + 2)));
+            __m512i index = _mm512_or_si512(_mm512_or_si512(
+                        _mm512_slli_epi32(a, 10), _mm512_slli_epi32(b, 5)),
+                    c);
+            __m512i v = _mm512_i32gather_epi32(index, table, 2);
+            acc = _mm512_add_epi32(acc,
+                    _mm512_srai_epi32(_mm512_slli_epi32(v, 16), 16));
+        }
+        int32_t lanes[16];
+        _mm512_storeu_si512(lanes, acc);
+        for (size_t l = 0; l < 16; ++l)
+            sum += lanes[l];
+    }
+    return sum + trigram_sum_tail(classes + i, len - i, table);
+}
+
+/*
+ * The trigrams starting in the last few positions, one at a time
+ */
+static int64_t trigram_sum_tail(const uint8_t *classes, size_t len,
+        const int16_t *table)
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i + 2 < len; ++i)
+        sum += table[(classes[i] << 10) | (classes[i + 1] << 5) |
+            classes[i + 2]];
+    return sum;
+}
+
+// Vectors a key of a given size cycles through before lining up with a
+// vector boundary again: size / gcd(size, width), for widths that are
+// powers of two
+#define KEY_XOR_LOW_BIT(size) ((size) & -(size))
+#define KEY_XOR_VECS(size, width) ((size) / \
+        (KEY_XOR_LOW_BIT(size) < (width) ? KEY_XOR_LOW_BIT(size) : (width)))
+
+// Apply X to each vector of a run, up to the longest (31 vectors). Lanes
+// past a kernel's run are compiled out, and all indices are constants, so
+// the run's vectors can live in registers.
+#define KEY_XOR_LANES(X) \
+    X(0) X(1) X(2) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12) \
+    X(13) X(14) X(15) X(16) X(17) X(18) X(19) X(20) X(21) X(22) X(23) \
+    X(24) X(25) X(26) X(27) X(28) X(29) X(30)
+#define KEY_XOR_LOAD_LANE(v) \
+    if ((v) < VECS) \
+        pattern[(v) % VECS] = KX_LOAD(run + (v) * KX_WIDTH);
+#define KEY_XOR_LANE(v) \
+    if ((v) < VECS) \
+        KX_STORE(dest + i + (v) * KX_WIDTH, KX_XOR(KX_LOAD(src + i + \
+                        (v) * KX_WIDTH), pattern[(v) % VECS]));
+
+/*
+ * Define the repeated key xor kernel for one key size, using the vector
+ * operations KX_LOAD, KX_STORE and KX_XOR on vectors of KX_WIDTH bytes. The
+ * key is laid out as the run of vectors it cycles through, which are loaded
+ * once; whole runs of text are xor'd with them, then single vectors, then
+ * the last bytes one at a time. Short texts only lay out as much of the run
+ * as they use.
+ */
+#define DEFINE_KEY_XOR(isa, target_isa, vec, size) \
+    __attribute__((target(target_isa))) \
+    static void key_xor_##isa##_##size(const uint8_t *key, \
+            const uint8_t *src, uint8_t *dest, size_t len) \
+    { \
+        enum { VECS = KEY_XOR_VECS(size, KX_WIDTH) }; \
+        uint8_t run[VECS * KX_WIDTH]; \
+        size_t needed = len < sizeof run ? len : sizeof run; \
+        for (size_t t = 0; t < needed; t += (size)) \
+            memcpy(run + t, key, (size)); \
+        size_t i = 0; \
+        if (len >= sizeof run) { \
+            vec pattern[VECS]; \
+            KEY_XOR_LANES(KEY_XOR_LOAD_LANE) \
+            for (; i + sizeof run <= len; i += sizeof run) { \
+                KEY_XOR_LANES(KEY_XOR_LANE) \
+            } \
+        } \
+        size_t t = 0; \
+        for (; i + KX_WIDTH <= len; i += KX_WIDTH, t += KX_WIDTH) \
+            KX_STORE(dest + i, KX_XOR(KX_LOAD(src + i), KX_LOAD(run + t))); \
+        for (; i < len; ++i, ++t) \
+            dest[i] = src[i] ^ run[t]; \
+    }
+
+#define KX_WIDTH 32
+#define KX_LOAD(p) _mm256_loadu_si256((const __m256i *) (p))
+#define KX_STORE(p, x) _mm256_storeu_si256((__m256i *) (p), (x))
+#define KX_XOR _mm256_xor_si256
+#define DEFINE_KEY_XOR_AVX2(size) DEFINE_KEY_XOR(avx2, "avx2", __m256i, size)
+KEY_XOR_SIZES(DEFINE_KEY_XOR_AVX2)
+#undef KX_WIDTH
+#undef KX_LOAD
+#undef KX_STORE
+#undef KX_XOR
+
+#define KX_WIDTH 64
+#define KX_LOAD _mm512_loadu_si512
+#define KX_STORE _mm512_storeu_si512
+#define KX_XOR _mm512_xor_si512
+#define DEFINE_KEY_XOR_AVX512(size) \
+    DEFINE_KEY_XOR(avx512, "avx512f", __m512i, size)
+KEY_XOR_SIZES(DEFINE_KEY_XOR_AVX512)
+#undef KX_WIDTH
+#undef KX_LOAD
+#undef KX_STORE
+#undef KX_XOR
+
+#endif  // HAVE_X86_KERNELS
@@ -0,0 +1,128 @@
+/*
+ * cpu_dispatch.h
+ * Runtime selection of SIMD kernels. The cpu is probed once, on first use, and
+ * each accelerated operation is bound to the best kernel the cpu supports.
+ * Library functions call through the kernel table and fall back to their
+ * portable code where no kernel is bound.
+ *
+ * Setting MATASANO_CPU_LEVEL to scalar, sse4.2, avx2 or avx512 caps the level
+ * used (it never goes above what the cpu supports), for testing and
+ * benchmarking each code path.
+ */
+
+#ifndef ___cpu_dispatch_h___
+#define ___cpu_dispatch_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cipher.h"
+
+#define CPU_LEVEL_ENV "MATASANO_CPU_LEVEL"
+
+// Key sizes with repeated key xor kernels of their own: 1 to
+// KEY_XOR_SMALL_MAX, then 64, 128 and 256
+#define KEY_XOR_SMALL_MAX 32
+#define KEY_XOR_KERNELS (KEY_XOR_SMALL_MAX + 3)
+
+enum cpu_level {
+    CPU_LEVEL_SCALAR,       // portable C only
+    CPU_LEVEL_SSE42,        // SSE4.2, POPCNT and AES-NI where present
+    CPU_LEVEL_AVX2,
+    CPU_LEVEL_AVX512,       // AVX-512F and AVX-512BW
+};
+
+// Accelerated kernels; a NULL entry means the portable code is used
+struct cpu_kernels {
+    // dest = a ^ b; dest may alias either input
+    void (*xor_bytes)(uint8_t *dest, const uint8_t *a, const uint8_t *b,
+            size_t len);
+    // number of bits that differ between a and b
+    uint64_t (*popcount_xor)(const uint8_t *a, const uint8_t *b, size_t len);
+    // decode hex pairs from the start of src until one is invalid; returns
+    // the number of characters decoded, which is always even
+    size_t (*hex_decode)(uint8_t *dest, const char *src, size_t len);
+    // AES-128 on whole blocks; dest may alias src
+    void (*aes128_encrypt_blocks)(const struct aes128_schedule *ks,
+            const uint8_t *src, uint8_t *dest, size_t blocks);
+    void (*aes128_decrypt_blocks)(const struct aes128_schedule *ks,
+            const uint8_t *src, uint8_t *dest, size_t blocks);
+    void (*aes128_cbc_decrypt)(const struct aes128_schedule *ks,
+            const uint8_t *iv, const uint8_t *src, uint8_t *dest,
+            size_t blocks);
+    // sum of table[(c[i] << 10) | (c[i + 1] << 5) | c[i + 2]] over every
+    // i + 2 < len, for classes c[i] < 32 and a table with an entry of
+    // padding after the last index
+    int64_t (*trigram_sum)(const uint8_t *classes, size_t len,
+            const int16_t *table);
+    // dest = src ^ key repeated, for the key size of each slot (see
+    // key_xor_slot); dest may alias src
+    void (*key_xor[KEY_XOR_KERNELS])(const uint8_t *key, const uint8_t *src,
+            uint8_t *dest, size_t len);
+    // out[r * stride + j] = number of bits that differ between row r of a
+    // and column j of panel, for r < rows and j < cols. Each row of a is
+    // words 64-bit words; the panel holds word w of column j at
+    // panel[w * cols + j], and cols is a multiple of 8.
+    void (*hamming_panel)(const uint64_t *a, size_t rows,
+            const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+            size_t stride);
+};
+
+// What the dispatcher found and chose, for logs and benchmarks
+struct cpu_dispatch_info {
+    enum cpu_level detected;    // best level the cpu supports
+    enum cpu_level active;      // level kernels are bound for
+    int aesni;                  // AES-NI kernels are bound
+    const char *xor_kernel;     // names of the bound kernels
+    const char *popcount_kernel;
+    const char *hex_kernel;
+    const char *aes_kernel;
+    const char *trigram_kernel;
+    const char *key_xor_kernel;
+    const char *hamming_kernel;
+};
+
+/*
+ * Find the key_xor slot for a key size
+ * @return the slot, or KEY_XOR_KERNELS if the size has no kernel
+ */
+static inline size_t key_xor_slot(size_t key_size)
+{
+    if (key_size >= 1 && key_size <= KEY_XOR_SMALL_MAX)
+        return key_size - 1;
+    switch (key_size) {
+    case 64:
+        return KEY_XOR_SMALL_MAX;
+    case 128:
+        return KEY_XOR_SMALL_MAX + 1;
+    case 256:
+        return KEY_XOR_SMALL_MAX + 2;
+    }
+    return KEY_XOR_KERNELS;
+}
+
+/*
+ * Get the kernel table, probing the cpu on the first call
+ */
+const struct cpu_kernels *cpu_kernels(void);
+
+/*
+ * Rebind every kernel for a given level, capped at what the cpu supports.
+ * Not safe to call while other threads are using the library.
+ * @param level level to use
+ * @return the level actually bound
+ */
+enum cpu_level cpu_dispatch_set_level(enum cpu_level level);
+
+/*
+ * Describe the detected cpu and the bound kernels
+ * @param out pointer to info struct to fill in
+ */
+void cpu_dispatch_get_info(struct cpu_dispatch_info *out);
+
+/*
+ * Name of a level, as accepted in MATASANO_CPU_LEVEL
+ */
+const char *cpu_level_name(enum cpu_level level);
+
+#endif  // ___cpu_dispatch_h___
@@ -0,0 +1,278 @@
+/*
+ * ecb_attack.c
+ * Byte-at-a-time decryption of a secret that an ecb encryption oracle appends
+ * to attacker-controlled input, i.e. an oracle computing
+ *     E(key, prefix || input || secret)
+ * for an unknown key, an unknown (but fixed) prefix and an unknown secret.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecb_attack.h"
+
+#define MAX_BLOCK_SIZE 64
+#define DICT_SIZE 256
+#define TABLE_SLOTS 512     // power of 2, at least twice DICT_SIZE
+
+// filler bytes for the attacker-controlled input
+#define ALIGN_FILL 'X'
+#define FILL_A 'A'
+#define FILL_B 'B'
+
+// Working state for one run of the attack
+struct attack {
+    const struct ecb_oracle *oracle;
+    uint8_t *in;
+    size_t in_size;
+    uint8_t *out;
+    size_t out_size;
+    size_t calls;
+};
+
+// Private functions
+static size_t query(struct attack *a, size_t len);
+static size_t find_block_size(struct attack *a, size_t *fixed_len);
+static size_t find_prefix_len(struct attack *a, size_t block_size);
+static int recover_byte(struct attack *a, size_t block_size,
+        size_t prefix_len, uint8_t *recovered, size_t i);
+static size_t block_slot(const uint8_t *block, size_t block_size);
+
+/*
+ * Set up an in-process aes oracle. The prefix and secret are not copied.
+ * @param o oracle to initialize
+ * @param key raw AES-128 key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ * @param prefix bytes to put before the attacker's input; may be NULL if
+ *        prefix_len is 0
+ * @param secret bytes to put after the attacker's input
+ */
+void aes_ecb_oracle_init(struct aes_ecb_oracle *o, const uint8_t *key,
+        const uint8_t *prefix, size_t prefix_len, const uint8_t *secret,
+        size_t secret_len)
+{
+    if (!o || !key)
+        return;
+    aes128_expand_key(&o->ks, key);
+    o->prefix = prefix;
+    o->prefix_len = prefix ? prefix_len : 0;
+    o->secret = secret;
+    o->secret_len = secret ? secret_len : 0;
+}
+
+/*
+ * ecb_oracle_fn for an aes_ecb_oracle, passed as ctx
+ */
+size_t aes_ecb_oracle_encrypt(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size)
+{
+    const struct aes_ecb_oracle *o = ctx;
+    if (!o || (!input && len != 0))
+        return 0;
+    size_t total = o->prefix_len + len + o->secret_len;
+    size_t padded = total + AES_BLOCK_SIZE - total % AES_BLOCK_SIZE;
+    if (!out || padded > out_size)
+        return padded;
+    if (o->prefix_len)
+        memcpy(out, o->prefix, o->prefix_len);
+    if (len)
+        memcpy(out + o->prefix_len, input, len);
+    if (o->secret_len)
+        memcpy(out + o->prefix_len + len, o->secret, o->secret_len);
+    pkcs7_pad(out, total, AES_BLOCK_SIZE);
+    aes128_ecb_encrypt(&o->ks, out, out, padded);
+    return padded;
+}
+
+/*
+ * Recover the secret appended by an ecb oracle. The block size and prefix
+ * length are found first; after that every byte costs one oracle call, which
+ * carries the whole 256-entry dictionary for that byte along with the probe.
+ * @param oracle oracle to attack
+ * @param dest buffer to write the recovered secret to
+ * @param dest_size size of dest; at most this many bytes are recovered
+ * @param stats pointer to stats struct to fill in; may be NULL
+ * @return number of bytes of the secret written to dest, or 0 if the oracle
+ *         does not look like an ecb oracle
+ */
+size_t ecb_decrypt_appended_secret(const struct ecb_oracle *oracle,
+        uint8_t *dest, size_t dest_size, struct ecb_attack_stats *stats)
+{
+    if (!oracle || !oracle->encrypt || !dest)
+        return 0;
+    struct attack a = { oracle, NULL, 0, NULL, 0, 0 };
+    // enough for the alignment bytes, the dictionary and the probe
+    a.in_size = (DICT_SIZE + 4) * MAX_BLOCK_SIZE;
+    a.in = malloc(a.in_size);
+    size_t recovered = 0;
+    size_t block_size = 0, prefix_len = SIZE_MAX, fixed_len = 0;
+    if (a.in && (block_size = find_block_size(&a, &fixed_len)) != 0)
+        prefix_len = find_prefix_len(&a, block_size);
+    if (prefix_len <= fixed_len) {
+        size_t secret_len = fixed_len - prefix_len;
+        size_t want = secret_len < dest_size ? secret_len : dest_size;
+        while (recovered < want &&
+                recover_byte(&a, block_size, prefix_len, dest, recovered))
+            ++recovered;
+    }
+    if (stats) {
+        stats->block_size = block_size;
+        int found = prefix_len <= fixed_len;
+        stats->prefix_len = found ? prefix_len : 0;
+        stats->secret_len = found ? fixed_len - prefix_len : 0;
+        stats->oracle_calls = a.calls;
+    }
+    free(a.in);
+    free(a.out);
+    return recovered;
+}
+
+/*
+ * Run the first len bytes of the input buffer through the oracle, growing the
+ * output buffer as needed
+ * @return length of the ciphertext in a->out, or 0 on failure
+ */
+static size_t query(struct attack *a, size_t len)
+{
+    for (;;) {
+        size_t n = a->oracle->encrypt(a->oracle->ctx, a->in, len, a->out,
+                a->out_size);
+        ++a->calls;
+        if (n <= a->out_size)
+            return n;
+        uint8_t *bigger = realloc(a->out, n);
+        if (!bigger)
+            return 0;
+        a->out = bigger;
+        a->out_size = n;
+    }
+}
+
+/*
+ * Find the block size by growing the input until the ciphertext grows
+ * @param fixed_len output for the combined length of the prefix and secret
+ * @return the block size, or 0 if the ciphertext never grew or grew by more
+ *         than MAX_BLOCK_SIZE
+ */
+static size_t find_block_size(struct attack *a, size_t *fixed_len)
+{
+    size_t base = query(a, 0);
+    if (base == 0)
+        return 0;
+    memset(a->in, FILL_A, MAX_BLOCK_SIZE);
+    for (size_t n = 1; n <= MAX_BLOCK_SIZE; ++n) {
+        size_t len = query(a, n);
+        if (len > base) {
+            // larger blocks would overrun the buffers sized for the largest
+            if (len - base > MAX_BLOCK_SIZE)
+                return 0;
+            // the padding just spilled into a new block, so prefix, input
+            // and secret exactly filled the old ciphertext
+            *fixed_len = base - n;
+            return len - base;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Find the prefix length. Prepend k alignment bytes to two blocks of 'A's and
+ * two blocks of 'B's; the smallest k that gives two identical adjacent pairs
+ * puts the end of the alignment bytes on a block boundary. Requiring both
+ * pairs rules out a prefix that happens to end in filler bytes.
+ * @return the prefix length, or SIZE_MAX if it could not be found
+ */
+static size_t find_prefix_len(struct attack *a, size_t block_size)
+{
+    for (size_t k = 0; k < block_size; ++k) {
+        memset(a->in, ALIGN_FILL, k);
+        memset(a->in + k, FILL_A, 2 * block_size);
+        memset(a->in + k + 2 * block_size, FILL_B, 2 * block_size);
+        size_t len = query(a, k + 4 * block_size);
+        size_t blocks = len / block_size;
+        size_t j = 0;
+        while ((j = find_adjacent_repeated_blocks(a->out, len, block_size,
+                        j)) != SIZE_MAX) {
+            const uint8_t *first = a->out + j * block_size;
+            if (j + 3 < blocks && j * block_size >= k &&
+                    memcmp(first + 2 * block_size, first + 3 * block_size,
+                        block_size) == 0 &&
+                    memcmp(first, first + 2 * block_size, block_size) != 0)
+                return j * block_size - k;
+            ++j;
+        }
+    }
+    return SIZE_MAX;
+}
+
+/*
+ * Recover byte i of the secret with a single oracle call. The input is laid
+ * out as
+ *     alignment | 256 dictionary blocks | probe
+ * where dictionary block g is the last block_size - 1 known plaintext bytes
+ * followed by g, and the probe shifts secret byte i to the end of a block
+ * whose first block_size - 1 bytes are those same known bytes.
+ * @param recovered secret bytes found so far; byte i is written here
+ * @return 1 if the byte was found, otherwise 0
+ */
+static int recover_byte(struct attack *a, size_t block_size,
+        size_t prefix_len, uint8_t *recovered, size_t i)
+{
+    size_t align = (block_size - prefix_len % block_size) % block_size;
+    size_t first_dict = (prefix_len + align) / block_size;
+    size_t probe = block_size - 1 - i % block_size;
+
+    // known plaintext window: 'A's followed by the recovered bytes
+    uint8_t window[MAX_BLOCK_SIZE];
+    size_t known = i < block_size - 1 ? i : block_size - 1;
+    memset(window, FILL_A, block_size - 1 - known);
+    memcpy(window + block_size - 1 - known, recovered + i - known, known);
+
+    uint8_t *p = a->in;
+    memset(p, ALIGN_FILL, align);
+    p += align;
+    for (size_t g = 0; g < DICT_SIZE; ++g) {
+        memcpy(p, window, block_size - 1);
+        p[block_size - 1] = (uint8_t) g;
+        p += block_size;
+    }
+    memset(p, FILL_A, probe);
+    p += probe;
+
+    size_t len = query(a, (size_t) (p - a->in));
+    size_t target = first_dict + DICT_SIZE + (probe + i) / block_size;
+    if ((target + 1) * block_size > len)
+        return 0;
+
+    // index the dictionary ciphertexts by block, then look up the target
+    uint16_t table[TABLE_SLOTS] = { 0 };    // guess + 1, 0 if empty
+    const uint8_t *dict = a->out + first_dict * block_size;
+    for (size_t g = 0; g < DICT_SIZE; ++g) {
+        size_t slot = block_slot(dict + g * block_size, block_size);
+        while (table[slot])
+            slot = (slot + 1) & (TABLE_SLOTS - 1);
+        table[slot] = (uint16_t) (g + 1);
+    }
+    const uint8_t *wanted = a->out + target * block_size;
+    for (size_t slot = block_slot(wanted, block_size); table[slot];
+            slot = (slot + 1) & (TABLE_SLOTS - 1)) {
+        size_t g = table[slot] - 1u;
+        if (memcmp(dict + g * block_size, wanted, block_size) == 0) {
+            recovered[i] = (uint8_t) g;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Hash table slot for a ciphertext block. Ciphertext is already uniformly
+ * distributed, so its first bytes make a good enough hash.
+ */
+static size_t block_slot(const uint8_t *block, size_t block_size)
+{
+    uint64_t h = 0;
+    memcpy(&h, block, block_size < sizeof h ? block_size : sizeof h);
+    h ^= h >> 29;
+    return (size_t) (h & (TABLE_SLOTS - 1));
+}
@@ -0,0 +1,80 @@
+/*
+ * ecb_attack.h
+ * Byte-at-a-time decryption of a secret that an ecb encryption oracle appends
+ * to attacker-controlled input, i.e. an oracle computing
+ *     E(key, prefix || input || secret)
+ * for an unknown key, an unknown (but fixed) prefix and an unknown secret.
+ */
+
+#ifndef ___ecb_attack_h___
+#define ___ecb_attack_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cipher.h"
+
+/*
+ * An encryption oracle. Writes the ciphertext for the given input to out and
+ * returns its length. If the ciphertext is longer than out_size, nothing is
+ * written and the required length is returned instead.
+ */
+typedef size_t (*ecb_oracle_fn)(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size);
+
+struct ecb_oracle {
+    ecb_oracle_fn encrypt;
+    void *ctx;
+};
+
+// What the attack learned about the oracle, and what it cost
+struct ecb_attack_stats {
+    size_t block_size;
+    size_t prefix_len;
+    size_t secret_len;
+    size_t oracle_calls;
+};
+
+// In-process stand-in for a remote oracle: AES-128-ECB with PKCS#7 padding
+struct aes_ecb_oracle {
+    struct aes128_schedule ks;
+    const uint8_t *prefix;
+    size_t prefix_len;
+    const uint8_t *secret;
+    size_t secret_len;
+};
+
+/*
+ * Set up an in-process aes oracle. The prefix and secret are not copied.
+ * @param o oracle to initialize
+ * @param key raw AES-128 key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ * @param prefix bytes to put before the attacker's input; may be NULL if
+ *        prefix_len is 0
+ * @param secret bytes to put after the attacker's input
+ */
+void aes_ecb_oracle_init(struct aes_ecb_oracle *o, const uint8_t *key,
+        const uint8_t *prefix, size_t prefix_len, const uint8_t *secret,
+        size_t secret_len);
+
+/*
+ * ecb_oracle_fn for an aes_ecb_oracle, passed as ctx
+ */
+size_t aes_ecb_oracle_encrypt(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size);
+
+/*
+ * Recover the secret appended by an ecb oracle. The block size and prefix
+ * length are found first; after that every byte costs one oracle call, which
+ * carries the whole 256-entry dictionary for that byte along with the probe.
+ * @param oracle oracle to attack
+ * @param dest buffer to write the recovered secret to
+ * @param dest_size size of dest; at most this many bytes are recovered
+ * @param stats pointer to stats struct to fill in; may be NULL
+ * @return number of bytes of the secret written to dest, or 0 if the oracle
+ *         does not look like an ecb oracle
+ */
+size_t ecb_decrypt_appended_secret(const struct ecb_oracle *oracle,
+        uint8_t *dest, size_t dest_size, struct ecb_attack_stats *stats);
+
+#endif  // ___ecb_attack_h___
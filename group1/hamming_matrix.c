@@ -0,0 +1,288 @@
+/*
+ * hamming_matrix.c
+ * Hamming distances between every pair of blocks from two sets. Blocks are
+ * packed into zero padded 64-bit words. The second set is laid out word by
+ * word in panels of columns, small enough to stay in L1 cache, and each task
+ * runs a tile of rows of the first set against every panel in turn, with the
+ * panel kernel keeping a grid of distances in registers. Comparing a set with
+ * itself only runs the tiles that reach above the diagonal.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "hamming_matrix.h"
+#include "arena.h"
+#include "cpu_dispatch.h"
+#include "thread_pool.h"
+
+// Bytes of packed words per panel
+#define PANEL_BYTES (16 * 1024)
+// Most columns per panel, a multiple of 8, and rows of the first set per
+// tile: the tile's distances take 32 KiB, so they stay in L1 cache too
+#define PANEL_COLS_MAX 128
+#define ROW_TILE 64
+
+struct hamming_job {
+    const uint64_t *rows;       // first set, words per block
+    size_t num_rows;
+    const uint64_t *panels;     // second set, panel after panel
+    size_t num_cols;
+    size_t words;
+    size_t panel_cols;          // columns in every panel but the last
+    int upper;                  // the sets are the same
+    hamming_tile_fn visit;
+    void *arg;
+    int failed;                 // set atomically if a tile was skipped
+};
+
+// Where hamming_matrix writes a tile to
+struct matrix_out {
+    void *out;
+    size_t num_cols;
+    enum hamming_width width;
+    int upper;
+};
+
+// Private functions
+static void pack_rows(uint64_t *dest, const uint8_t *src, size_t num,
+        size_t block_size, size_t words);
+static void pack_panels(uint64_t *dest, const uint8_t *src, size_t num,
+        size_t block_size, size_t words, size_t panel_cols);
+static size_t padded_cols(size_t cols);
+static void hamming_tiles(void *arg, size_t begin, size_t end);
+static void hamming_panel_scalar(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride);
+static uint32_t count_bits(uint64_t x);
+static void store_tile(void *arg, size_t row, size_t col, size_t rows,
+        size_t cols, const uint32_t *dist, size_t stride);
+static void store_distance(const struct matrix_out *m, size_t i, size_t j,
+        uint32_t d);
+
+/*
+ * Compute the distance between every block of a and every block of b, and
+ * hand them to a function a tile at a time
+ * @param a first set of blocks
+ * @param num_a number of blocks in a
+ * @param b second set of blocks, or NULL to compare a with itself
+ * @param num_b number of blocks in b; ignored if b is NULL
+ * @param block_size size of each block in bytes
+ * @param visit function to call with each tile
+ * @param arg argument to pass to visit
+ * @return 0 on success, or -1 on bad arguments or if memory runs out
+ */
+int hamming_matrix_tiles(const uint8_t *a, size_t num_a, const uint8_t *b,
+        size_t num_b, size_t block_size, hamming_tile_fn visit, void *arg)
+{
+    if (!a || block_size == 0 || !visit)
+        return -1;
+    int upper = b == NULL;
+    if (upper) {
+        b = a;
+        num_b = num_a;
+    }
+    if (num_a == 0 || num_b == 0)
+        return 0;
+    size_t words = (block_size + 7) / 8;
+    size_t panel_cols = PANEL_BYTES / (8 * words) / 8 * 8;
+    if (panel_cols == 0)
+        panel_cols = 8;
+    if (panel_cols > PANEL_COLS_MAX)
+        panel_cols = PANEL_COLS_MAX;
+    size_t num_panels = (num_b + panel_cols - 1) / panel_cols;
+    size_t panel_words = (num_panels - 1) * panel_cols +
+        padded_cols(num_b - (num_panels - 1) * panel_cols);
+    uint64_t *rows = malloc(num_a * words * sizeof *rows);
+    uint64_t *panels = calloc(panel_words * words, sizeof *panels);
+    if (!rows || !panels) {
+        free(rows);
+        free(panels);
+        return -1;
+    }
+    pack_rows(rows, a, num_a, block_size, words);
+    pack_panels(panels, b, num_b, block_size, words, panel_cols);
+    struct hamming_job job = { rows, num_a, panels, num_b, words, panel_cols,
+        upper, visit, arg, 0 };
+    // the tiles of the top rows have the most panels to the right of the
+    // diagonal; they go first, while the chunks handed out are large
+    thread_pool_parallel_for(NULL, 0, (num_a + ROW_TILE - 1) / ROW_TILE, 1,
+            thread_pool_batch_limit(), hamming_tiles, &job);
+    free(rows);
+    free(panels);
+    return __atomic_load_n(&job.failed, __ATOMIC_RELAXED) ? -1 : 0;
+}
+
+/*
+ * Compute the distance between every block of a and every block of b
+ * @param a first set of blocks
+ * @param num_a number of blocks in a
+ * @param b second set of blocks, or NULL to compare a with itself
+ * @param num_b number of blocks in b; ignored if b is NULL
+ * @param block_size size of each block in bytes
+ * @param width element type of out
+ * @param out output for the matrix, row by row
+ * @return 0 on success, or -1 on bad arguments, if the distances may not fit
+ *         in width, or if memory runs out
+ */
+int hamming_matrix(const uint8_t *a, size_t num_a, const uint8_t *b,
+        size_t num_b, size_t block_size, enum hamming_width width, void *out)
+{
+    if (!out || (width != HAMMING_U16 && width != HAMMING_U32) ||
+            (width == HAMMING_U16 && block_size > HAMMING_U16_MAX_BLOCK))
+        return -1;
+    struct matrix_out m = { out, b ? num_b : num_a, width, b == NULL };
+    if (hamming_matrix_tiles(a, num_a, b, num_b, block_size, store_tile,
+                &m) != 0)
+        return -1;
+    if (m.upper)
+        for (size_t i = 0; i < num_a; ++i)
+            store_distance(&m, i, i, 0);
+    return 0;
+}
+
+/*
+ * Copy blocks into rows of zero padded words
+ */
+static void pack_rows(uint64_t *dest, const uint8_t *src, size_t num,
+        size_t block_size, size_t words)
+{
+    for (size_t i = 0; i < num; ++i) {
+        uint64_t *row = dest + i * words;
+        row[words - 1] = 0;
+        memcpy(row, src + i * block_size, block_size);
+    }
+}
+
+/*
+ * Copy blocks into panels of panel_cols columns, each stored word by word;
+ * the last panel is padded with zero columns to a multiple of 8
+ * @param dest output, zeroed
+ */
+static void pack_panels(uint64_t *dest, const uint8_t *src, size_t num,
+        size_t block_size, size_t words, size_t panel_cols)
+{
+    for (size_t start = 0; start < num; start += panel_cols) {
+        size_t count = num - start < panel_cols ? num - start : panel_cols;
+        size_t cols = padded_cols(count);
+        uint64_t *panel = dest + start * words;
+        for (size_t j = 0; j < count; ++j) {
+            const uint8_t *block = src + (start + j) * block_size;
+            for (size_t w = 0; w < words; ++w) {
+                size_t n = block_size - 8 * w < 8 ? block_size - 8 * w : 8;
+                memcpy(&panel[w * cols + j], block + 8 * w, n);
+            }
+        }
+    }
+}
+
+/*
+ * Round a number of columns up to a multiple of 8
+ */
+static size_t padded_cols(size_t cols)
+{
+    return (cols + 7) / 8 * 8;
+}
+
+/*
+ * Compute and visit the tiles of a range of row tiles
+ * @param arg the hamming_job
+ */
+static void hamming_tiles(void *arg, size_t begin, size_t end)
+{
+    struct hamming_job *job = arg;
+    void (*panel_kernel)(const uint64_t *, size_t, const uint64_t *, size_t,
+            size_t, uint32_t *, size_t) = cpu_kernels()->hamming_panel;
+    if (!panel_kernel)
+        panel_kernel = hamming_panel_scalar;
+    struct arena *arena = arena_thread();
+    struct arena_mark mark;
+    uint32_t *dist = NULL;
+    if (arena) {
+        mark = arena_get_mark(arena);
+        dist = arena_alloc(arena, ROW_TILE * job->panel_cols * sizeof *dist);
+    }
+    if (!dist) {
+        if (arena)
+            arena_reset(arena, mark);
+        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    for (size_t t = begin; t < end; ++t) {
+        size_t row = t * ROW_TILE;
+        size_t rows = job->num_rows - row < ROW_TILE ? job->num_rows - row :
+            ROW_TILE;
+        // with the sets the same, a pair i < j needs j > row
+        size_t first = job->upper ? (row + 1) / job->panel_cols *
+            job->panel_cols : 0;
+        for (size_t col = first; col < job->num_cols;
+                col += job->panel_cols) {
+            size_t count = job->num_cols - col < job->panel_cols ?
+                job->num_cols - col : job->panel_cols;
+            size_t cols = padded_cols(count);
+            panel_kernel(job->rows + row * job->words, rows,
+                    job->panels + col * job->words, cols, job->words, dist,
+                    cols);
+            job->visit(job->arg, row, col, rows, count, dist, cols);
+        }
+    }
+    arena_reset(arena, mark);
+}
+
+/*
+ * Portable hamming_panel kernel
+ */
+static void hamming_panel_scalar(const uint64_t *a, size_t rows,
+        const uint64_t *panel, size_t cols, size_t words, uint32_t *out,
+        size_t stride)
+{
+    for (size_t r = 0; r < rows; ++r) {
+        uint32_t *d = out + r * stride;
+        memset(d, 0, cols * sizeof *d);
+        for (size_t w = 0; w < words; ++w)
+            for (size_t j = 0; j < cols; ++j)
+                d[j] += count_bits(a[r * words + w] ^ panel[w * cols + j]);
+    }
+}
+
+/*
+ * Count the bits set in a word
+ */
+static uint32_t count_bits(uint64_t x)
+{
+    x -= (x >> 1) & 0x5555555555555555ULL;
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (uint32_t) ((x * 0x0101010101010101ULL) >> 56);
+}
+
+/*
+ * Write a tile into the matrix, and its mirror image if the sets are the
+ * same
+ * @param arg the matrix_out
+ */
+static void store_tile(void *arg, size_t row, size_t col, size_t rows,
+        size_t cols, const uint32_t *dist, size_t stride)
+{
+    const struct matrix_out *m = arg;
+    for (size_t i = 0; i < rows; ++i)
+        for (size_t j = 0; j < cols; ++j) {
+            if (m->upper && col + j <= row + i)
+                continue;
+            store_distance(m, row + i, col + j, dist[i * stride + j]);
+            if (m->upper)
+                store_distance(m, col + j, row + i, dist[i * stride + j]);
+        }
+}
+
+/*
+ * Write one entry of the matrix
+ */
+static void store_distance(const struct matrix_out *m, size_t i, size_t j,
+        uint32_t d)
+{
+    if (m->width == HAMMING_U16)
+        ((uint16_t *) m->out)[i * m->num_cols + j] = (uint16_t) d;
+    else
+        ((uint32_t *) m->out)[i * m->num_cols + j] = d;
+}
@@ -0,0 +1,78 @@
+/*
+ * hamming_matrix.h
+ * Hamming distances between every pair of blocks from two sets of equal
+ * sized blocks, or from one set and itself. Key size analysis, block
+ * clustering and finding similar ECB blocks all compare many blocks; these
+ * functions compare them a tile at a time, with the tiles shared out over
+ * the thread pool, so that each block is packed and loaded once per tile
+ * rather than once per pair.
+ */
+
+#ifndef ___hamming_matrix_h___
+#define ___hamming_matrix_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Element type of a distance matrix
+enum hamming_width {
+    HAMMING_U16,    // uint16_t, for blocks of up to HAMMING_U16_MAX_BLOCK
+    HAMMING_U32,    // uint32_t
+};
+
+// Largest block size whose distances always fit in 16 bits
+#define HAMMING_U16_MAX_BLOCK (UINT16_MAX / 8)
+
+/*
+ * Visit one tile of distances
+ * @param arg argument given to hamming_matrix_tiles
+ * @param row index of the tile's first block from the first set
+ * @param col index of the tile's first block from the second set
+ * @param rows number of blocks from the first set in the tile
+ * @param cols number of blocks from the second set in the tile
+ * @param dist dist[i * stride + j] is the distance between blocks row + i
+ *        and col + j, for i < rows and j < cols; only valid during the call
+ * @param stride distance between rows of dist
+ */
+typedef void (*hamming_tile_fn)(void *arg, size_t row, size_t col,
+        size_t rows, size_t cols, const uint32_t *dist, size_t stride);
+
+/*
+ * Compute the distance between every block of a and every block of b, and
+ * hand them to a function a tile at a time. Tiles are visited on several
+ * threads at once, in no particular order. With b NULL, a is compared with
+ * itself: only tiles that hold some pair of blocks i < j are visited, and
+ * each such pair is in exactly one of them; entries of those tiles with
+ * j <= i are to be ignored.
+ * @param a first set of blocks, one after another
+ * @param num_a number of blocks in a
+ * @param b second set of blocks, or NULL to compare a with itself
+ * @param num_b number of blocks in b; ignored if b is NULL
+ * @param block_size size of each block in bytes
+ * @param visit function to call with each tile
+ * @param arg argument to pass to visit
+ * @return 0 on success, or -1 on bad arguments or if memory runs out, in
+ *         which case some tiles may not have been visited
+ */
+int hamming_matrix_tiles(const uint8_t *a, size_t num_a, const uint8_t *b,
+        size_t num_b, size_t block_size, hamming_tile_fn visit, void *arg);
+
+/*
+ * Compute the distance between every block of a and every block of b
+ * @param a first set of blocks, one after another
+ * @param num_a number of blocks in a
+ * @param b second set of blocks, or NULL to compare a with itself, which
+ *        computes each distance once and mirrors it
+ * @param num_b number of blocks in b; ignored if b is NULL
+ * @param block_size size of each block in bytes
+ * @param width element type of out
+ * @param out output for the num_a by num_b (or num_a by num_a) matrix, row
+ *        by row; out[i * num_b + j] is the distance between a's block i and
+ *        b's block j
+ * @return 0 on success, or -1 on bad arguments, if width is HAMMING_U16 and
+ *         block_size > HAMMING_U16_MAX_BLOCK, or if memory runs out
+ */
+int hamming_matrix(const uint8_t *a, size_t num_a, const uint8_t *b,
+        size_t num_b, size_t block_size, enum hamming_width width, void *out);
+
+#endif  // ___hamming_matrix_h___
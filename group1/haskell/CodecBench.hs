@@ -0,0 +1,40 @@
+-- Criterion benchmarks of the ByteString codecs in Convert against the list
+-- ones, on aes_ecb_enc64.txt repeated to about a megabyte. Run with
+-- `make haskell-bench`, which passes +RTS -s so the allocation per run of the
+-- streaming decoder can be read off the totals.
+module Main where
+
+import Criterion.Main
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Char8 as C
+import qualified Data.ByteString.Lazy as L
+import System.Directory (getTemporaryDirectory)
+import System.FilePath ((</>))
+
+import Convert
+
+main :: IO ()
+main = do
+    text <- B.readFile "aes_ecb_enc64.txt"
+    tmp <- getTemporaryDirectory
+    let big = B.concat (replicate (2 ^ 20 `div` B.length text + 1) text)
+        joined = B.concat (C.lines big)
+        raw = maybe B.empty id (decodeBase64 big)
+        path = tmp </> "codec-bench.txt"
+    B.writeFile path big
+    defaultMain
+        [ bgroup "decodeBase64"
+            [ bench "list" $ nf readBase64 (C.unpack joined)
+            , bench "strict" $ nf decodeBase64 big
+            , bench "lazy" $ nf decodeBase64Lazy (L.fromStrict big)
+            , bench "file" $ nfIO (decodeBase64File path (const (return ())))
+            ]
+        , bgroup "encodeBase64"
+            [ bench "list" $ nf showBase64 (B.unpack raw)
+            , bench "strict" $ nf encodeBase64 raw
+            ]
+        , bgroup "base16"
+            [ bench "list" $ nf (readBase16 . showBase16) (B.unpack raw)
+            , bench "strict" $ nf (decodeBase16 . encodeBase16) raw
+            ]
+        ]
@@ -1,3 +1,4 @@
+{-# LANGUAGE BangPatterns #-}
 module Convert
 ( rawToString
 , stringToWord8
@@ -5,6 +6,22 @@ module Convert
 , showBase16
 , readBase64
 , showBase64
+-- ByteString codecs
+, encodeBase16
+, encodeBase16Lazy
+, encodeBase64
+, encodeBase64Lazy
+, base64Builder
+, decodeBase16
+, decodeBase16Lazy
+, decodeBase64
+, decodeBase64Lazy
+-- streaming base 64 decoding
+, Base64Decoder
+, base64Decoder
+, base64DecodeChunk
+, base64DecodeFinal
+, decodeBase64File
 ) where
 
 import Data.Word
@@ -13,6 +30,19 @@ import Data.Char
 import Data.List.Split
 import Data.List
 import Control.Monad
+import Data.ByteString (ByteString)
+import qualified Data.ByteString as B
+import Data.ByteString.Builder (Builder)
+import qualified Data.ByteString.Builder as BB
+import qualified Data.ByteString.Builder.Prim as BP
+import qualified Data.ByteString.Internal as BI
+import qualified Data.ByteString.Lazy as L
+import qualified Data.ByteString.Unsafe as BU
+import qualified Data.Vector.Unboxed as U
+import Foreign.Ptr (Ptr)
+import Foreign.Storable (pokeByteOff)
+import System.IO
+import System.IO.Unsafe (unsafeDupablePerformIO)
 
 rawToString :: [Word8] -> String
 rawToString = map (chr . fromIntegral)
@@ -113,3 +143,206 @@ encodeWithPadding64 [x, y, z] = encodeGroup64 (x, y, z)
 encode64 :: Word8 -> Char
 encode64 x = base64Alphabet !! fromIntegral x
 
+
+-- ByteString codecs. Decoders look each byte up in an unboxed table and
+-- write straight into the output buffer, skipping whitespace as the C
+-- decoders do; encoders write through Builder primitives.
+
+-- Entries of the decoding tables that aren't digit values
+padMarker, skipMarker, badMarker :: Word8
+padMarker = 64
+skipMarker = 65
+badMarker = 255
+
+-- Bytes read per chunk by decodeBase64File
+streamChunkSize :: Int
+streamChunkSize = 64 * 1024
+
+base16Values :: U.Vector Word8
+base16Values = U.generate 256 value where
+    value b
+        | isHexDigit (chr b) = fromIntegral $ digitToInt (chr b)
+        | b < 128 && isSpace (chr b) = skipMarker
+        | otherwise = badMarker
+
+base64Values :: U.Vector Word8
+base64Values = U.generate 256 value where
+    value b = case chr b `elemIndex` base64Alphabet of
+        Just v -> fromIntegral v
+        Nothing | chr b == '=' -> padMarker
+                | b < 128 && isSpace (chr b) -> skipMarker
+                | otherwise -> badMarker
+
+base64Symbols :: U.Vector Word8
+base64Symbols = U.fromList $ map (fromIntegral . ord) base64Alphabet
+
+encodeBase16 :: ByteString -> ByteString
+encodeBase16 = L.toStrict . BB.toLazyByteString . BB.byteStringHex
+
+encodeBase16Lazy :: L.ByteString -> L.ByteString
+encodeBase16Lazy = BB.toLazyByteString . BB.lazyByteStringHex
+
+encodeBase64 :: ByteString -> ByteString
+encodeBase64 = L.toStrict . BB.toLazyByteString . base64Builder
+
+-- Chunks are regrouped on the way, so only the last group is padded
+encodeBase64Lazy :: L.ByteString -> L.ByteString
+encodeBase64Lazy = BB.toLazyByteString . go B.empty . L.toChunks where
+    go carry [] = base64Builder carry
+    go carry (c:cs)
+        | B.length carry + B.length c < 3 = go (carry `B.append` c) cs
+        | otherwise = base64Builder (carry `B.append` B.take k c) `mappend`
+                      base64Builder (B.take whole rest) `mappend`
+                      go (B.drop whole rest) cs where
+            k = (3 - B.length carry) `mod` 3
+            rest = B.drop k c
+            whole = B.length rest `div` 3 * 3
+
+base64Builder :: ByteString -> Builder
+base64Builder s = BP.primUnfoldrFixed base64Group next 0 `mappend`
+                  base64Tail (B.drop whole s) where
+    whole = B.length s `div` 3 * 3
+    next i
+        | i >= whole = Nothing
+        | otherwise = Just (bytesToGroup s i 3, i + 3)
+
+-- the last 1 or 2 bytes of a string, with padding
+base64Tail :: ByteString -> Builder
+base64Tail t
+    | B.null t = mempty
+    | otherwise = mconcat (map (BB.word8 . base64Symbol g) shifts) `mappend`
+                  BB.string7 (replicate (3 - n) '=') where
+        n = B.length t
+        g = bytesToGroup t 0 n
+        shifts = take (n + 1) [18, 12, 6]
+
+-- the 4 characters of a group of 3 bytes
+base64Group :: BP.FixedPrim Word32
+base64Group = symbols BP.>$< (BP.word8 BP.>*< BP.word8 BP.>*< BP.word8 BP.>*<
+                              BP.word8) where
+    symbols g = (base64Symbol g 18, (base64Symbol g 12,
+              (base64Symbol g 6, base64Symbol g 0)))
+
+base64Symbol :: Word32 -> Int -> Word8
+base64Symbol g n = U.unsafeIndex base64Symbols $
+                   fromIntegral (g `shiftR` n .&. 0x3f)
+
+-- up to 3 bytes from an offset of a string, as the top of a 24-bit group
+bytesToGroup :: ByteString -> Int -> Int -> Word32
+bytesToGroup s i n = foldl' add 0 [0, 1, 2] where
+    add g j = g `shiftL` 8 .|.
+              (if j < n then fromIntegral (BU.unsafeIndex s (i + j)) else 0)
+
+decodeBase16 :: ByteString -> Maybe ByteString
+decodeBase16 s = do
+    (pending, out) <- base16DecodeChunk Nothing s
+    guard (pending == Nothing)
+    return out
+
+decodeBase16Lazy :: L.ByteString -> Maybe L.ByteString
+decodeBase16Lazy = go Nothing [] . L.toChunks where
+    go pending outs [] = do
+        guard (pending == Nothing)
+        return . L.fromChunks $ reverse outs
+    go pending outs (c:cs) = do
+        (pending', out) <- base16DecodeChunk pending c
+        go pending' (out : outs) cs
+
+-- Decode a piece of base 16, which may start with the first digit of a pair
+-- left over from the piece before it, and may leave one over itself
+base16DecodeChunk :: Maybe Word8 -> ByteString ->
+                     Maybe (Maybe Word8, ByteString)
+base16DecodeChunk pending s = runDecoder base16Values bound step pending s where
+    bound = (B.length s + 1) `div` 2
+    step dest o p v = case p of
+        Nothing -> return $ Just (o, Just v)
+        Just high -> do
+            pokeByteOff dest o (high `shiftL` 4 .|. v)
+            return $ Just (o + 1, Nothing)
+
+-- State of a base 64 decoder between chunks: the 6-bit values of an
+-- unfinished group, how many there are, and how many of them were padding
+data Base64Decoder = Base64Decoder {-# UNPACK #-} !Word32
+                                   {-# UNPACK #-} !Int
+                                   {-# UNPACK #-} !Int
+
+base64Decoder :: Base64Decoder
+base64Decoder = Base64Decoder 0 0 0
+
+-- Decode the next chunk of a base 64 stream. A group of 4 characters may be
+-- split between chunks, and '=' padding may end any group, so concatenated
+-- streams decode as one.
+base64DecodeChunk :: Base64Decoder -> ByteString ->
+                     Maybe (Base64Decoder, ByteString)
+base64DecodeChunk d s = runDecoder base64Values bound step d s where
+    bound = 3 * ((B.length s + 3) `div` 4)
+    step dest o (Base64Decoder g n pad) v
+        | v == padMarker && n < 2 = return Nothing
+        | v /= padMarker && pad > 0 = return Nothing
+        | n < 3 = return $ Just (o, Base64Decoder g' (n + 1) pad')
+        | otherwise = do
+            forM_ (take (3 - pad') [0, 1, 2]) $ \j ->
+                pokeByteOff dest (o + j)
+                    (fromIntegral (g' `shiftR` (16 - 8 * j)) :: Word8)
+            return $ Just (o + 3 - pad', base64Decoder) where
+        g' = g `shiftL` 6 .|. (if v == padMarker then 0 else fromIntegral v)
+        pad' = if v == padMarker then pad + 1 else pad
+
+-- whether a base 64 stream ended on a whole group
+base64DecodeFinal :: Base64Decoder -> Bool
+base64DecodeFinal (Base64Decoder _ n _) = n == 0
+
+decodeBase64 :: ByteString -> Maybe ByteString
+decodeBase64 s = do
+    (d, out) <- base64DecodeChunk base64Decoder s
+    guard (base64DecodeFinal d)
+    return out
+
+decodeBase64Lazy :: L.ByteString -> Maybe L.ByteString
+decodeBase64Lazy = go base64Decoder [] . L.toChunks where
+    go d outs [] = do
+        guard (base64DecodeFinal d)
+        return . L.fromChunks $ reverse outs
+    go d outs (c:cs) = do
+        (d', out) <- base64DecodeChunk d c
+        go d' (out : outs) cs
+
+-- Decode a base 64 file, such as a line wrapped one, a chunk at a time,
+-- handing each piece of output to an action as it is decoded, so the file
+-- is never held in memory. Returns whether the whole file was valid; output
+-- up to a bad character has been handed over by then.
+decodeBase64File :: FilePath -> (ByteString -> IO ()) -> IO Bool
+decodeBase64File path consume =
+    withBinaryFile path ReadMode $ \h -> loop h base64Decoder where
+        loop h d = do
+            piece <- B.hGetSome h streamChunkSize
+            if B.null piece
+                then return (base64DecodeFinal d)
+                else case base64DecodeChunk d piece of
+                    Nothing -> return False
+                    Just (d', out) -> consume out >> loop h d'
+
+-- Run a decoder over a string, into a buffer of at most bound bytes. Each
+-- byte is looked up in a table; whitespace is skipped and bytes that aren't
+-- digits fail. step gets the output buffer and offset, the state and the
+-- value of each digit, and returns the new offset and state, or Nothing if
+-- the digit can't come there.
+runDecoder :: U.Vector Word8 -> Int ->
+              (Ptr Word8 -> Int -> s -> Word8 -> IO (Maybe (Int, s))) -> s ->
+              ByteString -> Maybe (s, ByteString)
+runDecoder table bound step state s = unsafeDupablePerformIO $ do
+    (out, result) <- BI.createAndTrim' bound $ \dest -> do
+        let value i = U.unsafeIndex table (fromIntegral $ BU.unsafeIndex s i)
+            go !i !o st
+                | i == B.length s = return (0, o, Just st)
+                | otherwise =
+                    case value i of
+                        v | v == skipMarker -> go (i + 1) o st
+                          | v == badMarker -> return (0, 0, Nothing)
+                          | otherwise -> do
+                              r <- step dest o st v
+                              case r of
+                                  Nothing -> return (0, 0, Nothing)
+                                  Just (o', st') -> go (i + 1) o' st'
+        go 0 0 state
+    return $ fmap (\st -> (st, out)) result
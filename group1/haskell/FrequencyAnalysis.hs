@@ -1,40 +1,65 @@
 module FrequencyAnalysis
 ( score
+, scoreXorKeys
+, histogram
+, scoreHistogram
 ) where
 
-import qualified Data.Map as M
+import Control.Monad.ST
+import Data.ByteString (ByteString)
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Unsafe as BU
+import Data.Bits (xor)
 import Data.Char
-import Control.Applicative
+import qualified Data.Vector.Unboxed as U
+import qualified Data.Vector.Unboxed.Mutable as UM
 
 type Percent = Double
-type LetterFrequencies = M.Map Char Percent
 
-score :: String -> Double
-score = dotProduct english . frequencies
+-- count of each byte value
+type Histogram = U.Vector Int
 
-countedCharacters :: String
-countedCharacters = "abcdefghigklmnopqrstuvwxyz "
+-- how closely a text's letter frequencies match english: the dot product of
+-- the percentage of the text each counted character makes up, ignoring case,
+-- with its percentage in english
+score :: ByteString -> Double
+score s = scoreHistogram (B.length s) (histogram s)
 
-occurrences :: Char -> String -> Int
-occurrences c = length . filter (==c)
+-- score the text a string decrypts to under each single byte xor key, from
+-- one histogram: byte b of the plain text is b `xor` key of the cipher text
+scoreXorKeys :: ByteString -> [Double]
+scoreXorKeys s = map keyScore [0..255] where
+    hist = histogram s
+    keyScore k = scoreHistogram (B.length s) $
+        U.backpermute hist (U.generate 256 (xor k))
 
-frequency :: Char -> String -> Percent
-frequency c s = fromIntegral (100 * occurrences c s) / fromIntegral (length s)
+-- count the bytes of a string in one strict pass
+histogram :: ByteString -> Histogram
+histogram s = runST $ do
+    counts <- UM.replicate 256 0
+    let count i
+            | i == B.length s = return ()
+            | otherwise = do
+                UM.unsafeModify counts (+1) (fromIntegral $ BU.unsafeIndex s i)
+                count (i + 1)
+    count 0
+    U.unsafeFreeze counts
 
-frequencies :: String -> LetterFrequencies
-frequencies s = M.fromList $ zip countedCharacters freqs where
-    freqs = frequency <$> countedCharacters <*> pure (downcase s)
+-- score a text of a given length from its histogram
+scoreHistogram :: Int -> Histogram -> Double
+scoreHistogram 0 _ = 0
+scoreHistogram len hist = 100 * U.sum (U.zipWith weigh hist english) /
+                          fromIntegral len where
+    weigh n p = fromIntegral n * p
 
-downcase :: String -> String
-downcase = map toLower
+countedCharacters :: String
+countedCharacters = "abcdefghijklmnopqrstuvwxyz "
 
-english :: LetterFrequencies
-english = M.fromList $ zip countedCharacters freqs where
+-- percentage of english each byte value makes up, with upper case letters
+-- counting as lower case, and 0 for the bytes that aren't counted
+english :: U.Vector Percent
+english = U.generate 256 $ \b ->
+    maybe 0 id $ lookup (toLower $ chr b) (zip countedCharacters freqs) where
           freqs = [6.33, 1.39, 2.09, 3.39, 10.56, 1.84, 1.55, 5.13, 5.78, 0.14,
                    0.50, 3.27, 2.24, 5.74, 6.14, 1.29, 0.09, 4.97, 5.02, 7.14,
                    2.30, 0.87, 1.87, 0.13, 1.93, 0.14, 18.15]
-
---dotProduct :: LetterFrequencies -> LetterFrequencies -> Double
-dotProduct :: (Num b, Ord k) => M.Map k b -> M.Map k b -> b
-dotProduct = (M.fold (+) 0 .) . M.intersectionWith (*)
-
@@ -0,0 +1,62 @@
+-- Criterion benchmarks of the english scoring in FrequencyAnalysis, against
+-- the list version it replaced (kept here as listScore), on prefixes of
+-- plaintext.txt and on finding a single byte xor key.
+-- Run with `make haskell-bench`.
+module Main where
+
+import Criterion.Main
+import Data.Bits (xor)
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Char8 as C
+import Data.Char (toLower)
+import Data.List (maximumBy)
+import qualified Data.Map as M
+import Data.Ord (comparing)
+import Data.Word
+
+import FrequencyAnalysis
+
+main :: IO ()
+main = do
+    text <- B.readFile "plaintext.txt"
+    let sizes = [64, 1024, 16384]
+        prefix n = B.take n (B.concat (replicate (n `div` B.length text + 1)
+                                                 text))
+        cipherText = B.map (xor 0x5a) (prefix 1024)
+    defaultMain
+        [ bgroup "score"
+            [ bgroup (show n)
+                [ bench "list" $ nf listScore (C.unpack (prefix n))
+                , bench "histogram" $ nf score (prefix n)
+                ]
+            | n <- sizes ]
+        , bgroup "findKey/1024"
+            [ bench "list" $ nf listFindKey (B.unpack cipherText)
+            , bench "histogram" $ nf findKey cipherText
+            ]
+        ]
+
+-- The scoring FrequencyAnalysis used to do: one traversal of the downcased
+-- text per counted character
+listScore :: String -> Double
+listScore s = M.foldr (+) 0 $ M.intersectionWith (*) english freqs where
+    lower = map toLower s
+    freqs = M.fromList [(c, frequency c) | c <- counted]
+    frequency c = fromIntegral (100 * length (filter (== c) lower)) /
+                  fromIntegral (length s)
+    english = M.fromList $ zip counted
+        [6.33, 1.39, 2.09, 3.39, 10.56, 1.84, 1.55, 5.13, 5.78, 0.14, 0.50,
+         3.27, 2.24, 5.74, 6.14, 1.29, 0.09, 4.97, 5.02, 7.14, 2.30, 0.87,
+         1.87, 0.13, 1.93, 0.14, 18.15]
+    counted = "abcdefghijklmnopqrstuvwxyz "
+
+findKey :: B.ByteString -> Word8
+findKey = maxIndex . scoreXorKeys
+
+-- XORCiphers.findKey as it was: decrypt and score under every key
+listFindKey :: [Word8] -> Word8
+listFindKey xs = maxIndex $ map (listScore . decrypt) [0..255] where
+    decrypt k = map (toEnum . fromIntegral . xor k) xs
+
+maxIndex :: (Enum b, Num b, Ord a) => [a] -> b
+maxIndex xs = snd $ maximumBy (comparing fst) (zip xs [0..])
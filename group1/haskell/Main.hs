@@ -1,10 +1,23 @@
+{-# LANGUAGE CPP #-}
 module Main where
 
 import Test.HUnit
+-- Built with -DMATASANO_FFI (see `make haskell-test`), the tests run on the
+-- C library through Matasano.FFI instead
+#ifdef MATASANO_FFI
+import Matasano.Compat
+#else
 import Convert
 import XORCiphers
 import AES_ECB
-
+#endif
+import Convert (encodeBase16, encodeBase64, encodeBase64Lazy, decodeBase16,
+                decodeBase64, decodeBase64Lazy, decodeBase64File)
+
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Char8 as C
+import qualified Data.ByteString.Lazy as L
+import Data.IORef
 import Data.Word
 import Data.Char (isSpace)
 import Data.Maybe (fromMaybe)
@@ -21,6 +34,11 @@ base64Tests = TestList [TestLabel "show64Test1" show64Test1,
 base16Tests = TestList [TestLabel "show16Test1" show16Test1,
                         TestLabel "read16Test1" read16Test1]
 
+codecTests = TestList [TestLabel "codec64Test" codec64Test,
+                       TestLabel "codec64LazyTest" codec64LazyTest,
+                       TestLabel "codec16Test" codec16Test,
+                       TestLabel "decode64FileTest" decode64FileTest]
+
 xorCipherTests = TestList [TestLabel "fixedXOR" fixedXORTest,
                            TestLabel "singleCharTest" singleCharXORTest,
                            TestLabel "detectSingle" dectectSingleCharXORTest,
@@ -39,6 +57,10 @@ allTests = TestList [TestLabel "show64Test1" show64Test1,
                      TestLabel "read64Test1" read64Test1,
                      TestLabel "show16Test1" show16Test1,
                      TestLabel "read16Test1" read16Test1,
+                     TestLabel "codec64Test" codec64Test,
+                     TestLabel "codec64LazyTest" codec64LazyTest,
+                     TestLabel "codec16Test" codec16Test,
+                     TestLabel "decode64FileTest" decode64FileTest,
                      TestLabel "fixedXOR" fixedXORTest,
                      TestLabel "singleCharTest" singleCharXORTest,
                      TestLabel "detectSingle" dectectSingleCharXORTest,
@@ -90,6 +112,50 @@ read16Test1 = TestCase (assertEqual "read16" expected actual) where
     actual = readBase16 "0123456789AbCDef";
     expected = Just [0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF]
 
+-- The ByteString codecs agree with the list ones, which can't encode an empty
+-- string
+codec64Test = TestCase (assertEqual "codec64" expected actual) where
+    inputs = map C.pack ["sure.", "asure.", "easure.", "leasure.", "pleasure."]
+    actual = [(encodeBase64 s, decodeBase64 (encodeBase64 s)) |
+              s <- B.empty : inputs]
+    expected = (B.empty, Just B.empty) :
+               [(C.pack . showBase64 $ stringToWord8 (C.unpack s), Just s) |
+                s <- inputs]
+
+-- Groups and padding split between chunks, and lines wrapped
+codec64LazyTest = TestCase (assertEqual "codec64Lazy" expected actual) where
+    input = C.pack $ "SSdtIGtpbGxpbmcgeW91ciBicmFpbiBs\n" ++
+                     "aWtlIGEgcG9pc29ub3Vz\nIG11c2hyb29tIQ==\n"
+    pieces n s
+        | B.null s = []
+        | otherwise = B.take n s : pieces (n `mod` 7 + 1) (B.drop n s)
+    actual = [ fmap L.toStrict . decodeBase64Lazy . L.fromChunks $
+               pieces n input | n <- [1..7] ] ++
+             [ fmap L.toStrict . decodeBase64Lazy . encodeBase64Lazy .
+               L.fromChunks $ pieces n plain | n <- [1..7] ]
+    expected = replicate 14 (Just plain)
+    plain = C.pack "I'm killing your brain like a poisonous mushroom!"
+
+codec16Test = TestCase (assertEqual "codec16" expected actual) where
+    actual = [ decodeBase16 (C.pack "0123456789AbCDef")
+             , decodeBase16 (C.pack "01 23\n4")
+             , decodeBase16 (C.pack "0g")
+             , fmap encodeBase16 (decodeBase16 (C.pack "0123456789AbCDef")) ]
+    expected = [ Just (B.pack [0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF])
+               , Nothing
+               , Nothing
+               , Just (C.pack "0123456789abcdef") ]
+
+-- Streaming a line wrapped file gives what decoding it whole does
+decode64FileTest = TestCase $ do
+    input <- readFile "aes_ecb_enc64.txt"
+    pieces <- newIORef []
+    ok <- decodeBase64File "aes_ecb_enc64.txt" $ \s -> modifyIORef pieces (s :)
+    out <- fmap (B.concat . reverse) (readIORef pieces)
+    assertBool "decode64File" ok
+    assertEqual "decode64File" (readBase64 . concat $ lines input)
+                (Just (B.unpack out))
+
 -- Matasano #2
 fixedXORTest = TestCase (assertEqual "fixedXOR" expected actual) where
     expected = Just "746865206b696420646f6e277420706c6179"
@@ -0,0 +1,80 @@
+-- The list interface of Convert, XORCiphers and AES_ECB, run on the C kernels
+-- of Matasano.FFI. Main.hs imports this in place of those modules when built
+-- with -DMATASANO_FFI, so the same tests check both implementations.
+module Matasano.Compat
+( rawToString
+, stringToWord8
+, readBase16
+, showBase16
+, readBase64
+, showBase64
+, fixedXOR
+, repeatKeyXOR
+, breakSingleCharXORCipher
+, detectSingleCharXOR
+, breakRepeatKeyXORCipher
+, hamming
+, ecbDecryptAES128
+, findEcbEnc
+) where
+
+import Convert (rawToString, stringToWord8)
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Char8 as C
+import Data.List (maximumBy)
+import Data.Ord (comparing)
+import Data.Word
+import qualified Matasano.FFI as FFI
+
+-- Largest key size breakRepeatKeyXORCipher tries, as XORCiphers does; fewer
+-- on texts shorter than 12 times this, which FFI.breakRepeatKeyXOR needs
+maxKeySize :: Int
+maxKeySize = 40
+
+readBase16 :: String -> Maybe [Word8]
+readBase16 = fmap B.unpack . FFI.readBase16 . C.pack
+
+showBase16 :: [Word8] -> String
+showBase16 = C.unpack . FFI.showBase16 . B.pack
+
+readBase64 :: String -> Maybe [Word8]
+readBase64 = fmap B.unpack . FFI.readBase64 . C.pack
+
+showBase64 :: [Word8] -> String
+showBase64 = C.unpack . FFI.showBase64 . B.pack
+
+fixedXOR :: [Word8] -> [Word8] -> [Word8]
+fixedXOR x y = B.unpack $ FFI.fixedXOR (B.pack x) (B.pack y)
+
+repeatKeyXOR :: [Word8] -> [Word8] -> [Word8]
+repeatKeyXOR key xs = B.unpack $ FFI.repeatKeyXOR (B.pack key) (B.pack xs)
+
+breakSingleCharXORCipher :: [Word8] -> (Word8, String)
+breakSingleCharXORCipher = fst . breakSingle . B.pack
+
+detectSingleCharXOR :: [[Word8]] -> ([Word8], (Word8, String))
+detectSingleCharXOR cts = fst $ maximumBy (comparing snd) pts where
+    pts = [((ct, pt), s) | ct <- cts, let (pt, s) = breakSingle (B.pack ct)]
+
+breakRepeatKeyXORCipher :: [Word8] -> ([Word8], String)
+breakRepeatKeyXORCipher xs = (B.unpack key, C.unpack decrypted) where
+    ct = B.pack xs
+    key = FFI.breakRepeatKeyXOR (min maxKeySize (B.length ct `div` 12)) ct
+    decrypted = FFI.repeatKeyXOR key ct
+
+hamming :: [Word8] -> [Word8] -> Int
+hamming x y = FFI.hammingDistance (B.pack x) (B.pack y)
+
+ecbDecryptAES128 :: [Word8] -> [Word8] -> [Word8]
+ecbDecryptAES128 key ct = maybe (error "ecbDecryptAES128: bad key or length")
+                                B.unpack
+                                (FFI.aes128EcbDecrypt (B.pack key) (B.pack ct))
+
+findEcbEnc :: [[Word8]] -> [[Word8]]
+findEcbEnc = filter (FFI.isEcbEncrypted . B.pack)
+
+-- the key and plain text of a single byte xor, and the plain text's score
+breakSingle :: B.ByteString -> ((Word8, String), Double)
+breakSingle ct = ((key, C.unpack plaintext), s) where
+    (key, s) = FFI.breakSingleByteXOR ct
+    plaintext = FFI.repeatKeyXOR (B.singleton key) ct
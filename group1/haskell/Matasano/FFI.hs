@@ -0,0 +1,218 @@
+{-# LANGUAGE ForeignFunctionInterface #-}
+-- Bindings to the C library in the directory above (libmatasano), on strict
+-- ByteStrings. Inputs are handed to C in place, and outputs are written
+-- straight into new ByteStrings, so nothing is copied on the way. Link with
+-- libmatasano.a and -pthread; `make haskell-test` does.
+module Matasano.FFI
+( readBase16
+, showBase16
+, readBase64
+, showBase64
+, fixedXOR
+, repeatKeyXOR
+, hammingDistance
+, breakSingleByteXOR
+, breakRepeatKeyXOR
+, isEcbEncrypted
+, aes128EcbEncrypt
+, aes128EcbDecrypt
+) where
+
+import Data.ByteString (ByteString)
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Internal as BI
+import Data.ByteString.Unsafe (unsafeUseAsCStringLen)
+import Data.List (maximumBy)
+import Data.Ord (comparing)
+import Data.Word
+import Foreign.C.Types
+import Foreign.Ptr
+import Foreign.Marshal.Alloc (allocaBytes, allocaBytesAligned)
+import Foreign.Marshal.Array (allocaArray, peekArray)
+import Foreign.Marshal.Utils (fillBytes)
+import System.IO.Unsafe (unsafeDupablePerformIO)
+
+-- convert.h
+foreign import ccall unsafe "sprint_base16"
+    c_sprint_base16 :: Ptr CChar -> Ptr Word8 -> CSize -> IO ()
+foreign import ccall unsafe "sprint_base64"
+    c_sprint_base64 :: Ptr CChar -> Ptr Word8 -> CSize -> IO ()
+foreign import ccall unsafe "base16_decode_update"
+    c_base16_decode_update :: Ptr () -> Ptr Word8 -> Ptr CChar -> CSize ->
+                              IO CSize
+foreign import ccall unsafe "base16_decode_final"
+    c_base16_decode_final :: Ptr () -> IO CInt
+foreign import ccall unsafe "base64_decode_update"
+    c_base64_decode_update :: Ptr () -> Ptr Word8 -> Ptr CChar -> CSize ->
+                              IO CSize
+foreign import ccall unsafe "base64_decode_final"
+    c_base64_decode_final :: Ptr () -> IO CInt
+
+-- xor.h
+foreign import ccall unsafe "fixed_xor"
+    c_fixed_xor :: Ptr Word8 -> Ptr Word8 -> Ptr Word8 -> CSize -> IO ()
+foreign import ccall unsafe "repeated_key_xor"
+    c_repeated_key_xor :: Ptr Word8 -> CSize -> Ptr Word8 -> Ptr Word8 ->
+                          CSize -> IO ()
+foreign import ccall unsafe "break_repeated_key_xor"
+    c_break_repeated_key_xor :: Ptr Word8 -> CSize -> Ptr Word8 -> CSize ->
+                                IO CSize
+
+-- text_score.h
+foreign import ccall unsafe "hamming_distance"
+    c_hamming_distance :: Ptr Word8 -> Ptr Word8 -> CSize -> IO Word32
+foreign import ccall unsafe "byte_histogram"
+    c_byte_histogram :: Ptr Word32 -> Ptr Word8 -> CSize -> IO ()
+foreign import ccall unsafe "score_xor_keys"
+    c_score_xor_keys :: Ptr Word32 -> CSize -> Ptr CDouble -> IO ()
+
+-- cipher.h
+foreign import ccall unsafe "is_ecb_encrypted"
+    c_is_ecb_encrypted :: Ptr Word8 -> CSize -> IO Word32
+foreign import ccall unsafe "aes128_expand_key"
+    c_aes128_expand_key :: Ptr () -> Ptr Word8 -> IO ()
+foreign import ccall unsafe "aes128_ecb_encrypt"
+    c_aes128_ecb_encrypt :: Ptr () -> Ptr Word8 -> Ptr Word8 -> CSize -> IO ()
+foreign import ccall unsafe "aes128_ecb_decrypt"
+    c_aes128_ecb_decrypt :: Ptr () -> Ptr Word8 -> Ptr Word8 -> CSize -> IO ()
+
+-- Bytes to set aside for struct base16_decoder or struct base64_decoder,
+-- which are zeroed before use
+decoderBytes :: Int
+decoderBytes = 16
+
+-- sizeof (struct aes128_schedule): the encryption and decryption round keys
+aesScheduleBytes :: Int
+aesScheduleBytes = 2 * (10 + 1) * aesBlockSize
+
+aesBlockSize :: Int
+aesBlockSize = 16
+
+readBase16 :: ByteString -> Maybe ByteString
+readBase16 = decodeWith c_base16_decode_update c_base16_decode_final
+                        (\n -> (n + 1) `div` 2)
+
+showBase16 :: ByteString -> ByteString
+showBase16 s = unsafeDupablePerformIO $
+    -- one more byte for the terminator sprint_base16 writes
+    BI.createAndTrim (2 * n + 1) $ \dest ->
+        withBytes s $ \src len -> do
+            c_sprint_base16 (castPtr dest) src len
+            return (2 * n) where
+    n = B.length s
+
+readBase64 :: ByteString -> Maybe ByteString
+readBase64 = decodeWith c_base64_decode_update c_base64_decode_final
+                        (\n -> 3 * ((n + 3) `div` 4))
+
+showBase64 :: ByteString -> ByteString
+showBase64 s = unsafeDupablePerformIO $
+    BI.createAndTrim (encoded + 1) $ \dest ->
+        withBytes s $ \src len -> do
+            c_sprint_base64 (castPtr dest) src len
+            return encoded where
+    encoded = 4 * ((B.length s + 2) `div` 3)
+
+-- xor the common length of two strings
+fixedXOR :: ByteString -> ByteString -> ByteString
+fixedXOR x y = unsafeDupablePerformIO $
+    BI.create n $ \dest ->
+        withBytes x $ \a _ ->
+            withBytes y $ \b _ -> c_fixed_xor dest a b (fromIntegral n) where
+    n = min (B.length x) (B.length y)
+
+-- xor a text with a key repeated along it
+repeatKeyXOR :: ByteString -> ByteString -> ByteString
+repeatKeyXOR key s
+    | B.null key = s
+    | otherwise = unsafeDupablePerformIO $
+        BI.create (B.length s) $ \dest ->
+            withBytes key $ \k keySize ->
+                withBytes s $ \src len ->
+                    c_repeated_key_xor k keySize src dest len
+
+-- bits that differ over the common length of two strings
+hammingDistance :: ByteString -> ByteString -> Int
+hammingDistance x y
+    | n == 0 = 0
+    | otherwise = fromIntegral . unsafeDupablePerformIO $
+        withBytes x $ \a _ ->
+            withBytes y $ \b _ -> c_hamming_distance a b (fromIntegral n) where
+    n = min (B.length x) (B.length y)
+
+-- The single byte key that makes a cipher text look most like english, and
+-- the score of the text it decrypts to, higher the more english it looks.
+-- Every key is scored from one count of the cipher text's bytes.
+breakSingleByteXOR :: ByteString -> (Word8, Double)
+breakSingleByteXOR s = unsafeDupablePerformIO $
+    allocaArray 256 $ \hist ->
+        allocaArray 256 $ \scores -> do
+            fillBytes hist 0 (256 * 4)
+            withBytes s $ \src len -> do
+                c_byte_histogram hist src len
+                c_score_xor_keys hist len scores
+            xs <- peekArray 256 scores
+            let (score, key) = maximumBy (comparing fst) (zip xs [0..])
+            return (key, realToFrac score)
+
+-- The key of a repeated key xor, trying sizes up to maxKeySize. The key size
+-- search compares 6 pairs of blocks of each size, which needs a text 12 times
+-- the largest size, so sizes past a twelfth of the text aren't tried; the key
+-- is empty if the text is shorter than 12 bytes.
+breakRepeatKeyXOR :: Int -> ByteString -> ByteString
+breakRepeatKeyXOR maxKeySize s
+    | n <= 0 = B.empty
+    | otherwise = unsafeDupablePerformIO $
+        BI.createAndTrim n $ \key ->
+            withBytes s $ \src len ->
+                fromIntegral <$> c_break_repeated_key_xor src len key
+                                     (fromIntegral n) where
+    n = min maxKeySize (B.length s `div` 12)
+
+-- whether any 16 byte block repeats
+isEcbEncrypted :: ByteString -> Bool
+isEcbEncrypted s = unsafeDupablePerformIO $
+    withBytes s $ \src len -> (/= 0) <$> c_is_ecb_encrypted src len
+
+-- AES-128 in ECB mode, with a 16 byte key, on whole blocks
+aes128EcbEncrypt :: ByteString -> ByteString -> Maybe ByteString
+aes128EcbEncrypt = aes128Ecb c_aes128_ecb_encrypt
+
+aes128EcbDecrypt :: ByteString -> ByteString -> Maybe ByteString
+aes128EcbDecrypt = aes128Ecb c_aes128_ecb_decrypt
+
+aes128Ecb :: (Ptr () -> Ptr Word8 -> Ptr Word8 -> CSize -> IO ()) ->
+             ByteString -> ByteString -> Maybe ByteString
+aes128Ecb run key s
+    | B.length key /= aesBlockSize = Nothing
+    | B.length s `mod` aesBlockSize /= 0 = Nothing
+    | otherwise = Just . unsafeDupablePerformIO $
+        allocaBytesAligned aesScheduleBytes aesBlockSize $ \ks -> do
+            withBytes key $ \k _ -> c_aes128_expand_key ks k
+            BI.create (B.length s) $ \dest ->
+                withBytes s $ \src len -> run ks src dest len
+
+-- Run one of the streaming decoders over a whole string. The decoders skip
+-- whitespace, so the output is trimmed to what was written.
+decodeWith :: (Ptr () -> Ptr Word8 -> Ptr CChar -> CSize -> IO CSize) ->
+              (Ptr () -> IO CInt) -> (Int -> Int) -> ByteString ->
+              Maybe ByteString
+decodeWith update final bound s
+    | B.null s = Just B.empty
+    | otherwise = unsafeDupablePerformIO $
+        allocaBytes decoderBytes $ \d -> do
+            fillBytes d 0 decoderBytes
+            (out, ok) <- BI.createAndTrim' (bound (B.length s)) $ \dest ->
+                unsafeUseAsCStringLen s $ \(src, len) -> do
+                    n <- update d dest src (fromIntegral len)
+                    if n == maxBound
+                        then return (0, 0, False)
+                        else do
+                            r <- final d
+                            return (0, fromIntegral n, r == 0)
+            return $ if ok then Just out else Nothing
+
+-- Pass a string to C as a pointer to its bytes and their count
+withBytes :: ByteString -> (Ptr Word8 -> CSize -> IO a) -> IO a
+withBytes s f = unsafeUseAsCStringLen s $ \(p, n) ->
+    f (castPtr p) (fromIntegral n)
@@ -11,6 +11,8 @@ import Convert
 import Data.Word
 import Data.Bits
 import FrequencyAnalysis
+import qualified Data.ByteString as B
+import qualified Data.ByteString.Char8 as C
 import Data.List (maximumBy, minimumBy, transpose)
 import Data.List.Split (chunksOf)
 import Data.Ord (comparing)
@@ -30,7 +32,8 @@ breakSingleCharXORCipher xs =
         (key, plaintext)
 
 detectSingleCharXOR :: [[Word8]] -> ([Word8], (Word8, String))
-detectSingleCharXOR cts = maximumBy (comparing $ score . snd . snd) pts where
+detectSingleCharXOR cts = maximumBy (comparing $ score . C.pack . snd . snd)
+                                    pts where
     pts = zip cts $ map breakSingleCharXORCipher cts
 
 breakRepeatKeyXORCipher :: [Word8] -> ([Word8], String)
@@ -44,8 +47,7 @@ hamming :: (Num a, Bits a, Num b) => [a] -> [a] -> b
 hamming = (sum .) . zipWith hammingDistance
 
 findKey :: [Word8] -> Word8
-findKey xs = maxIndex $ map (score . rawToString . encrypt) [0..255] where
-    encrypt k = repeatKeyXOR (return k) xs
+findKey = maxIndex . scoreXorKeys . B.pack
 
 maxIndex :: (Enum b, Num b, Ord a) => [a] -> b
 maxIndex xs = snd $ maximumBy (comparing fst) (zip xs [0..])
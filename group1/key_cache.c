@@ -0,0 +1,305 @@
+/*
+ * key_cache.c
+ * A fixed-capacity cache of expanded AES-128 key schedules, for workloads that
+ * encrypt or decrypt many short messages under a limited set of keys. The
+ * cache is split into independently locked stripes; each stripe evicts its
+ * least recently used unpinned entry when it runs out of room.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "key_cache.h"
+
+#define UNCACHED_STRIPE UINT32_MAX
+
+// One cached schedule. The handle must stay the first member so that a
+// handle pointer can be converted back to its entry.
+struct cache_entry {
+    struct key_handle handle;
+    uint8_t key[AES128_KEY_SIZE];
+    uint64_t hash;
+    uint32_t refs;
+    uint32_t stripe;
+    struct cache_entry *chain;      // next entry in the same bucket
+    struct cache_entry *lru_prev;   // only linked while refs == 0
+    struct cache_entry *lru_next;
+};
+
+struct cache_stripe {
+    pthread_mutex_t lock;
+    struct cache_entry *entries;
+    size_t num_entries;
+    size_t used;                    // entries handed out at least once
+    struct cache_entry **buckets;
+    size_t num_buckets;             // power of 2
+    struct cache_entry *lru_head;   // most recently released
+    struct cache_entry *lru_tail;   // next to be evicted
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t uncached;
+};
+
+struct key_cache {
+    struct cache_stripe *stripes;
+    size_t num_stripes;
+};
+
+// Private functions
+static uint64_t hash_key(const uint8_t *key);
+static struct cache_entry *find_entry(struct cache_stripe *s,
+        const uint8_t *key, uint64_t hash);
+static void unlink_bucket(struct cache_stripe *s, struct cache_entry *e);
+static void lru_remove(struct cache_stripe *s, struct cache_entry *e);
+static void lru_push_front(struct cache_stripe *s, struct cache_entry *e);
+static struct cache_entry *take_free_entry(struct cache_stripe *s);
+
+/*
+ * Create a key schedule cache
+ * @param capacity total number of schedules to hold
+ * @param stripes number of independently locked partitions
+ *        precondition: stripes > 0 and capacity >= stripes
+ * @return pointer to the new cache, or NULL if it could not be allocated
+ */
+struct key_cache *key_cache_create(size_t capacity, size_t stripes)
+{
+    if (stripes == 0 || capacity < stripes)
+        return NULL;
+    struct key_cache *cache = calloc(1, sizeof *cache);
+    if (!cache)
+        return NULL;
+    cache->stripes = calloc(stripes, sizeof *cache->stripes);
+    if (!cache->stripes) {
+        free(cache);
+        return NULL;
+    }
+    cache->num_stripes = stripes;
+    for (size_t i = 0; i < stripes; ++i) {
+        struct cache_stripe *s = &cache->stripes[i];
+        // spread any remainder over the first few stripes
+        s->num_entries = capacity / stripes + (i < capacity % stripes);
+        s->num_buckets = 1;
+        while (s->num_buckets < 2 * s->num_entries)
+            s->num_buckets <<= 1;
+        s->entries = calloc(s->num_entries, sizeof *s->entries);
+        s->buckets = calloc(s->num_buckets, sizeof *s->buckets);
+        pthread_mutex_init(&s->lock, NULL);
+        if (!s->entries || !s->buckets) {
+            cache->num_stripes = i + 1;
+            key_cache_destroy(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+/*
+ * Free a cache and all of its entries
+ * @param cache cache to free
+ *        precondition: no handles from this cache are still held
+ */
+void key_cache_destroy(struct key_cache *cache)
+{
+    if (!cache)
+        return;
+    for (size_t i = 0; i < cache->num_stripes; ++i) {
+        struct cache_stripe *s = &cache->stripes[i];
+        pthread_mutex_destroy(&s->lock);
+        free(s->entries);
+        free(s->buckets);
+    }
+    free(cache->stripes);
+    free(cache);
+}
+
+/*
+ * Look up the expanded schedule for a raw key, expanding and inserting it on a
+ * miss. The returned handle is pinned and will not be evicted until released.
+ * @param cache cache to look in
+ * @param key raw key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ * @return handle to the expanded key, or NULL on allocation failure
+ */
+struct key_handle *key_cache_acquire(struct key_cache *cache,
+        const uint8_t *key)
+{
+    if (!cache || !key)
+        return NULL;
+    uint64_t hash = hash_key(key);
+    uint32_t stripe = (uint32_t) ((hash >> 32) % cache->num_stripes);
+    struct cache_stripe *s = &cache->stripes[stripe];
+
+    pthread_mutex_lock(&s->lock);
+    struct cache_entry *e = find_entry(s, key, hash);
+    if (e) {
+        ++s->hits;
+        if (e->refs++ == 0)
+            lru_remove(s, e);
+        pthread_mutex_unlock(&s->lock);
+        return &e->handle;
+    }
+    ++s->misses;
+    e = take_free_entry(s);
+    if (!e) {
+        // every entry in this stripe is pinned; hand out a private copy
+        ++s->uncached;
+        pthread_mutex_unlock(&s->lock);
+        e = malloc(sizeof *e);
+        if (!e)
+            return NULL;
+        e->stripe = UNCACHED_STRIPE;
+        e->refs = 1;
+        aes128_expand_key(&e->handle.schedule, key);
+        return &e->handle;
+    }
+    memcpy(e->key, key, AES128_KEY_SIZE);
+    e->hash = hash;
+    e->stripe = stripe;
+    e->refs = 1;
+    aes128_expand_key(&e->handle.schedule, key);
+    size_t bucket = hash & (s->num_buckets - 1);
+    e->chain = s->buckets[bucket];
+    s->buckets[bucket] = e;
+    pthread_mutex_unlock(&s->lock);
+    return &e->handle;
+}
+
+/*
+ * Release a handle obtained from key_cache_acquire
+ * @param cache cache the handle came from
+ * @param handle handle to release; must not be used afterwards
+ */
+void key_cache_release(struct key_cache *cache, struct key_handle *handle)
+{
+    if (!cache || !handle)
+        return;
+    struct cache_entry *e = (struct cache_entry *) handle;
+    if (e->stripe == UNCACHED_STRIPE) {
+        free(e);
+        return;
+    }
+    struct cache_stripe *s = &cache->stripes[e->stripe];
+    pthread_mutex_lock(&s->lock);
+    if (--e->refs == 0)
+        lru_push_front(s, e);
+    pthread_mutex_unlock(&s->lock);
+}
+
+/*
+ * Read the hit/miss counters of a cache
+ * @param cache cache to read
+ * @param out pointer to stats struct to write the totals to
+ */
+void key_cache_get_stats(struct key_cache *cache, struct key_cache_stats *out)
+{
+    if (!cache || !out)
+        return;
+    memset(out, 0, sizeof *out);
+    for (size_t i = 0; i < cache->num_stripes; ++i) {
+        struct cache_stripe *s = &cache->stripes[i];
+        pthread_mutex_lock(&s->lock);
+        out->hits += s->hits;
+        out->misses += s->misses;
+        out->evictions += s->evictions;
+        out->uncached += s->uncached;
+        pthread_mutex_unlock(&s->lock);
+    }
+}
+
+/*
+ * Hash a raw key. Keys are fixed-size, so mix the two 64-bit halves and
+ * finish with the murmur3 avalanche step.
+ */
+static uint64_t hash_key(const uint8_t *key)
+{
+    uint64_t lo, hi;
+    memcpy(&lo, key, sizeof lo);
+    memcpy(&hi, key + sizeof lo, sizeof hi);
+    uint64_t h = lo * 0x9e3779b97f4a7c15ULL;
+    h ^= ((hi << 31) | (hi >> 33)) * 0xc2b2ae3d27d4eb4fULL;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/*
+ * Find the entry for a key in a stripe. The stripe lock must be held.
+ * @return the entry, or NULL if the key is not cached
+ */
+static struct cache_entry *find_entry(struct cache_stripe *s,
+        const uint8_t *key, uint64_t hash)
+{
+    struct cache_entry *e = s->buckets[hash & (s->num_buckets - 1)];
+    for (; e; e = e->chain)
+        if (e->hash == hash && memcmp(e->key, key, AES128_KEY_SIZE) == 0)
+            return e;
+    return NULL;
+}
+
+/*
+ * Remove an entry from its bucket chain
+ */
+static void unlink_bucket(struct cache_stripe *s, struct cache_entry *e)
+{
+    struct cache_entry **link = &s->buckets[e->hash & (s->num_buckets - 1)];
+    while (*link && *link != e)
+        link = &(*link)->chain;
+    if (*link)
+        *link = e->chain;
+    e->chain = NULL;
+}
+
+/*
+ * Remove an entry from the lru list
+ */
+static void lru_remove(struct cache_stripe *s, struct cache_entry *e)
+{
+    if (e->lru_prev)
+        e->lru_prev->lru_next = e->lru_next;
+    else
+        s->lru_head = e->lru_next;
+    if (e->lru_next)
+        e->lru_next->lru_prev = e->lru_prev;
+    else
+        s->lru_tail = e->lru_prev;
+    e->lru_prev = e->lru_next = NULL;
+}
+
+/*
+ * Insert an entry at the most recently used end of the lru list
+ */
+static void lru_push_front(struct cache_stripe *s, struct cache_entry *e)
+{
+    e->lru_prev = NULL;
+    e->lru_next = s->lru_head;
+    if (s->lru_head)
+        s->lru_head->lru_prev = e;
+    else
+        s->lru_tail = e;
+    s->lru_head = e;
+}
+
+/*
+ * Get an entry to hold a new key: a never-used one if there are any left,
+ * otherwise the least recently used unpinned one.
+ * @return a detached entry, or NULL if every entry is pinned
+ */
+static struct cache_entry *take_free_entry(struct cache_stripe *s)
+{
+    if (s->used < s->num_entries)
+        return &s->entries[s->used++];
+    struct cache_entry *victim = s->lru_tail;
+    if (!victim)
+        return NULL;
+    lru_remove(s, victim);
+    unlink_bucket(s, victim);
+    ++s->evictions;
+    return victim;
+}
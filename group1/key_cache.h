@@ -0,0 +1,75 @@
+/*
+ * key_cache.h
+ * A fixed-capacity cache of expanded AES-128 key schedules, for workloads that
+ * encrypt or decrypt many short messages under a limited set of keys. The
+ * cache is split into independently locked stripes; each stripe evicts its
+ * least recently used unpinned entry when it runs out of room.
+ */
+
+#ifndef ___key_cache_h___
+#define ___key_cache_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cipher.h"
+
+struct key_cache;
+
+// A pinned reference to an expanded key. The schedule stays valid until the
+// handle is released back to the cache it came from.
+struct key_handle {
+    struct aes128_schedule schedule;
+};
+
+// Running totals for a cache, summed over all of its stripes
+struct key_cache_stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t uncached;  // lookups served outside the cache because every
+                        // entry in the stripe was pinned
+};
+
+/*
+ * Create a key schedule cache
+ * @param capacity total number of schedules to hold
+ * @param stripes number of independently locked partitions
+ *        precondition: stripes > 0 and capacity >= stripes
+ * @return pointer to the new cache, or NULL if it could not be allocated
+ */
+struct key_cache *key_cache_create(size_t capacity, size_t stripes);
+
+/*
+ * Free a cache and all of its entries
+ * @param cache cache to free
+ *        precondition: no handles from this cache are still held
+ */
+void key_cache_destroy(struct key_cache *cache);
+
+/*
+ * Look up the expanded schedule for a raw key, expanding and inserting it on a
+ * miss. The returned handle is pinned and will not be evicted until released.
+ * @param cache cache to look in
+ * @param key raw key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ * @return handle to the expanded key, or NULL on allocation failure
+ */
+struct key_handle *key_cache_acquire(struct key_cache *cache,
+        const uint8_t *key);
+
+/*
+ * Release a handle obtained from key_cache_acquire
+ * @param cache cache the handle came from
+ * @param handle handle to release; must not be used afterwards
+ */
+void key_cache_release(struct key_cache *cache, struct key_handle *handle);
+
+/*
+ * Read the hit/miss counters of a cache
+ * @param cache cache to read
+ * @param out pointer to stats struct to write the totals to
+ */
+void key_cache_get_stats(struct key_cache *cache, struct key_cache_stats *out);
+
+#endif  // ___key_cache_h___
@@ -1,13 +1,38 @@
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 
 #include "convert.h"
 #include "xor.h"
 #include "text_score.h"
 #include "cipher.h"
+#include "key_cache.h"
+#include "memo_cache.h"
+#include "ngram_tables.h"
+#include "ecb_attack.h"
+#include "padding_oracle.h"
+#include "oracle_server.h"
+#include "oracle_client.h"
+#include "cpu_dispatch.h"
+#include "stats.h"
+#include "probes.h"
+#include "arena.h"
+#include "thread_pool.h"
+#include "hamming_matrix.h"
 
 // private functions
 static void test_print_base64();
@@ -19,14 +44,35 @@ static void test_base64();
 static void test_fixed_xor();
 static void test_break_repeat_byte();
 static void test_hamming_distance();
+static void test_hamming_matrix();
 static void test_repeat_key_xor();
 static void test_break_repeat_key();
+static void test_short_key_search();
+static void test_beam_search_key();
+static void test_text_scorer();
 static void test_transpose();
 static void test_find_repeat_byte_xor();
+static void test_sampled_byte_xor();
 static void test_detect_ecb();
+static void test_detect_unaligned_ecb();
+static void test_aes128();
+static void test_key_cache();
+static void test_memo_cache();
+static void test_ecb_byte_at_a_time();
+static void test_oracle_server();
+static void test_padding_oracle();
+static void test_cpu_dispatch();
+static void test_stats();
+static void test_probes();
+static void test_arena();
+static void test_thread_pool();
+static void test_stream_codecs();
+static void test_base64_xor_stream();
 
 int main(void)
 {
+    // run the batch functions over several threads even on a single cpu
+    setenv(THREAD_POOL_ENV, "4", 0);
     test_fixed_xor();
     test_print_base64();
     test_print_base16();
@@ -36,11 +82,30 @@ int main(void)
     test_base64();
     test_break_repeat_byte();
     test_hamming_distance();
+    test_hamming_matrix();
     test_repeat_key_xor();
     test_transpose();
     test_break_repeat_key();
+    test_short_key_search();
+    test_beam_search_key();
+    test_text_scorer();
     test_find_repeat_byte_xor();
+    test_sampled_byte_xor();
     test_detect_ecb();
+    test_detect_unaligned_ecb();
+    test_aes128();
+    test_key_cache();
+    test_memo_cache();
+    test_ecb_byte_at_a_time();
+    test_oracle_server();
+    test_padding_oracle();
+    test_cpu_dispatch();
+    test_stats();
+    test_probes();
+    test_arena();
+    test_thread_pool();
+    test_stream_codecs();
+    test_base64_xor_stream();
     return 0;
 }
 
@@ -219,6 +284,113 @@ static void test_hamming_distance()
     printf("Hamming distance test passed!\n");
 }
 
+// Tiles seen by check_tile
+struct tile_check {
+    const uint8_t *blocks;
+    size_t num;
+    size_t block_size;
+    uint8_t *seen;      // num * num, one per pair i < j
+};
+
+/*
+ * Check that a tile of a set compared with itself matches hamming_distance,
+ * and mark the pairs above the diagonal it holds
+ */
+static void check_tile(void *arg, size_t row, size_t col, size_t rows,
+        size_t cols, const uint32_t *dist, size_t stride)
+{
+    struct tile_check *t = arg;
+    assert(row + rows <= t->num && col + cols <= t->num);
+    for (size_t i = row; i < row + rows; ++i)
+        for (size_t j = col; j < col + cols; ++j) {
+            if (j <= i)
+                continue;
+            assert(dist[(i - row) * stride + j - col] == hamming_distance(
+                        t->blocks + i * t->block_size,
+                        t->blocks + j * t->block_size, t->block_size));
+            ++t->seen[i * t->num + j];
+        }
+}
+
+/*
+ * Test the all pairs hamming distance matrices, on every kernel
+ */
+static void test_hamming_matrix()
+{
+    enum { NUM_A = 300, NUM_B = 131, MAX_BLOCK = 70 };
+    uint8_t *a = malloc(NUM_A * MAX_BLOCK);
+    uint8_t *b = malloc(NUM_B * MAX_BLOCK);
+    uint32_t *dist32 = malloc(NUM_A * NUM_A * sizeof *dist32);
+    uint16_t *dist16 = malloc(NUM_A * NUM_A * sizeof *dist16);
+    uint8_t *seen = malloc(NUM_A * NUM_A);
+    assert(a && b && dist32 && dist16 && seen);
+    uint32_t seed = 4242;
+    for (size_t i = 0; i < NUM_A * MAX_BLOCK; ++i) {
+        seed = seed * 1103515245 + 12345;
+        a[i] = seed >> 16;
+        if (i < NUM_B * MAX_BLOCK)
+            b[i] = seed >> 24;
+    }
+
+    struct cpu_dispatch_info info;
+    cpu_dispatch_get_info(&info);
+    const size_t block_sizes[] = { 1, 5, 16, 29, MAX_BLOCK };
+    for (enum cpu_level level = CPU_LEVEL_SCALAR; level <= info.detected;
+            ++level) {
+        cpu_dispatch_set_level(level);
+        for (size_t s = 0; s < sizeof block_sizes / sizeof block_sizes[0];
+                ++s) {
+            size_t size = block_sizes[s];
+            assert(hamming_matrix(a, NUM_A, b, NUM_B, size, HAMMING_U32,
+                        dist32) == 0);
+            assert(hamming_matrix(a, NUM_A, b, NUM_B, size, HAMMING_U16,
+                        dist16) == 0);
+            for (size_t i = 0; i < NUM_A; ++i)
+                for (size_t j = 0; j < NUM_B; ++j) {
+                    uint32_t d = hamming_distance(a + i * size, b + j * size,
+                            size);
+                    assert(dist32[i * NUM_B + j] == d);
+                    assert(dist16[i * NUM_B + j] == d);
+                }
+
+            assert(hamming_matrix(a, NUM_A, NULL, 0, size, HAMMING_U32,
+                        dist32) == 0);
+            assert(hamming_matrix(a, NUM_A, NULL, 0, size, HAMMING_U16,
+                        dist16) == 0);
+            for (size_t i = 0; i < NUM_A; ++i)
+                for (size_t j = 0; j < NUM_A; ++j) {
+                    uint32_t d = hamming_distance(a + i * size, a + j * size,
+                            size);
+                    assert(dist32[i * NUM_A + j] == d);
+                    assert(dist16[i * NUM_A + j] == d);
+                }
+
+            // each pair above the diagonal is in exactly one tile
+            memset(seen, 0, NUM_A * NUM_A);
+            struct tile_check t = { a, NUM_A, size, seen };
+            assert(hamming_matrix_tiles(a, NUM_A, NULL, 0, size, check_tile,
+                        &t) == 0);
+            for (size_t i = 0; i < NUM_A; ++i)
+                for (size_t j = 0; j < NUM_A; ++j)
+                    assert(seen[i * NUM_A + j] == (j > i));
+        }
+    }
+    cpu_dispatch_set_level(info.active);
+
+    // blocks whose distances could overflow 16 bits
+    assert(hamming_matrix(a, 1, NULL, 0, HAMMING_U16_MAX_BLOCK + 1,
+                HAMMING_U16, dist16) == -1);
+    assert(hamming_matrix(NULL, 1, NULL, 0, 16, HAMMING_U32, dist32) == -1);
+    assert(hamming_matrix(a, 0, b, 0, 16, HAMMING_U32, dist32) == 0);
+
+    free(a);
+    free(b);
+    free(dist32);
+    free(dist16);
+    free(seen);
+    printf("Hamming matrix test passed!\n");
+}
+
 /*
  * Test the repeated key xor function
  */
@@ -339,12 +511,239 @@ static void test_break_repeat_key()
     size_t key_size = break_repeated_key_xor(raw_ct, unpadded, key, 40);
     assert(key_size == 29);
     assert(strncmp((char*)key,"Terminator X: Bring the noise", key_size) == 0);
+    // the key size search reads all of a text 12 times the largest size
+    uint8_t *exact = malloc(12 * 4);
+    assert(exact);
+    memcpy(exact, raw_ct, 12 * 4);
+    uint8_t short_key[4];
+    size_t short_size = break_repeated_key_xor(exact, 12 * 4, short_key, 4);
+    assert(short_size >= 1 && short_size <= 4);
+    free(exact);
     const char expected[] = "I'm back and I'm ringin' the bell";
     repeated_key_xor(key, key_size, raw_ct, raw_ct, unpadded);
     assert(strncmp((char *) raw_ct, expected, sizeof expected - 1) == 0);
     printf("Break repeat key xor test passed!\n");
 }
 
+/*
+ * Score of a text decrypted under a repeating key, the slow way
+ */
+static double score_under_key(const uint8_t *ct, size_t len,
+        const uint8_t *key, size_t key_size)
+{
+    char plain[256];
+    struct letter_frequencies freqs;
+    assert(len <= sizeof plain);
+    repeated_key_xor(key, key_size, ct, (uint8_t *) plain, len);
+    calculate_letter_frequencies(plain, len, &freqs);
+    return compare_to_english(&freqs);
+}
+
+/*
+ * Test the exhaustive search of short repeating xor keys against scoring
+ * every key one by one
+ */
+static void test_short_key_search()
+{
+    const char text[] = "Now that the party is jumping, with the bass kicked in";
+    size_t len = sizeof text - 1;
+    uint8_t ct[sizeof text];
+    struct xor_key_candidate best[8];
+    const uint8_t *keys[] = { (const uint8_t *) "Z",
+        (const uint8_t *) "Kq", (const uint8_t *) "I7e" };
+    for (size_t key_size = 1; key_size <= SHORT_XOR_KEY_MAX; ++key_size) {
+        const uint8_t *key = keys[key_size - 1];
+        repeated_key_xor(key, key_size, (const uint8_t *) text, ct, len);
+        assert(search_short_xor_keys(ct, len, key_size, best, 8) == 8);
+        // letters score the same in either case, so a key byte is only
+        // pinned down up to bit 0x20 when its column holds no spaces
+        for (size_t b = 0; b < key_size; ++b)
+            assert((best[0].key[b] ^ key[b]) == 0 ||
+                    (best[0].key[b] ^ key[b]) == 0x20);
+        for (size_t i = 0; i < 8; ++i) {
+            // column scores add up to the score of the whole text
+            double expected = score_under_key(ct, len, best[i].key,
+                    key_size);
+            assert(fabs(best[i].score - expected) < 1e-9);
+            assert(i == 0 || best[i].score <= best[i - 1].score);
+            for (size_t b = key_size; b < SHORT_XOR_KEY_MAX; ++b)
+                assert(best[i].key[b] == 0);
+        }
+    }
+
+    // the top keys agree with scoring all 2-byte keys one by one
+    repeated_key_xor(keys[1], 2, (const uint8_t *) text, ct, len);
+    search_short_xor_keys(ct, len, 2, best, 8);
+    double kth = best[7].score;
+    size_t above = 0;
+    for (size_t k = 0; k < 65536; ++k) {
+        uint8_t key[2] = { (uint8_t) (k >> 8), (uint8_t) k };
+        if (score_under_key(ct, len, key, 2) > kth + 1e-9)
+            ++above;
+    }
+    assert(above < 8);
+
+    // asking for more keys than there are returns them all
+    struct xor_key_candidate *all = malloc(300 * sizeof *all);
+    assert(all);
+    assert(search_short_xor_keys(ct, len, 1, all, 300) == 256);
+    free(all);
+    assert(search_short_xor_keys(ct, len, 4, best, 8) == 0);
+    assert(search_short_xor_keys(ct, 2, 3, best, 8) == 0);
+    printf("Short key search test passed!\n");
+}
+
+/*
+ * Test recovering repeating xor keys by beam search on texts too short for
+ * letter frequencies alone
+ */
+static void test_beam_search_key()
+{
+    // columns of 11 to 39 bytes, short for letter frequencies alone
+    const char text[] = "It is a truth universally acknowledged, that a "
+        "single man in possession of a good fortune, must be in want of a "
+        "wife.";
+    size_t len = sizeof text - 1;
+    uint8_t ct[sizeof text];
+    const char *keys[] = { "ICE", "YELLOW", "Sunbeam!", "$ecret-k3y" };
+    size_t greedy_right = 0;
+    for (size_t k = 0; k < sizeof keys / sizeof keys[0]; ++k) {
+        size_t key_size = strlen(keys[k]);
+        repeated_key_xor((const uint8_t *) keys[k], key_size,
+                (const uint8_t *) text, ct, len);
+        uint8_t key[16];
+        assert(beam_search_repeated_key(ct, len, key_size, 8, key) == 0);
+        assert(memcmp(key, keys[k], key_size) == 0);
+        // picking each byte on its own, as break_repeated_key_xor does
+        size_t right = 0;
+        for (size_t c = 0; c < key_size; ++c) {
+            uint8_t column[sizeof text];
+            size_t n = 0;
+            for (size_t i = c; i < len; i += key_size)
+                column[n++] = ct[i];
+            right += detect_repeated_byte_xor(column, n) ==
+                (uint8_t) keys[k][c];
+        }
+        greedy_right += right == key_size;
+    }
+    assert(greedy_right < sizeof keys / sizeof keys[0]);
+
+    // a long text gives the same key as break_repeated_key_xor
+    uint8_t raw_ct[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t raw_len = read_base64(raw_ct, cipher_text64,
+            strlen(cipher_text64));
+    uint8_t key[29];
+    assert(beam_search_repeated_key(raw_ct, raw_len, 29, 4, key) == 0);
+    assert(memcmp(key, "Terminator X: Bring the noise", 29) == 0);
+    assert(beam_search_repeated_key(ct, len, 0, 8, key) == -1);
+    assert(beam_search_repeated_key(ct, len, 4, 0, key) == -1);
+    printf("Beam search key test passed!\n");
+}
+
+/*
+ * Trigram score of a text, straight from the tables
+ */
+static double trigram_reference(const uint8_t *text, size_t len)
+{
+    uint8_t a = english_trigram_class[' '];
+    uint8_t b = a;
+    int64_t sum = 0;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t c = english_trigram_class[text[i]];
+        sum += english_trigram_log2[(a << 10) | (b << 5) | c];
+        a = b;
+        b = c;
+    }
+    return len ? (double) sum / (NGRAM_LOG_SCALE * (double) len) : 0;
+}
+
+/*
+ * Test the trigram and letter frequency scorers, and detecting single byte xor
+ * keys with each
+ */
+static void test_text_scorer()
+{
+    const struct text_scorer *trigrams = trigram_scorer();
+    const struct text_scorer *letters = letter_frequency_scorer();
+    assert(strcmp(trigrams->name, "trigram") == 0);
+    assert(strcmp(letters->name, "letter-frequency") == 0);
+
+    // long enough to be scored in several blocks, and not a whole number
+    // of them
+    const char line[] = "It is a truth universally acknowledged, that a "
+        "single man in possession of a good fortune, must be in want of a "
+        "wife.\n";
+    size_t len = 10007;
+    uint8_t *text = malloc(len);
+    assert(text);
+    for (size_t i = 0; i < len; ++i)
+        text[i] = line[i % (sizeof line - 1)];
+    for (size_t n = 0; n <= len; n += 1 + n / 2)
+        assert(score_trigrams(text, n) == trigram_reference(text, n));
+    assert(score_trigrams(text, len) == trigram_reference(text, len));
+    assert(trigrams->score(text, len) == score_trigrams(text, len));
+
+    // english beats the same text under a wrong key, for both scorers
+    double scores[256];
+    const uint8_t key = 0x5a;
+    uint8_t ct[sizeof line];
+    for (size_t i = 0; i < sizeof line - 1; ++i)
+        ct[i] = line[i] ^ key;
+    trigrams->score_keys(ct, sizeof line - 1, scores);
+    for (size_t k = 0; k < 256; ++k) {
+        assert(k == key || scores[k] < scores[key]);
+        if (k % 37 == 0) {
+            uint8_t plain[sizeof line];
+            for (size_t i = 0; i < sizeof line - 1; ++i)
+                plain[i] = ct[i] ^ k;
+            assert(scores[k] == score_trigrams(plain, sizeof line - 1));
+        }
+    }
+    letters->score_keys(ct, sizeof line - 1, scores);
+    assert(scores[key] == letters->score((const uint8_t *) line,
+                sizeof line - 1));
+
+    // on a short text the trigram model still finds the key
+    struct xor_context ctx = { NULL, NULL, trigrams };
+    const char *shorts[] = { "the cat sat", "Cooking MC's like a pound",
+        "go away now" };
+    for (size_t i = 0; i < sizeof shorts / sizeof shorts[0]; ++i) {
+        size_t n = strlen(shorts[i]);
+        for (size_t j = 0; j < n; ++j)
+            ct[j] = shorts[i][j] ^ key;
+        assert(detect_repeated_byte_xor_ctx(&ctx, ct, n) == key);
+    }
+
+    // results found with each scorer are cached apart
+    struct memo_cache *cache = memo_cache_create(1 << 16, 1);
+    assert(cache);
+    ctx.memo = cache;
+    for (size_t j = 0; j < sizeof line - 1; ++j)
+        ct[j] = line[j] ^ key;
+    assert(detect_repeated_byte_xor_ctx(&ctx, ct, sizeof line - 1) == key);
+    ctx.scorer = NULL;
+    assert(detect_repeated_byte_xor_ctx(&ctx, ct, sizeof line - 1) == key);
+    struct memo_cache_stats stats;
+    memo_cache_get_stats(cache, &stats);
+    assert(stats.insertions == 2 && stats.hits == 0);
+    memo_cache_destroy(cache);
+
+    // columns of a repeating key are not running text, so breaking one
+    // keeps to letter frequencies
+    uint8_t raw_ct[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t raw_len = read_base64(raw_ct, cipher_text64,
+            strlen(cipher_text64));
+    uint8_t found[40];
+    ctx.memo = NULL;
+    ctx.scorer = trigrams;
+    assert(break_repeated_key_xor_ctx(&ctx, raw_ct, raw_len, found, 40) ==
+            29);
+    assert(memcmp(found, "Terminator X: Bring the noise", 29) == 0);
+    assert(score_trigrams(NULL, 5) == 0);
+    free(text);
+    printf("Text scorer test passed!\n");
+}
+
 static const char *candidates[] = {
     "0e3647e8592d35514a081243582536ed3de6734059001e3f535ce6271032",
     "334b041de124f73c18011a50e608097ac308ecee501337ec3e100854201d",
@@ -690,9 +1089,109 @@ static void test_find_repeat_byte_xor()
     decrypted[raw_size] = '\0';
     const char expected[] = "Now that the party is jumping\n";
     assert(strcmp((char *) decrypted, expected) == 0);
+
+    // scoring from hex byte counts picks the same key, with exactly the same
+    // score, as decrypting under every key and scoring the text
+    for (size_t i = 0; i < num_candidates; ++i) {
+        size_t len = strlen(candidates[i]) / 2;
+        uint8_t raw[len];
+        uint8_t text[len];
+        read_base16(raw, candidates[i], 2 * len);
+        uint8_t best_key = 0;
+        double best_score = DBL_MIN;
+        for (size_t k = 0; k < 256; ++k) {
+            repeated_byte_xor(k, raw, text, len);
+            struct letter_frequencies lfs;
+            calculate_letter_frequencies((char *) text, len, &lfs);
+            if (compare_to_english(&lfs) > best_score) {
+                best_score = compare_to_english(&lfs);
+                best_key = k;
+            }
+        }
+        double score;
+        assert(detect_repeated_byte_xor_base16(candidates[i], 2 * len, &key,
+                    &score) == 0);
+        assert(key == best_key && score == best_score);
+        assert(detect_repeated_byte_xor(raw, len) == best_key);
+    }
+    assert(detect_repeated_byte_xor_base16("4x", 2, &key, &(double) { 0 })
+            == -1);
     printf("Find repeat byte xor test passed!\n");
 }
 
+/*
+ * Test the single byte xor searches that score growing prefixes of their
+ * input and stop once the best key is clear
+ */
+static void test_sampled_byte_xor()
+{
+    // short texts are read to the end, and give the full search's key
+    const size_t num_candidates = sizeof candidates / sizeof candidates[0];
+    size_t total = 0;
+    for (size_t i = 0; i < num_candidates; ++i) {
+        size_t len = strlen(candidates[i]) / 2;
+        uint8_t raw[len];
+        read_base16(raw, candidates[i], 2 * len);
+        size_t used;
+        assert(detect_repeated_byte_xor_sampled(raw, len,
+                    XOR_SAMPLE_CONFIDENCE, &used) ==
+                detect_repeated_byte_xor(raw, len));
+        assert(used == len);
+        total += len;
+    }
+    size_t used;
+    assert(find_repeated_byte_xor_sampled(candidates, num_candidates,
+                XOR_SAMPLE_CONFIDENCE, &used) ==
+            find_repeated_byte_xor(candidates, num_candidates));
+    assert(used == total);
+
+    // a long text stops at the end of one of the prefixes
+    const char line[] = "It is a truth universally acknowledged, that a "
+        "single man in possession of a good fortune, must be in want of a "
+        "wife. However little known the feelings or views of such a man may "
+        "be on his first entering a neighbourhood, this truth is so well "
+        "fixed in the minds of the surrounding families, that he is "
+        "considered the rightful property of some one or other of their "
+        "daughters.\n";
+    size_t len = 1 << 20;
+    uint8_t *text = malloc(len);
+    char *hex = malloc(2 * len + 1);
+    assert(text && hex);
+    const uint8_t key = 0x3c;
+    for (size_t i = 0; i < len; ++i)
+        text[i] = line[i % (sizeof line - 1)] ^ key;
+    assert(detect_repeated_byte_xor_sampled(text, len, XOR_SAMPLE_CONFIDENCE,
+                &used) == key);
+    assert(used < len / 64);
+    size_t prefix = XOR_SAMPLE_FIRST;
+    while (prefix < used)
+        prefix *= XOR_SAMPLE_GROWTH;
+    assert(prefix == used);
+    assert(detect_repeated_byte_xor(text, len) == key);
+    // asking for more confidence than the text can give reads all of it
+    assert(detect_repeated_byte_xor_sampled(text, len, 1e6, &used) == key);
+    assert(used == len);
+
+    // the long candidate wins, having been read only in part
+    for (size_t i = 0; i < len; ++i)
+        sprintf(hex + 2 * i, "%02x", text[i]);
+    const char *mixed[] = { candidates[0], hex, candidates[1], "zz" };
+    assert(find_repeated_byte_xor_sampled(mixed, 4, XOR_SAMPLE_CONFIDENCE,
+                &used) == hex);
+    assert(used < len / 64);
+
+    uint32_t hist[256] = { 0 };
+    byte_histogram(hist, text, 4096);
+    assert(xor_key_leads_by(hist, 4096, key, 3));
+    assert(!xor_key_leads_by(hist, 4096, key ^ 1, 3));
+    assert(!xor_key_leads_by(hist, 0, key, 3));
+    assert(detect_repeated_byte_xor_sampled(NULL, 5, 3, &used) == 0);
+    assert(used == 0);
+    free(text);
+    free(hex);
+    printf("Sampled byte xor test passed!\n");
+}
+
 /*
  * Test the is_ecb_encrpyted function
  */
@@ -923,3 +1422,1225 @@ static void test_detect_ecb()
     printf("Detect ecb test passed!\n");
 }
 
+/*
+ * Find the ecb candidate's repeated blocks behind headers of every length,
+ * and make sure the other candidates show no repeats at any alignment
+ */
+static void test_detect_unaligned_ecb()
+{
+    const char ecb_hex[] = "d880619740a8a19b7840a8a31c810a3d08649af70dc06f4fd5d2d69c744cd283e2dd052f6b641dbf9d11b0348542bb5708649af70dc06f4fd5d2d69c744cd2839475c9dfdbc1d46597949d9c7e82bf5a08649af70dc06f4fd5d2d69c744cd28397a93eab8d6aecd566489154789a6b0308649af70dc06f4fd5d2d69c744cd283d403180c98c8f6db1f2a3f9c4040deb0ab51b29933f2c123c58386b06fba186a";
+    const size_t ecb_len = (sizeof ecb_hex - 1) / 2;
+    uint8_t buf[ecb_len + AES_BLOCK_SIZE];
+    for (size_t header = 0; header < AES_BLOCK_SIZE; ++header) {
+        memset(buf, 0x5a, header);
+        read_base16(buf + header, ecb_hex, ecb_len * 2);
+        struct ecb_alignment found;
+        size_t repeats = find_ecb_alignment(buf, header + ecb_len,
+                AES_BLOCK_SIZE, &found);
+        // the same block appears four times
+        assert(repeats == 3);
+        assert(found.offset == header);
+        assert(found.repeats == 3);
+        assert(found.first == header + 3 * AES_BLOCK_SIZE);
+    }
+
+    size_t with_repeats = 0;
+    for (size_t i = 0; i < sizeof ecb_candidates / sizeof ecb_candidates[0];
+            ++i) {
+        size_t raw_size = strlen(ecb_candidates[i]) / 2;
+        uint8_t raw[raw_size];
+        read_base16(raw, ecb_candidates[i], raw_size * 2);
+        size_t repeats = find_ecb_alignment(raw, raw_size, AES_BLOCK_SIZE,
+                NULL);
+        assert(repeats != SIZE_MAX);
+        with_repeats += repeats != 0;
+    }
+    assert(with_repeats == 1);
+
+    // a run of one byte repeats at every alignment; the earliest wins
+    memset(buf, 'A', sizeof buf);
+    struct ecb_alignment found;
+    assert(find_ecb_alignment(buf, sizeof buf, AES_BLOCK_SIZE, &found) ==
+            (sizeof buf - AES_BLOCK_SIZE) / AES_BLOCK_SIZE);
+    assert(found.offset == 0 && found.first == AES_BLOCK_SIZE);
+    // block sizes that leave no room for a repeat are rejected up front
+    assert(find_ecb_alignment(buf, sizeof buf, 0, &found) == 0);
+    assert(find_ecb_alignment(buf, sizeof buf, sizeof buf, &found) == 0);
+    assert(find_ecb_alignment(buf, sizeof buf, SIZE_MAX, &found) == 0);
+    printf("Detect unaligned ecb test passed!\n");
+}
+
+/*
+ * Test aes-128 against the FIPS-197 and SP 800-38A example vectors
+ */
+static void test_aes128()
+{
+    uint8_t key[AES128_KEY_SIZE];
+    uint8_t block[AES_BLOCK_SIZE];
+    uint8_t expected[AES_BLOCK_SIZE];
+    struct aes128_schedule ks;
+    read_base16(key, "000102030405060708090a0b0c0d0e0f", 32);
+    read_base16(block, "00112233445566778899aabbccddeeff", 32);
+    read_base16(expected, "69c4e0d86a7b0430d8cdb78070b4c55a", 32);
+    aes128_expand_key(&ks, key);
+    aes128_encrypt_block(&ks, block, block);
+    assert(memcmp(block, expected, sizeof block) == 0);
+    aes128_decrypt_block(&ks, block, block);
+    read_base16(expected, "00112233445566778899aabbccddeeff", 32);
+    assert(memcmp(block, expected, sizeof block) == 0);
+
+    uint8_t iv[AES_BLOCK_SIZE];
+    uint8_t pt[2 * AES_BLOCK_SIZE];
+    uint8_t ct[sizeof pt];
+    uint8_t cbc_expected[sizeof pt];
+    read_base16(key, "2b7e151628aed2a6abf7158809cf4f3c", 32);
+    read_base16(iv, "000102030405060708090a0b0c0d0e0f", 32);
+    read_base16(pt, "6bc1bee22e409f96e93d7e117393172a"
+            "ae2d8a571e03ac9c9eb76fac45af8e51", 64);
+    read_base16(cbc_expected, "7649abac8119b246cee98e9b12e9197d"
+            "5086cb9b507219ee95db113a917678b2", 64);
+    aes128_expand_key(&ks, key);
+    aes128_cbc_encrypt(&ks, iv, pt, ct, sizeof pt);
+    assert(memcmp(ct, cbc_expected, sizeof ct) == 0);
+    aes128_cbc_decrypt(&ks, iv, ct, ct, sizeof ct);
+    assert(memcmp(ct, pt, sizeof pt) == 0);
+
+    aes128_ecb_encrypt(&ks, pt, ct, sizeof pt);
+    aes128_ecb_decrypt(&ks, ct, ct, sizeof ct);
+    assert(memcmp(ct, pt, sizeof pt) == 0);
+    printf("AES-128 test passed!\n");
+}
+
+/*
+ * Test the expanded key cache
+ */
+static void test_key_cache()
+{
+    struct key_cache *cache = key_cache_create(2, 1);
+    assert(cache);
+    const uint8_t *yellow = (const uint8_t *) "YELLOW SUBMARINE";
+    const uint8_t *purple = (const uint8_t *) "PURPLE SUBMARINE";
+    const uint8_t *orange = (const uint8_t *) "ORANGE SUBMARINE";
+    struct aes128_schedule expected;
+    aes128_expand_key(&expected, yellow);
+
+    struct key_handle *h = key_cache_acquire(cache, yellow);
+    assert(memcmp(&h->schedule, &expected, sizeof expected) == 0);
+    key_cache_release(cache, h);
+    h = key_cache_acquire(cache, yellow);
+    assert(memcmp(&h->schedule, &expected, sizeof expected) == 0);
+
+    // yellow is pinned, so purple then orange both have to share the one
+    // remaining entry
+    struct key_handle *p = key_cache_acquire(cache, purple);
+    key_cache_release(cache, p);
+    p = key_cache_acquire(cache, orange);
+    struct key_handle *q = key_cache_acquire(cache, purple);
+
+    uint8_t pt[2 * AES_BLOCK_SIZE] = "batch of two blocks, one key...";
+    uint8_t ct1[sizeof pt], ct2[sizeof pt];
+    struct cipher_message msgs[] = {
+        { pt, ct1, sizeof pt, NULL },
+        { pt, ct2, AES_BLOCK_SIZE, NULL },
+    };
+    aes128_ecb_encrypt_batch(&h->schedule, msgs, 2);
+    assert(memcmp(ct1, ct2, AES_BLOCK_SIZE) == 0);
+    aes128_ecb_decrypt(&expected, ct1, ct1, sizeof ct1);
+    assert(memcmp(ct1, pt, sizeof pt) == 0);
+
+    key_cache_release(cache, q);
+    key_cache_release(cache, p);
+    key_cache_release(cache, h);
+
+    struct key_cache_stats stats;
+    key_cache_get_stats(cache, &stats);
+    assert(stats.hits == 1);
+    assert(stats.misses == 4);
+    assert(stats.evictions == 1);
+    assert(stats.uncached == 1);
+    key_cache_destroy(cache);
+    printf("Key cache test passed!\n");
+}
+
+// Shared state for memo_readers
+struct memo_read_job {
+    struct memo_cache *cache;
+    const struct memo_key *keys;
+    size_t num_keys;
+};
+
+/*
+ * Look every key of a job up, checking that each result is its index
+ */
+static void memo_readers(void *arg, size_t begin, size_t end)
+{
+    struct memo_read_job *job = arg;
+    for (size_t i = begin; i < end; ++i) {
+        uint8_t value[MEMO_VALUE_MAX];
+        size_t k = i % job->num_keys;
+        assert(memo_cache_get(job->cache, &job->keys[k], value) == 1);
+        assert(value[0] == k);
+    }
+}
+
+/*
+ * Test the result cache: its hash, eviction, concurrent lookups, and the xor
+ * searches answered from it
+ */
+static void test_memo_cache()
+{
+    // reference MurmurHash3_x64_128 outputs
+    uint64_t h[2];
+    murmur3_128("", 0, 0, h);
+    assert(h[0] == 0 && h[1] == 0);
+    murmur3_128("hello", 5, 0, h);
+    assert(h[0] == 0xcbd8a7b341bd9b02ULL && h[1] == 0x5b1e906a48ae1d19ULL);
+    const char *fox = "The quick brown fox jumps over the lazy dog";
+    murmur3_128(fox, strlen(fox), 42, h);
+    assert(h[0] == 0x740dcf93fe0bd5d7ULL && h[1] == 0xc4546cf4ec705c8fULL);
+
+    // operation and parameters are part of the key
+    struct memo_key a = memo_key(1, 0, fox, strlen(fox));
+    struct memo_key b = memo_key(2, 0, fox, strlen(fox));
+    struct memo_key c = memo_key(1, 1, fox, strlen(fox));
+    assert(a.hash[0] != b.hash[0] && a.hash[0] != c.hash[0]);
+
+    assert(memo_cache_create(100, 1) == NULL);
+    assert(memo_cache_create(4096, 0) == NULL);
+    // one set of 8 entries
+    struct memo_cache *cache = memo_cache_create(512, 1);
+    assert(cache);
+    struct memo_cache_stats st;
+    memo_cache_get_stats(cache, &st);
+    assert(st.capacity == 8);
+    struct memo_key keys[12];
+    uint8_t value[MEMO_VALUE_MAX];
+    for (uint8_t i = 0; i < 12; ++i)
+        keys[i] = memo_key(1, i, fox, strlen(fox));
+    assert(memo_cache_get(cache, &keys[0], value) == SIZE_MAX);
+    for (uint8_t i = 0; i < 8; ++i)
+        assert(memo_cache_put(cache, &keys[i], &i, 1) == 0);
+    assert(memo_cache_put(cache, &keys[0], value, MEMO_VALUE_MAX + 1) == -1);
+    // entries that were read survive the next round of evictions
+    for (uint8_t i = 0; i < 4; ++i)
+        assert(memo_cache_get(cache, &keys[i], value) == 1 && value[0] == i);
+    for (uint8_t i = 8; i < 12; ++i)
+        assert(memo_cache_put(cache, &keys[i], &i, 1) == 0);
+    for (uint8_t i = 0; i < 12; ++i) {
+        size_t size = memo_cache_get(cache, &keys[i], value);
+        if (i >= 4 && i < 8)
+            assert(size == SIZE_MAX);
+        else
+            assert(size == 1 && value[0] == i);
+    }
+    memo_cache_get_stats(cache, &st);
+    assert(st.insertions == 12 && st.evictions == 4);
+    assert(st.hits == 12 && st.misses == 5);
+    memo_cache_destroy(cache);
+
+    // lookups from several threads at once
+    cache = memo_cache_create(64 * 1024, 4);
+    assert(cache);
+    for (uint8_t i = 0; i < 12; ++i)
+        memo_cache_put(cache, &keys[i], &i, 1);
+    struct memo_read_job job = { cache, keys, 12 };
+    thread_pool_parallel_for(NULL, 0, 12000, 100, 0, memo_readers, &job);
+    memo_cache_get_stats(cache, &st);
+    assert(st.hits == 12000 && st.misses == 0);
+
+    // repeated analyses of the same input are answered from the cache
+    struct xor_context ctx = { NULL, cache, NULL };
+    uint8_t raw_ct[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t len = read_base64(raw_ct, cipher_text64, strlen(cipher_text64));
+    uint8_t key[40];
+    uint8_t again[40];
+    assert(break_repeated_key_xor_ctx(&ctx, raw_ct, len, key, 40) == 29);
+    assert(break_repeated_key_xor_ctx(&ctx, raw_ct, len, again, 40) == 29);
+    assert(memcmp(key, again, 29) == 0);
+    uint8_t byte_key = detect_repeated_byte_xor_ctx(&ctx, raw_ct, 100);
+    assert(detect_repeated_byte_xor_ctx(&ctx, raw_ct, 100) == byte_key);
+    assert(byte_key == detect_repeated_byte_xor(raw_ct, 100));
+    memo_cache_get_stats(cache, &st);
+    assert(st.hits == 12002 && st.misses == 2);
+    memo_cache_destroy(cache);
+    printf("Memo cache test passed!\n");
+}
+
+// ecb_oracle_fn with 128-byte blocks, larger than the attack handles, whose
+// "cipher" leaves each block as it is: the input, then 100 secret bytes, then
+// padding
+static size_t wide_block_oracle(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size)
+{
+    (void) ctx;
+    size_t n = ((len + 100) / 128 + 1) * 128;
+    if (n > out_size)
+        return n;
+    memcpy(out, input, len);
+    for (size_t i = len; i < n; ++i)
+        out[i] = i < len + 100 ? 's' : (uint8_t) (n - len - 100);
+    return n;
+}
+
+/*
+ * Test recovering the secret appended by an ecb oracle, with and without an
+ * unaligned prefix
+ */
+static void test_ecb_byte_at_a_time()
+{
+    const char secret[] = "Rollin' in my 5.0\nWith my rag-top down so my hair "
+        "can blow\nThe girlies on standby waving just to say hi\n"
+        "Did you stop? No, I just drove by\n";
+    // a prefix ending in the attack's own filler bytes must not confuse it
+    const char prefix[] = "AAAAa random-length prefix";
+    const size_t prefix_lens[] = { 0, 4, 13, sizeof prefix - 1 };
+    const size_t secret_len = sizeof secret - 1;
+    const uint8_t *key = (const uint8_t *) "YELLOW SUBMARINE";
+    for (size_t i = 0; i < sizeof prefix_lens / sizeof prefix_lens[0]; ++i) {
+        size_t prefix_len = prefix_lens[i];
+        struct aes_ecb_oracle aes;
+        aes_ecb_oracle_init(&aes, key, (const uint8_t *) prefix, prefix_len,
+                (const uint8_t *) secret, secret_len);
+        struct ecb_oracle oracle = { aes_ecb_oracle_encrypt, &aes };
+        uint8_t recovered[sizeof secret] = { 0 };
+        struct ecb_attack_stats stats;
+        size_t len = ecb_decrypt_appended_secret(&oracle, recovered,
+                sizeof recovered, &stats);
+        assert(len == secret_len);
+        assert(memcmp(recovered, secret, secret_len) == 0);
+        assert(stats.block_size == AES_BLOCK_SIZE);
+        assert(stats.prefix_len == prefix_len);
+        assert(stats.secret_len == secret_len);
+        // one call per byte plus at most 2 * block_size + 2 to find the
+        // block size and prefix length
+        assert(stats.oracle_calls <= secret_len + 2 * AES_BLOCK_SIZE + 2);
+    }
+    // blocks larger than the attack's buffers are refused
+    struct ecb_oracle wide = { wide_block_oracle, NULL };
+    uint8_t recovered[16];
+    assert(ecb_decrypt_appended_secret(&wide, recovered, sizeof recovered,
+                NULL) == 0);
+    printf("ECB byte-at-a-time test passed!\n");
+}
+
+// Reply checker for pipelined encryption queries, answered in order
+struct pipeline_check {
+    struct aes_ecb_oracle *expected;
+    size_t answered;
+};
+
+static void check_pipelined_reply(void *ctx, const struct oracle_frame *reply)
+{
+    struct pipeline_check *check = ctx;
+    uint8_t input[40];
+    uint8_t expected[128];
+    size_t len = check->answered++ % sizeof input;
+    memset(input, 'A', len);
+    size_t ct_len = aes_ecb_oracle_encrypt(check->expected, input, len,
+            expected, sizeof expected);
+    assert(reply->code == ORACLE_STATUS_OK);
+    assert(reply->len == ct_len);
+    assert(memcmp(reply->payload, expected, ct_len) == 0);
+}
+
+// Reply checker for a batch of three padding checks
+static void check_batch_reply(void *ctx, const struct oracle_frame *reply)
+{
+    const uint8_t expected_status[] = { ORACLE_STATUS_OK, ORACLE_STATUS_OK,
+        ORACLE_STATUS_BAD_REQUEST };
+    const uint8_t expected_valid[] = { 1, 0 };
+    assert(reply->code == ORACLE_STATUS_OK);
+    assert(reply->len >= 4 && oracle_get_u32(reply->payload) == 3);
+    size_t pos = 4;
+    for (size_t i = 0; i < 3; ++i) {
+        struct oracle_frame entry;
+        size_t used = oracle_parse_entry(reply->payload + pos,
+                reply->len - pos, &entry);
+        assert(used != SIZE_MAX);
+        assert(entry.code == expected_status[i]);
+        if (entry.code == ORACLE_STATUS_OK)
+            assert(entry.len == 1 && entry.payload[0] == expected_valid[i]);
+        pos += used;
+    }
+    assert(pos == reply->len);
+    ++*(int *) ctx;
+}
+
+static void *run_oracle_server(void *server)
+{
+    assert(oracle_server_run(server) == 0);
+    return NULL;
+}
+
+/*
+ * Run a local oracle server in a thread and query it through the client
+ * library: single calls, a pipeline of queries, a batch, and a full
+ * byte-at-a-time attack over the socket
+ */
+/*
+ * Send an oracle server a pile of requests and hang up without reading the
+ * replies, so that the server writes to a closed socket
+ */
+static void hang_up_early(const char *path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof addr.sun_path - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    assert(fd >= 0);
+    assert(connect(fd, (struct sockaddr *) &addr, sizeof addr) == 0);
+    struct byte_buf requests = { NULL, 0, 0, 0 };
+    for (uint32_t tag = 0; tag < 64; ++tag)
+        assert(oracle_append_frame(&requests, ORACLE_OP_ENCRYPT, tag,
+                    (const uint8_t *) "hello", 5) == 0);
+    assert(write(fd, requests.data, requests.len) == (ssize_t) requests.len);
+    byte_buf_free(&requests);
+    close(fd);
+}
+
+static void test_oracle_server()
+{
+    const char secret[] = "Rollin' in my 5.0\nWith my rag-top down so my hair "
+        "can blow\n";
+    const char prefix[] = "pfx";
+    struct oracle_server_config config;
+    memset(&config, 0, sizeof config);
+    memcpy(config.key, "YELLOW SUBMARINE", AES128_KEY_SIZE);
+    config.prefix = (const uint8_t *) prefix;
+    config.prefix_len = sizeof prefix - 1;
+    config.secret = (const uint8_t *) secret;
+    config.secret_len = sizeof secret - 1;
+    struct aes_ecb_oracle local;
+    aes_ecb_oracle_init(&local, config.key, config.prefix, config.prefix_len,
+            config.secret, config.secret_len);
+
+    char path[64];
+    snprintf(path, sizeof path, "/tmp/matasano-test-%ld.sock",
+            (long) getpid());
+    // a file that isn't a socket is never replaced
+    FILE *f = fopen(path, "w");
+    assert(f);
+    fclose(f);
+    errno = 0;
+    assert(!oracle_server_create(path, &config) && errno == EADDRINUSE);
+    assert(access(path, F_OK) == 0);
+    assert(unlink(path) == 0);
+    struct oracle_server *server = oracle_server_create(path, &config);
+    assert(server);
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, run_oracle_server, server) == 0);
+    // a peer that goes away before its replies doesn't take the server's
+    // process down with SIGPIPE
+    hang_up_early(path);
+    struct oracle_client *client = oracle_client_connect(path);
+    assert(client);
+
+    // one synchronous encryption
+    uint8_t out[128];
+    uint8_t expected[128];
+    size_t len;
+    assert(oracle_client_call(client, ORACLE_OP_ENCRYPT,
+                (const uint8_t *) "hello", 5, out, sizeof out, &len) ==
+            ORACLE_STATUS_OK);
+    assert(len == aes_ecb_oracle_encrypt(&local, (const uint8_t *) "hello", 5,
+                expected, sizeof expected));
+    assert(memcmp(out, expected, len) == 0);
+
+    // a pipeline never holds more than depth requests
+    struct pipeline_check check = { &local, 0 };
+    uint8_t input[40];
+    memset(input, 'A', sizeof input);
+    oracle_client_set_depth(client, 8);
+    for (size_t i = 0; i < 100; ++i) {
+        assert(oracle_client_submit(client, ORACLE_OP_ENCRYPT, input,
+                    i % sizeof input, check_pipelined_reply, &check) == 0);
+        assert(oracle_client_outstanding(client) <= 8);
+    }
+    assert(oracle_client_wait(client, 0) == 0);
+    assert(check.answered == 100);
+
+    // cbc decryption and padding checks; "attack at dawn" pads with 2 2, so
+    // flipping the low bit of the last iv byte makes the padding 2 3
+    struct aes128_schedule ks;
+    aes128_expand_key(&ks, config.key);
+    uint8_t valid[2 * AES_BLOCK_SIZE] = "0123456789abcdefattack at dawn";
+    pkcs7_pad(valid + AES_BLOCK_SIZE, 14, AES_BLOCK_SIZE);
+    aes128_cbc_encrypt(&ks, valid, valid + AES_BLOCK_SIZE,
+            valid + AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    uint8_t invalid[sizeof valid];
+    memcpy(invalid, valid, sizeof valid);
+    invalid[AES_BLOCK_SIZE - 1] ^= 1;
+    assert(oracle_client_call(client, ORACLE_OP_DECRYPT, valid, sizeof valid,
+                out, sizeof out, &len) == ORACLE_STATUS_OK);
+    assert(len == 14 && memcmp(out, "attack at dawn", 14) == 0);
+    assert(oracle_client_call(client, ORACLE_OP_DECRYPT, invalid,
+                sizeof invalid, out, sizeof out, &len) ==
+            ORACLE_STATUS_BAD_PADDING);
+    assert(oracle_client_call(client, ORACLE_OP_PADDING_CHECK, valid,
+                sizeof valid, out, sizeof out, &len) == ORACLE_STATUS_OK);
+    assert(len == 1 && out[0] == 1);
+
+    // a batch answers each entry separately; the truncated one is rejected
+    const uint8_t *payloads[] = { valid, invalid, valid };
+    const size_t lens[] = { sizeof valid, sizeof invalid, AES_BLOCK_SIZE };
+    int batches = 0;
+    assert(oracle_client_submit_batch(client, ORACLE_OP_PADDING_CHECK,
+                payloads, lens, 3, check_batch_reply, &batches) == 0);
+    assert(oracle_client_wait(client, 0) == 0);
+    assert(batches == 1);
+
+    // the ecb attack runs unchanged against the remote oracle
+    struct ecb_oracle oracle = { oracle_client_ecb_encrypt, client };
+    uint8_t recovered[sizeof secret] = { 0 };
+    struct ecb_attack_stats stats;
+    assert(ecb_decrypt_appended_secret(&oracle, recovered, sizeof recovered,
+                &stats) == sizeof secret - 1);
+    assert(memcmp(recovered, secret, sizeof secret - 1) == 0);
+    assert(stats.prefix_len == sizeof prefix - 1);
+
+    // so does the padding oracle attack, one batch frame per guess batch,
+    // both a batch at a time and with several batches in flight
+    struct padding_oracle padding = { oracle_client_padding_check, client,
+        NULL, NULL, 0 };
+    struct padding_attack_stats one_by_one, pipelined;
+    assert(cbc_padding_oracle_decrypt(&padding, valid, valid + AES_BLOCK_SIZE,
+                out, AES_BLOCK_SIZE, 1, 4, &one_by_one) == 14);
+    assert(memcmp(out, "attack at dawn", 14) == 0);
+    padding.submit = oracle_client_padding_submit;
+    padding.wait = oracle_client_padding_wait;
+    padding.depth = 8;
+    memset(out, 0, sizeof out);
+    assert(cbc_padding_oracle_decrypt(&padding, valid, valid + AES_BLOCK_SIZE,
+                out, AES_BLOCK_SIZE, 1, 4, &pipelined) == 14);
+    assert(memcmp(out, "attack at dawn", 14) == 0);
+    assert(pipelined.oracle_queries >= one_by_one.oracle_queries);
+
+    oracle_client_close(client);
+    oracle_server_stop(server);
+    assert(pthread_join(thread, NULL) == 0);
+    oracle_server_destroy(server);
+    assert(access(path, F_OK) != 0);
+    printf("Oracle server test passed!\n");
+}
+
+// padding_submit_fn and padding_wait_fn over an in-process oracle, which
+// answers each batch as soon as it is submitted
+static int submit_padding_now(void *ctx, const uint8_t *queries, size_t num,
+        uint8_t *valid)
+{
+    return aes_cbc_padding_oracle_check(ctx, queries, num, valid);
+}
+
+static int wait_padding_now(void *ctx)
+{
+    (void) ctx;
+    return 0;
+}
+
+/*
+ * Decrypt cbc ciphertexts through an in-process padding oracle, with and
+ * without worker threads and pipelined batches, and check that likelihood
+ * ordering keeps english plaintext cheap
+ */
+static void test_padding_oracle()
+{
+    const char text[] = "000000Now that the party is jumping\n"
+        "000001With the bass kicked in and the Vega's are pumpin'\n";
+    const size_t text_len = sizeof text - 1;
+    const uint8_t *key = (const uint8_t *) "YELLOW SUBMARINE";
+    const uint8_t iv[AES_BLOCK_SIZE] = "an iv of 16 byte";
+    struct aes128_schedule ks;
+    aes128_expand_key(&ks, key);
+    uint8_t ct[sizeof text + AES_BLOCK_SIZE];
+    memcpy(ct, text, text_len);
+    size_t ct_len = pkcs7_pad(ct, text_len, AES_BLOCK_SIZE);
+    aes128_cbc_encrypt(&ks, iv, ct, ct, ct_len);
+
+    struct aes_cbc_padding_oracle aes;
+    aes_cbc_padding_oracle_init(&aes, key);
+    struct padding_oracle oracle = { aes_cbc_padding_oracle_check, &aes,
+        NULL, NULL, 0 };
+    const size_t workers[] = { 1, 4 };
+    const size_t batches[] = { 1, 16, 256 };
+    for (size_t i = 0; i < 2 * sizeof workers / sizeof workers[0]; ++i) {
+        size_t w = i / 2;
+        // odd rounds keep several batches in flight
+        oracle.submit = i % 2 ? submit_padding_now : NULL;
+        oracle.wait = i % 2 ? wait_padding_now : NULL;
+        for (size_t b = 0; b < sizeof batches / sizeof batches[0]; ++b) {
+            uint8_t plain[sizeof ct];
+            struct padding_attack_stats stats;
+            size_t len = cbc_padding_oracle_decrypt(&oracle, iv, ct, plain,
+                    ct_len, workers[w], batches[b], &stats);
+            assert(len == text_len);
+            assert(memcmp(plain, text, text_len) == 0);
+            assert(stats.blocks == ct_len / AES_BLOCK_SIZE);
+            assert(stats.bytes == ct_len);
+            assert(stats.oracle_queries >= ct_len);
+            // at most two guesses can pass for the last byte, and each
+            // needs a confirming query
+            assert(stats.max_byte_queries <= 256 + 2);
+            // uniformly ordered guesses would average over 128 per byte
+            if (batches[b] == 1 && !oracle.submit)
+                assert(stats.queries_per_byte < 24);
+        }
+    }
+
+    // the attack fails cleanly on a ciphertext with invalid padding
+    uint8_t bad[AES_BLOCK_SIZE] = { 0 };
+    uint8_t plain[AES_BLOCK_SIZE];
+    size_t len = cbc_padding_oracle_decrypt(&oracle, iv, bad, plain,
+            sizeof bad, 1, 0, NULL);
+    assert(len == SIZE_MAX || len < AES_BLOCK_SIZE);
+    printf("Padding oracle test passed!\n");
+}
+
+/*
+ * Run every kernel level the cpu supports against the portable code
+ */
+static void test_cpu_dispatch()
+{
+    struct cpu_dispatch_info info;
+    cpu_dispatch_get_info(&info);
+    const enum cpu_level restore = info.active;
+
+    uint8_t a[300], b[300];
+    char hex[2 * sizeof a];
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < sizeof a; ++i) {
+        seed = seed * 1103515245 + 12345;
+        a[i] = seed >> 16;
+        b[i] = seed >> 24;
+    }
+    for (size_t i = 0; i < sizeof a; ++i)
+        sprintf(hex + 2 * i, i % 3 ? "%02x" : "%02X", a[i]);
+
+    struct aes128_schedule ks;
+    uint8_t key[AES128_KEY_SIZE] = "YELLOW SUBMARINE";
+    aes128_expand_key(&ks, key);
+    const size_t aes_len = 9 * AES_BLOCK_SIZE;
+    uint8_t ecb_ref[9 * AES_BLOCK_SIZE], cbc_ref[9 * AES_BLOCK_SIZE];
+    cpu_dispatch_set_level(CPU_LEVEL_SCALAR);
+    aes128_ecb_encrypt(&ks, a, ecb_ref, aes_len);
+    aes128_cbc_decrypt(&ks, b, a, cbc_ref, aes_len);
+
+    for (enum cpu_level level = CPU_LEVEL_SCALAR; level <= info.detected;
+            ++level) {
+        assert(cpu_dispatch_set_level(level) == level);
+        uint8_t out[sizeof a], expected[sizeof a];
+        for (size_t len = 0; len <= sizeof a; len += 1 + len / 8) {
+            uint32_t bits = 0;
+            for (size_t i = 0; i < len; ++i) {
+                expected[i] = a[i] ^ b[i];
+                bits += __builtin_popcount(expected[i]);
+            }
+            fixed_xor(out, a, b, len);
+            assert(memcmp(out, expected, len) == 0);
+            assert(hamming_distance(a, b, len) == bits);
+
+            memset(out, 0, sizeof out);
+            read_base16(out, hex, 2 * len);
+            assert(memcmp(out, a, len) == 0);
+
+            assert(score_trigrams(a, len) == trigram_reference(a, len));
+
+            const size_t key_sizes[] = { 1, 2, 3, 7, 8, 14, 27, 31, 32, 33,
+                40, 64, 128, 256 };
+            for (size_t s = 0; s < sizeof key_sizes / sizeof key_sizes[0];
+                    ++s) {
+                size_t key_size = key_sizes[s];
+                for (size_t i = 0; i < len; ++i)
+                    expected[i] = a[i] ^ b[i % key_size];
+                repeated_key_xor(b, key_size, a, out, len);
+                assert(memcmp(out, expected, len) == 0);
+            }
+        }
+
+        // long enough for a whole run of every key size's vectors, and
+        // then some; in place, as the stream decoder does
+        enum { LONG_LEN = 4 * 1024 + 77 };
+        uint8_t *text = malloc(2 * LONG_LEN);
+        assert(text);
+        for (size_t key_size = 1; key_size <= 256; ++key_size) {
+            if (key_size > 34 && key_size != 64 && key_size != 128 &&
+                    key_size != 255 && key_size != 256)
+                continue;
+            for (size_t i = 0; i < LONG_LEN; ++i) {
+                text[i] = a[i % sizeof a] + i / sizeof a;
+                text[LONG_LEN + i] = text[i] ^ b[i % key_size];
+            }
+            repeated_key_xor(b, key_size, text, text, LONG_LEN);
+            assert(memcmp(text, text + LONG_LEN, LONG_LEN) == 0);
+        }
+        free(text);
+
+        uint8_t ct[9 * AES_BLOCK_SIZE];
+        aes128_ecb_encrypt(&ks, a, ct, aes_len);
+        assert(memcmp(ct, ecb_ref, aes_len) == 0);
+        aes128_ecb_decrypt(&ks, ct, ct, aes_len);
+        assert(memcmp(ct, a, aes_len) == 0);
+        memcpy(ct, a, aes_len);
+        aes128_cbc_decrypt(&ks, b, ct, ct, aes_len);
+        assert(memcmp(ct, cbc_ref, aes_len) == 0);
+    }
+
+    // every level stops decoding at the same bad character
+    char bad[2 * sizeof a];
+    memcpy(bad, hex, sizeof bad);
+    bad[203] = 'g';
+    uint8_t ref[sizeof a];
+    memset(ref, 0, sizeof ref);
+    cpu_dispatch_set_level(CPU_LEVEL_SCALAR);
+    read_base16(ref, bad, sizeof bad);
+    for (enum cpu_level level = CPU_LEVEL_SSE42; level <= info.detected;
+            ++level) {
+        uint8_t out[sizeof a];
+        memset(out, 0, sizeof out);
+        cpu_dispatch_set_level(level);
+        read_base16(out, bad, sizeof bad);
+        assert(memcmp(out, ref, sizeof ref) == 0);
+    }
+
+    cpu_dispatch_set_level(restore);
+    cpu_dispatch_get_info(&info);
+    printf("CPU dispatch test passed! (%s: xor %s, popcount %s, hex %s, "
+            "aes %s, trigram %s, key xor %s, hamming %s)\n",
+            cpu_level_name(info.active), info.xor_kernel,
+            info.popcount_kernel, info.hex_kernel, info.aes_kernel,
+            info.trigram_kernel, info.key_xor_kernel, info.hamming_kernel);
+}
+
+/*
+ * Decode some hex on another thread, to check that counters outlive it
+ */
+static void *stats_worker(void *arg)
+{
+    uint8_t raw[16];
+    read_base16(raw, arg, 32);
+    return NULL;
+}
+
+/*
+ * Test the hot-path counters, or that they're absent when compiled out
+ */
+static void test_stats()
+{
+    const char *hex = "00112233445566778899aabbccddeeff";
+    uint8_t raw[16];
+    uint8_t blocks[64] = { 0 };
+    struct stats_totals t;
+
+    for (size_t i = 1; i < STATS_BUCKETS; ++i)
+        assert(stats_bucket_floor(i) > stats_bucket_floor(i - 1));
+    assert(strcmp(stats_fn_name(STATS_IS_ECB_ENCRYPTED),
+                "is_ecb_encrypted") == 0);
+
+    stats_reset();
+    for (size_t i = 0; i < 3 * STATS_SAMPLE_RATE; ++i)
+        read_base16(raw, hex, 32);
+    pthread_t thread;
+    assert(pthread_create(&thread, NULL, stats_worker, (void *) hex) == 0);
+    pthread_join(thread, NULL);
+    assert(is_ecb_encrypted(blocks, sizeof blocks) == 1);
+    detect_repeated_byte_xor(blocks, sizeof blocks);
+
+    stats_snapshot(STATS_READ_BASE16, &t);
+    if (stats_enabled()) {
+        assert(t.calls == 3 * STATS_SAMPLE_RATE + 1);
+        assert(t.bytes == 32 * t.calls);
+        assert(t.timed >= 3 && t.timed <= 4);
+        uint64_t in_buckets = 0;
+        for (size_t i = 0; i < STATS_BUCKETS; ++i)
+            in_buckets += t.hist[i];
+        assert(in_buckets == t.timed);
+        stats_snapshot(STATS_IS_ECB_ENCRYPTED, &t);
+        assert(t.calls == 1 && t.bytes == sizeof blocks);
+        stats_snapshot(STATS_DETECT_REPEATED_BYTE_XOR, &t);
+        assert(t.calls == 1 && t.keys == 256);
+        stats_reset();
+        stats_snapshot(STATS_READ_BASE16, &t);
+        assert(t.calls == 0 && t.timed == 0);
+    } else {
+        assert(t.calls == 0 && t.bytes == 0);
+    }
+
+    FILE *json = tmpfile();
+    assert(json && stats_dump_json(json) == 0);
+    rewind(json);
+    char line[64];
+    assert(fgets(line, sizeof line, json) && strcmp(line, "{\n") == 0);
+    fclose(json);
+
+    if (stats_enabled()) {
+        char path[] = "/tmp/stats_testXXXXXX";
+        int fd = mkstemp(path);
+        assert(fd >= 0);
+        close(fd);
+        // a failed install is rolled back, so it can be retried
+        assert(stats_dump_on_signal(SIGKILL, path) == -1);
+        assert(stats_dump_on_signal(SIGUSR1, path) == 0);
+        assert(stats_dump_on_signal(SIGUSR1, path) == -1);
+        raise(SIGUSR1);
+        FILE *f = NULL;
+        for (int tries = 0; tries < 1000 && !(f && fgets(line, sizeof line,
+                        f)); ++tries) {
+            if (f)
+                fclose(f);
+            nanosleep(&(struct timespec) { 0, 1000000 }, NULL);
+            f = fopen(path, "r");
+        }
+        assert(f && strcmp(line, "{\n") == 0);
+        fclose(f);
+        unlink(path);
+    } else {
+        assert(stats_dump_on_signal(SIGUSR1, NULL) == -1);
+    }
+    printf("Stats test passed! (%s)\n",
+            stats_enabled() ? "enabled" : "compiled out");
+}
+
+/*
+ * Check that the tracepoint notes made it into the binary, by looking for
+ * each probe's provider and name strings
+ */
+static void test_probes()
+{
+#ifdef MATASANO_PROBES_ENABLED
+    const char *names[] = {
+        "read_base16__entry", "read_base16__return",
+        "read_base64__entry", "read_base64__return",
+        "detect_repeated_byte_xor__entry", "detect_repeated_byte_xor__return",
+        "break_repeated_key_xor__entry", "break_repeated_key_xor__return",
+        "find_likely_key_size__entry", "find_likely_key_size__return",
+        "is_ecb_encrypted__entry", "is_ecb_encrypted__return",
+    };
+    FILE *exe = fopen("/proc/self/exe", "rb");
+    assert(exe);
+    fseek(exe, 0, SEEK_END);
+    long size = ftell(exe);
+    rewind(exe);
+    char *image = malloc(size);
+    assert(image && fread(image, 1, size, exe) == (size_t) size);
+    fclose(exe);
+    for (size_t n = 0; n < sizeof names / sizeof names[0]; ++n) {
+        char needle[64];
+        int len = snprintf(needle, sizeof needle, "matasano%c%s", 0,
+                names[n]) + 1;
+        int found = 0;
+        for (long i = 0; i + len <= size && !found; ++i)
+            found = memcmp(image + i, needle, len) == 0;
+        assert(found);
+    }
+    free(image);
+    printf("Probes test passed!\n");
+#else
+    printf("Probes test skipped, probes compiled out\n");
+#endif
+}
+
+/*
+ * Run detect_repeated_byte_xor on a large input, on a thread whose stack is
+ * much smaller than the input
+ */
+static void *arena_worker(void *arg)
+{
+    size_t len = 1 << 20;
+    uint8_t *big = malloc(len);
+    assert(big);
+    for (size_t i = 0; i < len; ++i)
+        big[i] = "the quick brown fox "[i % 20] ^ 0x5a;
+    *(uint8_t *) arg = detect_repeated_byte_xor(big, len);
+    free(big);
+    return NULL;
+}
+
+/*
+ * Test the scratch arena, and that the xor pipeline reuses it
+ */
+static void test_arena()
+{
+    struct arena *arena = arena_create(256);
+    assert(arena);
+    struct arena_mark start = arena_get_mark(arena);
+    uint8_t *a = arena_alloc(arena, 1);
+    uint8_t *b = arena_alloc(arena, 100);
+    assert(a && b && b != a);
+    assert((uintptr_t) a % ARENA_ALIGN == 0 && (uintptr_t) b % ARENA_ALIGN == 0);
+    struct arena_mark mark = arena_get_mark(arena);
+    uint8_t *big = arena_alloc(arena, 4096);     // spills into a new chunk
+    assert(big && (uintptr_t) big % ARENA_ALIGN == 0);
+    memset(big, 0xff, 4096);
+    struct arena_stats st;
+    arena_get_stats(arena, &st);
+    assert(st.chunk_allocs == 2 && st.capacity >= 256 + 4096);
+    arena_reset(arena, mark);
+    assert(arena_alloc(arena, 4096) == big);
+    arena_reset(arena, start);
+    assert(arena_alloc(arena, 1) == a);
+    arena_get_stats(arena, &st);
+    assert(st.used == ARENA_ALIGN && st.chunk_allocs == 2);
+
+    // once warmed up, breaking the same kind of input allocates nothing
+    struct xor_context ctx = { arena, NULL, NULL };
+    uint8_t raw_ct[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t len = read_base64(raw_ct, cipher_text64, strlen(cipher_text64));
+    uint8_t key[40];
+    arena_reset(arena, start);
+    assert(break_repeated_key_xor_ctx(&ctx, raw_ct, len, key, 40) == 29);
+    arena_get_stats(arena, &st);
+    uint64_t allocs = st.chunk_allocs;
+    assert(st.used == 0);
+    for (int i = 0; i < 3; ++i) {
+        assert(break_repeated_key_xor_ctx(&ctx, raw_ct, len, key, 40) == 29);
+        assert(strncmp((char *) key, "Terminator X: Bring the noise", 29)
+                == 0);
+    }
+    assert(find_repeated_byte_xor_ctx(&ctx, candidates,
+                sizeof candidates / sizeof candidates[0]) ==
+            find_repeated_byte_xor(candidates,
+                sizeof candidates / sizeof candidates[0]));
+    arena_get_stats(arena, &st);
+    assert(st.chunk_allocs == allocs && st.used == 0);
+    arena_destroy(arena);
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 64 * 1024);
+    pthread_t thread;
+    uint8_t found = 0;
+    assert(pthread_create(&thread, &attr, arena_worker, &found) == 0);
+    pthread_join(thread, NULL);
+    pthread_attr_destroy(&attr);
+    assert(found == 0x5a);
+    printf("Arena test passed!\n");
+}
+
+// Shared state for the thread pool tests
+struct pool_test {
+    uint64_t sum;
+    size_t calls;
+    pthread_t caller;
+    int off_caller;
+    struct thread_pool *pool;
+};
+
+// Add up the indices of a range
+static void sum_range(void *arg, size_t begin, size_t end)
+{
+    struct pool_test *t = arg;
+    uint64_t sum = 0;
+    for (size_t i = begin; i < end; ++i)
+        sum += i;
+    __atomic_add_fetch(&t->sum, sum, __ATOMIC_RELAXED);
+    if (!pthread_equal(pthread_self(), t->caller))
+        __atomic_store_n(&t->off_caller, 1, __ATOMIC_RELAXED);
+}
+
+// Run a parallel_for inside each index of an outer one
+static void nested_range(void *arg, size_t begin, size_t end)
+{
+    struct pool_test *t = arg;
+    for (size_t i = begin; i < end; ++i) {
+        struct pool_test inner = { 0, 0, pthread_self(), 0, NULL };
+        thread_pool_parallel_for(t->pool, 0, 1000, 10, 0, sum_range, &inner);
+        assert(inner.sum == 999 * 1000 / 2);
+        __atomic_add_fetch(&t->sum, inner.sum, __ATOMIC_RELAXED);
+    }
+}
+
+// Count a submitted task
+static void count_task(void *arg)
+{
+    struct pool_test *t = arg;
+    __atomic_add_fetch(&t->calls, 1, __ATOMIC_RELAXED);
+}
+
+// Count a submitted task after a pause, so it outlives its submitter
+static void slow_count_task(void *arg)
+{
+    nanosleep(&(struct timespec) { 0, 1000000 }, NULL);
+    count_task(arg);
+}
+
+// Tasks submitted from a thread that exits before they run
+struct orphan_tasks {
+    struct pool_test *t;
+    struct thread_pool_group *group;
+};
+
+static void *submit_and_exit(void *arg)
+{
+    struct orphan_tasks *o = arg;
+    for (int i = 0; i < 32; ++i)
+        assert(thread_pool_submit(o->t->pool, o->group, slow_count_task,
+                    o->t) == 0);
+    return NULL;
+}
+
+/*
+ * Test the thread pool directly, and that the batch functions built on it
+ * give the same results however many threads they are allowed
+ */
+static void test_thread_pool()
+{
+    struct thread_pool_options opts = { 3, 0, 0 };
+    struct thread_pool *pool = thread_pool_create(&opts);
+    assert(pool && thread_pool_size(pool) == 3);
+
+    struct pool_test t = { 0, 0, pthread_self(), 0, pool };
+    thread_pool_parallel_for(pool, 0, 100000, 64, 0, sum_range, &t);
+    assert(t.sum == (uint64_t) 99999 * 100000 / 2);
+
+    // a limit of one runs everything on the caller
+    t.sum = 0;
+    t.off_caller = 0;
+    thread_pool_parallel_for(pool, 5, 1005, 1, 1, sum_range, &t);
+    assert(t.sum == (uint64_t) (5 + 1004) * 1000 / 2 && !t.off_caller);
+
+    t.sum = 0;
+    thread_pool_parallel_for(pool, 0, 16, 1, 0, nested_range, &t);
+    assert(t.sum == (uint64_t) 16 * 999 * 1000 / 2);
+
+    struct thread_pool_group group = { 0 };
+    for (int i = 0; i < 10000; ++i)
+        assert(thread_pool_submit(pool, &group, count_task, &t) == 0);
+    thread_pool_wait(pool, &group);
+    assert(t.calls == 10000 && group.pending == 0);
+
+    // tasks go back to their submitter's free list even after it exits
+    struct orphan_tasks orphans = { &t, &group };
+    pthread_t submitter;
+    assert(pthread_create(&submitter, NULL, submit_and_exit, &orphans) == 0);
+    assert(pthread_join(submitter, NULL) == 0);
+    thread_pool_wait(pool, &group);
+    assert(t.calls == 10000 + 32 && group.pending == 0);
+    thread_pool_destroy(pool);
+
+    // batches split across threads match messages done one at a time
+    assert(thread_pool_default());
+    struct aes128_schedule ks;
+    aes128_expand_key(&ks, (const uint8_t *) "YELLOW SUBMARINE");
+    enum { NUM_MSGS = 64, MSG_LEN = 4096 };
+    uint8_t *plain = malloc(NUM_MSGS * MSG_LEN);
+    uint8_t *batched = malloc(NUM_MSGS * MSG_LEN);
+    uint8_t *single = malloc(MSG_LEN);
+    assert(plain && batched && single);
+    for (size_t i = 0; i < NUM_MSGS * MSG_LEN; ++i)
+        plain[i] = (uint8_t) (i * 131 + 7);
+    struct cipher_message msgs[NUM_MSGS];
+    for (size_t i = 0; i < NUM_MSGS; ++i) {
+        msgs[i].src = plain + i * MSG_LEN;
+        msgs[i].dest = batched + i * MSG_LEN;
+        msgs[i].len = MSG_LEN;
+        msgs[i].iv = plain + i * AES_BLOCK_SIZE;
+    }
+    aes128_cbc_encrypt_batch(&ks, msgs, NUM_MSGS);
+    for (size_t i = 0; i < NUM_MSGS; ++i) {
+        aes128_cbc_encrypt(&ks, msgs[i].iv, msgs[i].src, single, MSG_LEN);
+        assert(memcmp(single, msgs[i].dest, MSG_LEN) == 0);
+    }
+    for (size_t i = 0; i < NUM_MSGS; ++i)
+        msgs[i].src = msgs[i].dest;
+    aes128_cbc_decrypt_batch(&ks, msgs, NUM_MSGS);
+    assert(memcmp(plain, batched, NUM_MSGS * MSG_LEN) == 0);
+    aes128_ecb_encrypt_batch(&ks, msgs, NUM_MSGS);
+    aes128_ecb_decrypt_batch(&ks, msgs, NUM_MSGS);
+    assert(memcmp(plain, batched, NUM_MSGS * MSG_LEN) == 0);
+    free(plain);
+    free(batched);
+    free(single);
+
+    uint8_t raw_ct[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t len = read_base64(raw_ct, cipher_text64, strlen(cipher_text64));
+    const size_t num_candidates = sizeof candidates / sizeof candidates[0];
+    const char *serial_winner = NULL;
+    size_t limits[] = { 1, 2, 0 };
+    for (size_t i = 0; i < sizeof limits / sizeof limits[0]; ++i) {
+        size_t previous = thread_pool_set_batch_limit(limits[i]);
+        assert(previous == (i ? limits[i - 1] : 0));
+        uint8_t key[40];
+        assert(break_repeated_key_xor(raw_ct, len, key, 40) == 29);
+        assert(strncmp((char *) key, "Terminator X: Bring the noise", 29)
+                == 0);
+        const char *winner = find_repeated_byte_xor(candidates,
+                num_candidates);
+        if (!serial_winner)
+            serial_winner = winner;
+        assert(winner == serial_winner);
+    }
+    thread_pool_set_batch_limit(0);
+    printf("Thread pool test passed!\n");
+}
+
+/*
+ * Test the streaming base 16 and base 64 codecs, feeding them input in
+ * pieces that split groups at every offset
+ */
+static void test_stream_codecs()
+{
+    size_t len64 = strlen(cipher_text64);
+    uint8_t expected[(3 * (sizeof cipher_text64 - 1)) / 4];
+    size_t raw_len = read_base64(expected, cipher_text64, len64);
+    uint8_t raw[sizeof expected + 3];
+    for (size_t piece = 1; piece <= 7; ++piece) {
+        struct base64_decoder d = { 0, 0, 0 };
+        size_t out = 0;
+        for (size_t i = 0; i < len64; i += piece) {
+            size_t n = len64 - i < piece ? len64 - i : piece;
+            size_t got = base64_decode_update(&d, raw + out,
+                    cipher_text64 + i, n);
+            assert(got != SIZE_MAX);
+            out += got;
+        }
+        assert(base64_decode_final(&d) == 0);
+        assert(out == raw_len && memcmp(raw, expected, raw_len) == 0);
+    }
+
+    // whitespace is skipped; padding can only end a group
+    struct base64_decoder d = { 0, 0, 0 };
+    assert(base64_decode_update(&d, raw, "c3Vy\nZS4=\r\n", 11) == 5);
+    assert(memcmp(raw, "sure.", 5) == 0 && base64_decode_final(&d) == 0);
+    assert(base64_decode_update(&d, raw, "c3V", 3) == 0);
+    assert(base64_decode_final(&d) == -1);
+    assert(base64_decode_update(&d, raw, "=", 1) == 2);
+    assert(base64_decode_update(&d, raw, "=A==", 4) == SIZE_MAX);
+    d = (struct base64_decoder) { 0, 0, 0 };
+    assert(base64_decode_update(&d, raw, "c3V*", 4) == SIZE_MAX);
+
+    // encoding in pieces gives the same text as sprint_base64
+    char whole[4 * (sizeof expected / 3 + 1) + 1];
+    sprint_base64(whole, expected, raw_len);
+    char pieces[sizeof whole];
+    for (size_t piece = 1; piece <= 5; ++piece) {
+        struct base64_encoder e = { { 0 }, 0 };
+        size_t out = 0;
+        for (size_t i = 0; i < raw_len; i += piece) {
+            size_t n = raw_len - i < piece ? raw_len - i : piece;
+            out += base64_encode_update(&e, pieces + out, expected + i, n);
+        }
+        out += base64_encode_final(&e, pieces + out);
+        assert(out == strlen(whole) && memcmp(pieces, whole, out) == 0);
+    }
+
+    // hex long enough for the vector kernel, split mid pair and by spaces
+    const char hex[] = "00112233445566778899aabbccddeeff0123456789ABCDEF"
+        " 0f\n1e 2d3c\t4b";
+    uint8_t hex_expected[] = { 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+        0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x01, 0x23, 0x45,
+        0x67, 0x89, 0xab, 0xcd, 0xef, 0x0f, 0x1e, 0x2d, 0x3c, 0x4b };
+    for (size_t split = 0; split < sizeof hex; ++split) {
+        struct base16_decoder h = { 0, 0 };
+        size_t out = base16_decode_update(&h, raw, hex, split);
+        out += base16_decode_update(&h, raw + out, hex + split,
+                sizeof hex - 1 - split);
+        assert(base16_decode_final(&h) == 0);
+        assert(out == sizeof hex_expected &&
+                memcmp(raw, hex_expected, out) == 0);
+    }
+    struct base16_decoder h = { 0, 0 };
+    assert(base16_decode_update(&h, raw, "0g", 2) == SIZE_MAX);
+    h = (struct base16_decoder) { 0, 0 };
+    assert(base16_decode_update(&h, raw, "abc", 3) == 1);
+    assert(base16_decode_final(&h) == -1);
+    printf("Stream codecs test passed!\n");
+}
+
+// Output collected by collect_sink
+struct collected {
+    uint8_t *data;
+    size_t len;
+    size_t calls;
+    size_t fail_after;      // calls to accept before failing, or 0 for none
+};
+
+static int collect_sink(void *arg, const uint8_t *buf, size_t len)
+{
+    struct collected *c = arg;
+    if (c->fail_after && c->calls == c->fail_after)
+        return -1;
+    ++c->calls;
+    memcpy(c->data + c->len, buf, len);
+    c->len += len;
+    return 0;
+}
+
+/*
+ * Test decrypting base 64 repeating-key xor text as a stream, fed in pieces
+ * that split groups and the key
+ */
+static void test_base64_xor_stream()
+{
+    // challenge 6, decrypted in one piece
+    const uint8_t key6[] = "Terminator X: Bring the noise";
+    uint8_t out6[sizeof cipher_text64];
+    struct collected c = { out6, 0, 0, 0 };
+    struct base64_xor_stream *s = base64_xor_stream_create(key6,
+            sizeof key6 - 1, collect_sink, &c);
+    assert(s);
+    assert(base64_xor_stream_update(s, cipher_text64,
+                strlen(cipher_text64)) == 0);
+    assert(base64_xor_stream_final(s) == 0);
+    base64_xor_stream_destroy(s);
+    const char expected[] = "I'm back and I'm ringin' the bell";
+    assert(strncmp((char *) out6, expected, sizeof expected - 1) == 0);
+
+    // a stream several blocks long, split into pieces that leave groups
+    // and the key unfinished
+    const size_t raw_len = 100000;
+    uint8_t *plain = malloc(raw_len);
+    uint8_t *cipher = malloc(raw_len);
+    char *text = malloc(2 * raw_len);
+    uint8_t *out = malloc(raw_len);
+    assert(plain && cipher && text && out);
+    for (size_t i = 0; i < raw_len; ++i)
+        plain[i] = (uint8_t) (i * 131 + (i >> 7));
+    const uint8_t key[] = "a key of seventeen";
+    repeated_key_xor(key, sizeof key - 1, plain, cipher, raw_len);
+    struct base64_encoder e;
+    memset(&e, 0, sizeof e);
+    size_t text_len = 0;
+    for (size_t i = 0; i < raw_len; i += 57) {
+        size_t n = raw_len - i < 57 ? raw_len - i : 57;
+        text_len += base64_encode_update(&e, text + text_len, cipher + i, n);
+        text_len += base64_encode_final(&e, text + text_len);
+        text[text_len++] = '\n';
+    }
+    const size_t pieces[] = { 1, 7, 4099, 50000, 2 * raw_len };
+    for (size_t p = 0; p < sizeof pieces / sizeof pieces[0]; ++p) {
+        c = (struct collected) { out, 0, 0, 0 };
+        s = base64_xor_stream_create(key, sizeof key - 1, collect_sink, &c);
+        assert(s);
+        for (size_t i = 0; i < text_len; i += pieces[p]) {
+            size_t n = text_len - i < pieces[p] ? text_len - i : pieces[p];
+            assert(base64_xor_stream_update(s, text + i, n) == 0);
+        }
+        assert(base64_xor_stream_final(s) == 0);
+        base64_xor_stream_destroy(s);
+        assert(c.len == raw_len && memcmp(out, plain, raw_len) == 0);
+    }
+
+    // a failing sink stops the stream
+    c = (struct collected) { out, 0, 0, 1 };
+    s = base64_xor_stream_create(key, sizeof key - 1, collect_sink, &c);
+    assert(base64_xor_stream_update(s, text, text_len) == -1);
+    assert(c.calls == 1);
+    base64_xor_stream_destroy(s);
+
+    // bad input and unfinished groups are reported
+    c = (struct collected) { out, 0, 0, 0 };
+    s = base64_xor_stream_create(key, sizeof key - 1, collect_sink, &c);
+    assert(base64_xor_stream_update(s, "QUJD!", 5) == -1);
+    base64_xor_stream_destroy(s);
+    s = base64_xor_stream_create(key, sizeof key - 1, collect_sink, &c);
+    assert(base64_xor_stream_update(s, "QUJDRA", 6) == 0);
+    assert(base64_xor_stream_final(s) == -1);
+    base64_xor_stream_destroy(s);
+    assert(base64_xor_stream_create(key, 0, collect_sink, &c) == NULL);
+
+    free(plain);
+    free(cipher);
+    free(text);
+    free(out);
+    printf("Base 64 xor stream test passed!\n");
+}
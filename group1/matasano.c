@@ -0,0 +1,933 @@
+/*
+ * matasano.c
+ * Command line front end to the library, for use in shell pipelines.
+ *
+ * usage: matasano [--stats] [-j threads] <command> [file ...]
+ *
+ *   decode16            hex to raw bytes
+ *   decode64            base 64 to raw bytes
+ *   encode64            raw bytes to base 64, in lines of 64 characters
+ *   ecb-decrypt -k key  base 64 aes-128-ecb ciphertext to plaintext, under a
+ *                       32 hex digit key, with the PKCS#7 padding removed
+ *   xor-decrypt -k key  base 64 repeating-key xor'd text to plaintext, under
+ *                       a hex key of up to 256 bytes
+ *   xor-detect          print the hex line most likely to be single-byte
+ *                       xor'd, with its key and plaintext
+ *   xor-break           print the key of base 64 repeating-key xor'd text
+ *   ecb-detect          print the hex lines that look aes-ecb encrypted
+ *
+ * Files are mapped into memory; stdin is read when no files are given or a
+ * file is "-". Whitespace in encoded input is ignored. The first five
+ * commands stream through fixed-size buffers in constant memory and write
+ * each file's output in turn. The others handle files in parallel, on up to
+ * -j threads, and print a report for each file in order; xor-break holds one
+ * decoded file at a time, since breaking the key needs all of it.
+ * --stats prints per-file throughput to stderr.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <ctype.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "convert.h"
+#include "xor.h"
+#include "text_score.h"
+#include "cipher.h"
+#include "thread_pool.h"
+
+#define BUF_SIZE (64 * 1024)
+#define MAX_LINE (64 * 1024)    // longest hex line the line commands take
+#define WRAP_COLUMN 64          // as openssl's base 64 output
+#define BREAK_KEY_MAX 40
+#define XOR_KEY_MAX 256
+
+// An input file, either mapped or read through a buffer
+struct source {
+    const char *name;
+    int fd;
+    const uint8_t *map;         // whole file when mapped, else NULL
+    size_t size;
+    int done;
+    uint8_t *buf;               // BUF_SIZE bytes when not mapped
+};
+
+// Splits a source into lines, carrying partial lines between reads
+struct line_reader {
+    struct source *src;
+    const uint8_t *chunk;
+    size_t chunk_len;
+    size_t pos;
+    uint8_t *carry;             // MAX_LINE bytes
+    size_t carry_len;
+    size_t line_no;
+    int error;                  // a read failed or a line was too long
+};
+
+struct file_stats {
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+    double seconds;
+};
+
+struct options {
+    int stats;
+    struct aes128_schedule key;
+    uint8_t xor_key[XOR_KEY_MAX];
+    size_t xor_key_size;
+};
+
+// The -k argument a command takes
+enum key_kind {
+    KEY_NONE,
+    KEY_AES,        // 32 hex digits
+    KEY_XOR,        // up to XOR_KEY_MAX bytes in hex
+};
+
+// A command that transforms a stream, writing to out
+typedef int (*stream_fn)(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+// A command that analyses a file and writes a report
+typedef int (*report_fn)(struct source *in, FILE *report,
+        struct file_stats *st, const struct options *opts);
+
+struct command {
+    const char *name;
+    stream_fn stream;
+    report_fn report;
+    enum key_kind key;
+};
+
+// Where xor-decrypt's stream sends its output
+struct fd_sink {
+    int fd;
+    struct file_stats *st;
+    int failed;         // a write failed, and has been reported
+};
+
+// One file of a report command run over the thread pool
+struct report_job {
+    const char *path;
+    char *report;
+    size_t report_len;
+    struct file_stats stats;
+    int status;
+};
+
+struct report_batch {
+    const struct command *cmd;
+    const struct options *opts;
+    struct report_job *jobs;
+};
+
+// Private functions
+static int usage(const char *prog);
+static int run_streams(const struct command *cmd, char **paths, size_t num,
+        const struct options *opts);
+static int run_reports(const struct command *cmd, char **paths, size_t num,
+        const struct options *opts);
+static void report_range(void *arg, size_t begin, size_t end);
+static int source_open(struct source *s, const char *path);
+static ssize_t source_next(struct source *s, const uint8_t **chunk);
+static void source_close(struct source *s);
+static ssize_t next_line(struct line_reader *r, const uint8_t **line);
+static int write_all(int fd, const void *buf, size_t len);
+static size_t wrap_lines(char *dest, const char *src, size_t len,
+        size_t *column);
+static void print_escaped(FILE *out, const uint8_t *src, size_t len);
+static void print_stats(const char *name, const struct file_stats *st);
+static double now(void);
+static int decode16(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+static int decode64(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+static int encode64(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+static int ecb_decrypt(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+static int xor_decrypt(struct source *in, int out, struct file_stats *st,
+        const struct options *opts);
+static int write_to_fd_sink(void *arg, const uint8_t *buf, size_t len);
+static int xor_detect(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts);
+static int xor_break(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts);
+static int ecb_detect(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts);
+
+static const struct command commands[] = {
+    { "decode16", decode16, NULL, KEY_NONE },
+    { "decode64", decode64, NULL, KEY_NONE },
+    { "encode64", encode64, NULL, KEY_NONE },
+    { "ecb-decrypt", ecb_decrypt, NULL, KEY_AES },
+    { "xor-decrypt", xor_decrypt, NULL, KEY_XOR },
+    { "xor-detect", NULL, xor_detect, KEY_NONE },
+    { "xor-break", NULL, xor_break, KEY_NONE },
+    { "ecb-detect", NULL, ecb_detect, KEY_NONE },
+};
+
+static char *stdin_path[] = { "-" };
+
+int main(int argc, char **argv)
+{
+    struct options opts;
+    memset(&opts, 0, sizeof opts);
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-'; ++i) {
+        if (strcmp(argv[i], "--stats") == 0) {
+            opts.stats = 1;
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            char *end;
+            unsigned long threads = strtoul(argv[++i], &end, 10);
+            if (*end != '\0' || threads == 0)
+                return usage(argv[0]);
+            thread_pool_set_batch_limit(threads);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (i == argc)
+        return usage(argv[0]);
+    const struct command *cmd = NULL;
+    for (size_t c = 0; c < sizeof commands / sizeof commands[0]; ++c)
+        if (strcmp(argv[i], commands[c].name) == 0)
+            cmd = &commands[c];
+    if (!cmd)
+        return usage(argv[0]);
+    ++i;
+    if (cmd->key != KEY_NONE) {
+        if (i + 1 >= argc || strcmp(argv[i], "-k") != 0)
+            return usage(argv[0]);
+        const char *hex = argv[i + 1];
+        size_t hex_len = strlen(hex);
+        size_t max = cmd->key == KEY_AES ? AES128_KEY_SIZE : XOR_KEY_MAX;
+        struct base16_decoder d = { 0, 0 };
+        if (hex_len == 0 || hex_len % 2 != 0 || hex_len > 2 * max ||
+                (cmd->key == KEY_AES && hex_len != 2 * max) ||
+                base16_decode_update(&d, opts.xor_key, hex, hex_len) !=
+                hex_len / 2)
+            return usage(argv[0]);
+        if (cmd->key == KEY_AES)
+            aes128_expand_key(&opts.key, opts.xor_key);
+        else
+            opts.xor_key_size = hex_len / 2;
+        i += 2;
+    }
+    char **paths = i < argc ? argv + i : stdin_path;
+    size_t num = i < argc ? (size_t) (argc - i) : 1;
+    if (cmd->stream)
+        return run_streams(cmd, paths, num, &opts);
+    return run_reports(cmd, paths, num, &opts);
+}
+
+/*
+ * Print usage
+ * @return exit status for bad usage
+ */
+static int usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [--stats] [-j threads] <command> [file ...]\n"
+            "commands: decode16, decode64, encode64, ecb-decrypt -k <32 hex "
+            "digit key>,\n          xor-decrypt -k <hex key>, xor-detect, "
+            "xor-break, ecb-detect\n",
+            prog);
+    return 2;
+}
+
+/*
+ * Run a stream command over each file in turn, writing to stdout
+ * @return exit status
+ */
+static int run_streams(const struct command *cmd, char **paths, size_t num,
+        const struct options *opts)
+{
+    int status = 0;
+    struct file_stats total = { 0, 0, 0 };
+    for (size_t i = 0; i < num; ++i) {
+        struct source in;
+        if (source_open(&in, paths[i]) != 0) {
+            perror(paths[i]);
+            status = 1;
+            continue;
+        }
+        struct file_stats st = { 0, 0, 0 };
+        double start = now();
+        if (cmd->stream(&in, STDOUT_FILENO, &st, opts) != 0)
+            status = 1;
+        st.seconds = now() - start;
+        source_close(&in);
+        if (opts->stats)
+            print_stats(paths[i], &st);
+        total.bytes_in += st.bytes_in;
+        total.bytes_out += st.bytes_out;
+        total.seconds += st.seconds;
+    }
+    if (opts->stats && num > 1)
+        print_stats("total", &total);
+    return status;
+}
+
+/*
+ * Run a report command over the files in parallel, then print the reports
+ * in order
+ * @return exit status
+ */
+static int run_reports(const struct command *cmd, char **paths, size_t num,
+        const struct options *opts)
+{
+    struct report_job *jobs = calloc(num, sizeof *jobs);
+    if (!jobs) {
+        perror("matasano");
+        return 1;
+    }
+    for (size_t i = 0; i < num; ++i)
+        jobs[i].path = paths[i];
+    struct report_batch batch = { cmd, opts, jobs };
+    double start = now();
+    thread_pool_parallel_for(NULL, 0, num, 1, thread_pool_batch_limit(),
+            report_range, &batch);
+    double elapsed = now() - start;
+    int status = 0;
+    struct file_stats total = { 0, 0, elapsed };
+    for (size_t i = 0; i < num; ++i) {
+        if (jobs[i].report) {
+            fwrite(jobs[i].report, 1, jobs[i].report_len, stdout);
+            free(jobs[i].report);
+        }
+        if (jobs[i].status != 0)
+            status = 1;
+        if (opts->stats)
+            print_stats(jobs[i].path, &jobs[i].stats);
+        total.bytes_in += jobs[i].stats.bytes_in;
+    }
+    if (opts->stats && num > 1)
+        print_stats("total", &total);
+    free(jobs);
+    return status;
+}
+
+/*
+ * Run a report command on files [begin, end) of a batch
+ */
+static void report_range(void *arg, size_t begin, size_t end)
+{
+    struct report_batch *batch = arg;
+    for (size_t i = begin; i < end; ++i) {
+        struct report_job *job = &batch->jobs[i];
+        FILE *report = open_memstream(&job->report, &job->report_len);
+        struct source in;
+        if (!report || source_open(&in, job->path) != 0) {
+            // report before the file's turn comes, as errors go to stderr
+            fprintf(stderr, "%s: %s\n", job->path, strerror(errno));
+            if (report)
+                fclose(report);
+            job->status = 1;
+            continue;
+        }
+        double start = now();
+        job->status = batch->cmd->report(&in, report, &job->stats,
+                batch->opts);
+        job->stats.seconds = now() - start;
+        source_close(&in);
+        fclose(report);
+    }
+}
+
+/*
+ * Open a file, mapping it if it is a regular file
+ * @param s source to set up
+ * @param path file to open, or "-" for stdin
+ * @return 0 on success, or -1 with errno set
+ */
+static int source_open(struct source *s, const char *path)
+{
+    memset(s, 0, sizeof *s);
+    s->name = path;
+    s->fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY);
+    if (s->fd < 0)
+        return -1;
+    struct stat sb;
+    if (fstat(s->fd, &sb) == 0 && S_ISREG(sb.st_mode) && sb.st_size > 0) {
+        void *map = mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, s->fd, 0);
+        if (map != MAP_FAILED) {
+            madvise(map, sb.st_size, MADV_SEQUENTIAL);
+            s->map = map;
+            s->size = sb.st_size;
+            return 0;
+        }
+    }
+    s->buf = malloc(BUF_SIZE);
+    if (!s->buf) {
+        source_close(s);
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Get the next chunk of a source. A mapped file comes back whole.
+ * @param chunk output for a pointer to the chunk, valid until the next call
+ * @return length of the chunk, 0 at the end of the file, or -1 on error
+ */
+static ssize_t source_next(struct source *s, const uint8_t **chunk)
+{
+    if (s->done)
+        return 0;
+    if (s->map) {
+        s->done = 1;
+        *chunk = s->map;
+        return s->size;
+    }
+    ssize_t n;
+    do {
+        n = read(s->fd, s->buf, BUF_SIZE);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0)
+        s->done = 1;
+    if (n < 0)
+        perror(s->name);
+    *chunk = s->buf;
+    return n;
+}
+
+/*
+ * Close a source and free its buffer
+ */
+static void source_close(struct source *s)
+{
+    if (s->map)
+        munmap((void *) s->map, s->size);
+    if (s->fd > STDIN_FILENO)
+        close(s->fd);
+    free(s->buf);
+    s->map = NULL;
+    s->buf = NULL;
+    s->fd = -1;
+}
+
+/*
+ * Get the next line of a source, without its line break
+ * @param line output for a pointer to the line, valid until the next call
+ * @return length of the line, or -1 at the end of the file or on error,
+ *         which sets r->error; a line longer than MAX_LINE is an error
+ */
+static ssize_t next_line(struct line_reader *r, const uint8_t **line)
+{
+    for (;;) {
+        if (r->pos < r->chunk_len) {
+            const uint8_t *start = r->chunk + r->pos;
+            size_t left = r->chunk_len - r->pos;
+            const uint8_t *nl = memchr(start, '\n', left);
+            size_t len = nl ? (size_t) (nl - start) : left;
+            r->pos += nl ? len + 1 : len;
+            if (!nl || r->carry_len) {
+                // join with the part of the line from the previous chunk
+                if (r->carry_len + len > MAX_LINE) {
+                    fprintf(stderr, "%s:%zu: line too long\n", r->src->name,
+                            r->line_no + 1);
+                    r->error = 1;
+                    return -1;
+                }
+                memcpy(r->carry + r->carry_len, start, len);
+                r->carry_len += len;
+                if (!nl)
+                    continue;
+                start = r->carry;
+                len = r->carry_len;
+                r->carry_len = 0;
+            }
+            ++r->line_no;
+            *line = start;
+            return len;
+        }
+        ssize_t n = source_next(r->src, &r->chunk);
+        if (n <= 0) {
+            r->error |= n < 0;
+            if (n < 0 || !r->carry_len)
+                return -1;
+            // last line without a line break
+            ++r->line_no;
+            *line = r->carry;
+            n = r->carry_len;
+            r->carry_len = 0;
+            return n;
+        }
+        r->chunk_len = n;
+        r->pos = 0;
+    }
+}
+
+/*
+ * Write a whole buffer to a file descriptor
+ * @return 0 on success, or -1 on error
+ */
+static int write_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    while (len) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0) {
+            perror("write");
+            return -1;
+        }
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/*
+ * Copy text, breaking it into lines of WRAP_COLUMN characters
+ * @param dest buffer for the output
+ *        precondition: length of dest >= len + len / WRAP_COLUMN + 1
+ * @param column position in the current output line, updated
+ * @return number of characters written to dest
+ */
+static size_t wrap_lines(char *dest, const char *src, size_t len,
+        size_t *column)
+{
+    size_t out = 0;
+    while (len) {
+        size_t n = WRAP_COLUMN - *column;
+        if (n > len)
+            n = len;
+        memcpy(dest + out, src, n);
+        out += n;
+        src += n;
+        len -= n;
+        *column += n;
+        if (*column == WRAP_COLUMN) {
+            dest[out++] = '\n';
+            *column = 0;
+        }
+    }
+    return out;
+}
+
+/*
+ * Print bytes as text, escaping anything unprintable
+ */
+static void print_escaped(FILE *out, const uint8_t *src, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (src[i] == '\n')
+            fputs("\\n", out);
+        else if (src[i] == '\\')
+            fputs("\\\\", out);
+        else if (src[i] >= 0x20 && src[i] < 0x7f)
+            fputc(src[i], out);
+        else
+            fprintf(out, "\\x%02x", src[i]);
+    }
+}
+
+/*
+ * Print a file's throughput to stderr
+ */
+static void print_stats(const char *name, const struct file_stats *st)
+{
+    double mb_per_s = st->seconds > 0 ? st->bytes_in / st->seconds / 1e6 : 0;
+    fprintf(stderr, "%s: %llu bytes in, %llu bytes out, %.3f s, %.1f MB/s\n",
+            name, (unsigned long long) st->bytes_in,
+            (unsigned long long) st->bytes_out, st->seconds, mb_per_s);
+}
+
+/*
+ * @return monotonic time in seconds
+ */
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * decode16: hex to raw bytes
+ * @return 0 on success, or -1 on error
+ */
+static int decode16(struct source *in, int out, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    struct base16_decoder d = { 0, 0 };
+    uint8_t raw[(BUF_SIZE + 1) / 2];
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        for (size_t off = 0; off < (size_t) n; off += BUF_SIZE) {
+            size_t piece = n - off < BUF_SIZE ? n - off : BUF_SIZE;
+            size_t len = base16_decode_update(&d, raw,
+                    (const char *) chunk + off, piece);
+            if (len == SIZE_MAX) {
+                fprintf(stderr, "%s: invalid hex\n", in->name);
+                return -1;
+            }
+            if (write_all(out, raw, len) != 0)
+                return -1;
+            st->bytes_in += piece;
+            st->bytes_out += len;
+        }
+    }
+    if (n < 0)
+        return -1;
+    if (base16_decode_final(&d) != 0) {
+        fprintf(stderr, "%s: odd number of hex digits\n", in->name);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * decode64: base 64 to raw bytes
+ * @return 0 on success, or -1 on error
+ */
+static int decode64(struct source *in, int out, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    struct base64_decoder d = { 0, 0, 0 };
+    uint8_t raw[3 * ((BUF_SIZE + 3) / 4)];
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        for (size_t off = 0; off < (size_t) n; off += BUF_SIZE) {
+            size_t piece = n - off < BUF_SIZE ? n - off : BUF_SIZE;
+            size_t len = base64_decode_update(&d, raw,
+                    (const char *) chunk + off, piece);
+            if (len == SIZE_MAX) {
+                fprintf(stderr, "%s: invalid base 64\n", in->name);
+                return -1;
+            }
+            if (write_all(out, raw, len) != 0)
+                return -1;
+            st->bytes_in += piece;
+            st->bytes_out += len;
+        }
+    }
+    if (n < 0)
+        return -1;
+    if (base64_decode_final(&d) != 0) {
+        fprintf(stderr, "%s: truncated base 64\n", in->name);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * encode64: raw bytes to base 64
+ * @return 0 on success, or -1 on error
+ */
+static int encode64(struct source *in, int out, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    struct base64_encoder e = { { 0 }, 0 };
+    // encode 3/4 of a buffer at a time so the wrapped text fits in one
+    enum { PIECE = 3 * (BUF_SIZE / 4) };
+    char encoded[BUF_SIZE + 4];
+    char wrapped[BUF_SIZE + 4 + BUF_SIZE / WRAP_COLUMN + 2];
+    size_t column = 0;
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        for (size_t off = 0; off < (size_t) n; off += PIECE) {
+            size_t piece = n - off < PIECE ? n - off : PIECE;
+            size_t len = base64_encode_update(&e, encoded, chunk + off,
+                    piece);
+            len = wrap_lines(wrapped, encoded, len, &column);
+            if (write_all(out, wrapped, len) != 0)
+                return -1;
+            st->bytes_in += piece;
+            st->bytes_out += len;
+        }
+    }
+    if (n < 0)
+        return -1;
+    size_t len = base64_encode_final(&e, encoded);
+    len = wrap_lines(wrapped, encoded, len, &column);
+    if (column)
+        wrapped[len++] = '\n';
+    st->bytes_out += len;
+    return write_all(out, wrapped, len);
+}
+
+/*
+ * ecb-decrypt: base 64 aes-128-ecb ciphertext to plaintext. The last block
+ * is held back until the end of the input, to remove its padding.
+ * @return 0 on success, or -1 on error
+ */
+static int ecb_decrypt(struct source *in, int out, struct file_stats *st,
+        const struct options *opts)
+{
+    struct base64_decoder d = { 0, 0, 0 };
+    uint8_t raw[AES_BLOCK_SIZE + 3 * ((BUF_SIZE + 3) / 4)];
+    size_t held = 0;    // decoded bytes not yet decrypted
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        for (size_t off = 0; off < (size_t) n; off += BUF_SIZE) {
+            size_t piece = n - off < BUF_SIZE ? n - off : BUF_SIZE;
+            size_t len = base64_decode_update(&d, raw + held,
+                    (const char *) chunk + off, piece);
+            if (len == SIZE_MAX) {
+                fprintf(stderr, "%s: invalid base 64\n", in->name);
+                return -1;
+            }
+            st->bytes_in += piece;
+            held += len;
+            size_t ready = held / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+            if (ready == held && ready)
+                ready -= AES_BLOCK_SIZE;
+            aes128_ecb_decrypt(&opts->key, raw, raw, ready);
+            if (write_all(out, raw, ready) != 0)
+                return -1;
+            st->bytes_out += ready;
+            memmove(raw, raw + ready, held - ready);
+            held -= ready;
+        }
+    }
+    if (n < 0)
+        return -1;
+    if (base64_decode_final(&d) != 0 || held != AES_BLOCK_SIZE) {
+        fprintf(stderr, "%s: not a whole number of blocks\n", in->name);
+        return -1;
+    }
+    aes128_ecb_decrypt(&opts->key, raw, raw, AES_BLOCK_SIZE);
+    size_t len = pkcs7_unpad(raw, AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+    if (len == SIZE_MAX) {
+        fprintf(stderr, "%s: bad padding\n", in->name);
+        return -1;
+    }
+    st->bytes_out += len;
+    return write_all(out, raw, len);
+}
+
+/*
+ * xor-decrypt: base 64 repeating-key xor'd text to plaintext
+ * @return 0 on success, or -1 on error
+ */
+static int xor_decrypt(struct source *in, int out, struct file_stats *st,
+        const struct options *opts)
+{
+    struct fd_sink sink = { out, st, 0 };
+    struct base64_xor_stream *s = base64_xor_stream_create(opts->xor_key,
+            opts->xor_key_size, write_to_fd_sink, &sink);
+    if (!s) {
+        fprintf(stderr, "%s: out of memory\n", in->name);
+        return -1;
+    }
+    int status = 0;
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        if (base64_xor_stream_update(s, (const char *) chunk, n) != 0) {
+            if (!sink.failed)
+                fprintf(stderr, "%s: invalid base 64\n", in->name);
+            status = -1;
+            break;
+        }
+        st->bytes_in += n;
+    }
+    if (status == 0 && n < 0)
+        status = -1;
+    if (status == 0 && base64_xor_stream_final(s) != 0) {
+        fprintf(stderr, "%s: truncated base 64\n", in->name);
+        status = -1;
+    }
+    base64_xor_stream_destroy(s);
+    return status;
+}
+
+/*
+ * Sink for xor-decrypt's stream
+ * @return 0 on success, or -1 if the write failed
+ */
+static int write_to_fd_sink(void *arg, const uint8_t *buf, size_t len)
+{
+    struct fd_sink *sink = arg;
+    if (write_all(sink->fd, buf, len) != 0) {
+        sink->failed = 1;
+        return -1;
+    }
+    sink->st->bytes_out += len;
+    return 0;
+}
+
+/*
+ * xor-detect: report the hex line most likely to be single-byte xor'd. Lines
+ * are scored from byte counts taken while parsing them, and only the winner
+ * is decoded.
+ * @return 0 on success, or -1 on error
+ */
+static int xor_detect(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    uint8_t *carry = malloc(MAX_LINE);
+    uint8_t *best = malloc(MAX_LINE);
+    if (!carry || !best) {
+        free(carry);
+        free(best);
+        fprintf(stderr, "%s: out of memory\n", in->name);
+        return -1;
+    }
+    struct line_reader r = { in, NULL, 0, 0, carry, 0, 0, 0 };
+    size_t best_line = 0;
+    size_t best_len = 0;
+    uint8_t best_key = 0;
+    double best_score = 0;
+    size_t skipped = 0;
+    const uint8_t *line;
+    ssize_t n;
+    while ((n = next_line(&r, &line)) >= 0) {
+        st->bytes_in += n + 1;
+        size_t len = n;
+        while (len && isspace(line[len - 1]))
+            --len;
+        while (len && isspace(line[0])) {
+            ++line;
+            --len;
+        }
+        if (len == 0)
+            continue;
+        uint8_t key;
+        double score;
+        if (len % 2 || detect_repeated_byte_xor_base16((const char *) line,
+                    len, &key, &score) != 0) {
+            ++skipped;
+            continue;
+        }
+        if (!best_line || score > best_score) {
+            best_line = r.line_no;
+            best_score = score;
+            best_key = key;
+            best_len = len;
+            memcpy(best, line, len);
+        }
+    }
+    if (best_line) {
+        // the line reader is finished with its buffer
+        struct base16_decoder d = { 0, 0 };
+        size_t len = base16_decode_update(&d, carry, (const char *) best,
+                best_len);
+        repeated_byte_xor(best_key, carry, carry, len);
+        fprintf(report, "%s:%zu: key 0x%02x: ", in->name, best_line,
+                best_key);
+        print_escaped(report, carry, len);
+        fputc('\n', report);
+    }
+    if (skipped)
+        fprintf(stderr, "%s: skipped %zu lines that aren't hex\n", in->name,
+                skipped);
+    free(carry);
+    free(best);
+    return r.error ? -1 : 0;
+}
+
+/*
+ * xor-break: report the key of base 64 repeating-key xor'd text
+ * @return 0 on success, or -1 on error
+ */
+static int xor_break(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    struct base64_decoder d = { 0, 0, 0 };
+    uint8_t *text = NULL;
+    size_t len = 0;
+    size_t cap = 0;
+    const uint8_t *chunk;
+    ssize_t n;
+    while ((n = source_next(in, &chunk)) > 0) {
+        for (size_t off = 0; off < (size_t) n; off += BUF_SIZE) {
+            size_t piece = n - off < BUF_SIZE ? n - off : BUF_SIZE;
+            size_t need = len + 3 * ((piece + 3) / 4);
+            if (need > cap) {
+                size_t grown_cap = cap ? 2 * cap : BUF_SIZE;
+                while (grown_cap < need)
+                    grown_cap *= 2;
+                uint8_t *grown = realloc(text, grown_cap);
+                if (!grown) {
+                    free(text);
+                    fprintf(stderr, "%s: out of memory\n", in->name);
+                    return -1;
+                }
+                text = grown;
+                cap = grown_cap;
+            }
+            size_t decoded = base64_decode_update(&d, text + len,
+                    (const char *) chunk + off, piece);
+            if (decoded == SIZE_MAX) {
+                free(text);
+                fprintf(stderr, "%s: invalid base 64\n", in->name);
+                return -1;
+            }
+            len += decoded;
+            st->bytes_in += piece;
+        }
+    }
+    // key size detection compares the first 6 pairs of blocks of each size
+    size_t max_key_size = len / 12 < BREAK_KEY_MAX ? len / 12 : BREAK_KEY_MAX;
+    if (n < 0 || base64_decode_final(&d) != 0 || max_key_size < 2) {
+        free(text);
+        fprintf(stderr, "%s: need at least 24 bytes of cipher text\n",
+                in->name);
+        return -1;
+    }
+    uint8_t key[BREAK_KEY_MAX];
+    size_t key_size = break_repeated_key_xor(text, len, key, max_key_size);
+    free(text);
+    if (key_size == 0) {
+        fprintf(stderr, "%s: out of memory\n", in->name);
+        return -1;
+    }
+    fprintf(report, "%s: key size %zu: ", in->name, key_size);
+    print_escaped(report, key, key_size);
+    fputc('\n', report);
+    return 0;
+}
+
+/*
+ * ecb-detect: report the hex lines that repeat a 16-byte block
+ * @return 0 on success, or -1 on error
+ */
+static int ecb_detect(struct source *in, FILE *report, struct file_stats *st,
+        const struct options *opts)
+{
+    (void) opts;
+    uint8_t *carry = malloc(MAX_LINE);
+    uint8_t *raw = malloc(MAX_LINE / 2);
+    if (!carry || !raw) {
+        free(carry);
+        free(raw);
+        fprintf(stderr, "%s: out of memory\n", in->name);
+        return -1;
+    }
+    struct line_reader r = { in, NULL, 0, 0, carry, 0, 0, 0 };
+    const uint8_t *line;
+    ssize_t n;
+    while ((n = next_line(&r, &line)) >= 0) {
+        st->bytes_in += n + 1;
+        struct base16_decoder d = { 0, 0 };
+        size_t len = base16_decode_update(&d, raw, (const char *) line, n);
+        if (len != SIZE_MAX && base16_decode_final(&d) == 0 &&
+                is_ecb_encrypted(raw, len))
+            fprintf(report, "%s:%zu\n", in->name, r.line_no);
+    }
+    free(carry);
+    free(raw);
+    return r.error ? -1 : 0;
+}
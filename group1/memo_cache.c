@@ -0,0 +1,347 @@
+/*
+ * memo_cache.c
+ * A bounded cache of analysis results, addressed by a 128-bit MurmurHash3 of
+ * the input bytes and the parameters they were analysed with. The cache is
+ * split into stripes, each behind a reader-writer lock. A stripe is a table
+ * of sets of MEMO_WAYS entries; a key can only live in the set its hash
+ * picks. Readers mark the entries they hit, and a full set evicts with the
+ * clock algorithm, skipping (and unmarking) marked entries once.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "memo_cache.h"
+
+#define MEMO_WAYS 8
+#define EMPTY_SIZE UINT8_MAX
+#define MEMO_ALIGN 64                // entries are one cache line each
+
+struct memo_entry {
+    uint64_t hash[2];
+    uint8_t size;                   // EMPTY_SIZE if the entry is unused
+    uint8_t referenced;             // set by readers, cleared by the clock
+    uint8_t value[MEMO_VALUE_MAX];
+};
+
+struct memo_stripe {
+    pthread_rwlock_t lock;
+    struct memo_entry *entries;     // num_sets * MEMO_WAYS
+    uint8_t *hands;                 // clock hand of each set
+    size_t num_sets;                // power of 2
+    uint64_t hits;                  // updated atomically, under either lock
+    uint64_t misses;
+    uint64_t insertions;            // updated under the write lock
+    uint64_t evictions;
+};
+
+struct memo_cache {
+    struct memo_stripe *stripes;
+    size_t num_stripes;
+};
+
+// Private functions
+static uint64_t fmix64(uint64_t k);
+static uint64_t rotl64(uint64_t x, int r);
+static struct memo_entry *find_set(struct memo_cache *cache,
+        const struct memo_key *key, struct memo_stripe **stripe,
+        size_t *set);
+
+/*
+ * Create a result cache
+ * @param max_bytes most memory to use for entries
+ * @param stripes number of independently locked partitions
+ * @return pointer to the new cache, or NULL on error
+ */
+struct memo_cache *memo_cache_create(size_t max_bytes, size_t stripes)
+{
+    if (stripes == 0)
+        return NULL;
+    size_t sets = max_bytes / stripes /
+        (MEMO_WAYS * sizeof(struct memo_entry));
+    if (sets == 0)
+        return NULL;
+    size_t num_sets = 1;
+    while (num_sets * 2 <= sets)
+        num_sets <<= 1;
+    struct memo_cache *cache = calloc(1, sizeof *cache);
+    if (!cache)
+        return NULL;
+    cache->stripes = calloc(stripes, sizeof *cache->stripes);
+    if (!cache->stripes) {
+        free(cache);
+        return NULL;
+    }
+    cache->num_stripes = stripes;
+    for (size_t i = 0; i < stripes; ++i) {
+        struct memo_stripe *s = &cache->stripes[i];
+        s->num_sets = num_sets;
+        size_t bytes = num_sets * MEMO_WAYS * sizeof *s->entries;
+        bytes = (bytes + MEMO_ALIGN - 1) & ~(size_t) (MEMO_ALIGN - 1);
+        void *entries;
+        if (posix_memalign(&entries, MEMO_ALIGN, bytes) != 0)
+            entries = NULL;
+        s->entries = entries;
+        s->hands = calloc(num_sets, sizeof *s->hands);
+        pthread_rwlock_init(&s->lock, NULL);
+        if (!s->entries || !s->hands) {
+            cache->num_stripes = i + 1;
+            memo_cache_destroy(cache);
+            return NULL;
+        }
+        for (size_t e = 0; e < num_sets * MEMO_WAYS; ++e) {
+            s->entries[e].size = EMPTY_SIZE;
+            s->entries[e].referenced = 0;
+        }
+    }
+    return cache;
+}
+
+/*
+ * Free a cache and all of its entries
+ */
+void memo_cache_destroy(struct memo_cache *cache)
+{
+    if (!cache)
+        return;
+    for (size_t i = 0; i < cache->num_stripes; ++i) {
+        struct memo_stripe *s = &cache->stripes[i];
+        pthread_rwlock_destroy(&s->lock);
+        free(s->entries);
+        free(s->hands);
+    }
+    free(cache->stripes);
+    free(cache);
+}
+
+/*
+ * Compute the 128-bit x64 variant of MurmurHash3. Blocks are read as little
+ * endian, so the output matches the reference implementation on x86.
+ * @param src bytes to hash
+ * @param len number of bytes in src
+ * @param seed seed
+ * @param out output for the two 64-bit halves of the hash
+ */
+void murmur3_128(const void *src, size_t len, uint32_t seed,
+        uint64_t out[2])
+{
+    const uint8_t *data = src;
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+    size_t blocks = len / 16;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint64_t k1, k2;
+        memcpy(&k1, data + 16 * i, sizeof k1);
+        memcpy(&k2, data + 16 * i + 8, sizeof k2);
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+    const uint8_t *tail = data + 16 * blocks;
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+    size_t rest = len & 15;
+    for (size_t i = rest; i > 8; --i)
+        k2 ^= (uint64_t) tail[i - 1] << (8 * (i - 9));
+    if (rest > 8) {
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+    for (size_t i = rest < 8 ? rest : 8; i > 0; --i)
+        k1 ^= (uint64_t) tail[i - 1] << (8 * (i - 1));
+    if (rest > 0) {
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+    h1 ^= len;
+    h2 ^= len;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+    h1 += h2;
+    h2 += h1;
+    out[0] = h1;
+    out[1] = h2;
+}
+
+/*
+ * Make the key for a result
+ * @param op identifies the operation
+ * @param param the operation's parameters, packed into 64 bits
+ * @param src input bytes
+ * @param len number of bytes in src
+ * @return the key
+ */
+struct memo_key memo_key(uint32_t op, uint64_t param, const void *src,
+        size_t len)
+{
+    struct memo_key key;
+    murmur3_128(src, len, op, key.hash);
+    key.hash[0] ^= fmix64(param + 0x9e3779b97f4a7c15ULL);
+    return key;
+}
+
+/*
+ * Look up a result
+ * @param cache cache to look in
+ * @param key key from memo_key
+ * @param value output for the result
+ * @return size of the result, or SIZE_MAX if it isn't cached
+ */
+size_t memo_cache_get(struct memo_cache *cache, const struct memo_key *key,
+        void *value)
+{
+    if (!cache || !key || !value)
+        return SIZE_MAX;
+    struct memo_stripe *s;
+    size_t set;
+    struct memo_entry *ways = find_set(cache, key, &s, &set);
+    size_t size = SIZE_MAX;
+    pthread_rwlock_rdlock(&s->lock);
+    for (size_t i = 0; i < MEMO_WAYS; ++i) {
+        struct memo_entry *e = &ways[i];
+        if (e->size != EMPTY_SIZE && e->hash[0] == key->hash[0] &&
+                e->hash[1] == key->hash[1]) {
+            size = e->size;
+            memcpy(value, e->value, size);
+            if (!__atomic_load_n(&e->referenced, __ATOMIC_RELAXED))
+                __atomic_store_n(&e->referenced, 1, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&s->lock);
+    __atomic_add_fetch(size == SIZE_MAX ? &s->misses : &s->hits, 1,
+            __ATOMIC_RELAXED);
+    return size;
+}
+
+/*
+ * Store a result, replacing any stored under the same key
+ * @param cache cache to store in
+ * @param key key from memo_key
+ * @param value result to store
+ * @param size size of the result
+ * @return 0 on success, or -1 if size > MEMO_VALUE_MAX
+ */
+int memo_cache_put(struct memo_cache *cache, const struct memo_key *key,
+        const void *value, size_t size)
+{
+    if (!cache || !key || (!value && size != 0) || size > MEMO_VALUE_MAX)
+        return -1;
+    struct memo_stripe *s;
+    size_t set;
+    struct memo_entry *ways = find_set(cache, key, &s, &set);
+    pthread_rwlock_wrlock(&s->lock);
+    struct memo_entry *slot = NULL;
+    for (size_t i = 0; i < MEMO_WAYS && !slot; ++i)
+        if (ways[i].size != EMPTY_SIZE &&
+                ways[i].hash[0] == key->hash[0] &&
+                ways[i].hash[1] == key->hash[1])
+            slot = &ways[i];
+    for (size_t i = 0; i < MEMO_WAYS && !slot; ++i)
+        if (ways[i].size == EMPTY_SIZE)
+            slot = &ways[i];
+    if (!slot) {
+        // every entry is in use; a full turn of the hand clears every mark,
+        // so this stops within MEMO_WAYS + 1 steps
+        uint8_t hand = s->hands[set];
+        while (ways[hand].referenced) {
+            ways[hand].referenced = 0;
+            hand = (hand + 1) % MEMO_WAYS;
+        }
+        slot = &ways[hand];
+        s->hands[set] = (hand + 1) % MEMO_WAYS;
+        ++s->evictions;
+    }
+    if (slot->size == EMPTY_SIZE || slot->hash[0] != key->hash[0] ||
+            slot->hash[1] != key->hash[1])
+        ++s->insertions;
+    slot->hash[0] = key->hash[0];
+    slot->hash[1] = key->hash[1];
+    slot->size = (uint8_t) size;
+    slot->referenced = 0;
+    if (size)
+        memcpy(slot->value, value, size);
+    pthread_rwlock_unlock(&s->lock);
+    return 0;
+}
+
+/*
+ * Read the counters of a cache
+ * @param cache cache to read
+ * @param out pointer to stats struct to write the totals to
+ */
+void memo_cache_get_stats(struct memo_cache *cache,
+        struct memo_cache_stats *out)
+{
+    if (!cache || !out)
+        return;
+    memset(out, 0, sizeof *out);
+    for (size_t i = 0; i < cache->num_stripes; ++i) {
+        struct memo_stripe *s = &cache->stripes[i];
+        pthread_rwlock_rdlock(&s->lock);
+        out->hits += __atomic_load_n(&s->hits, __ATOMIC_RELAXED);
+        out->misses += __atomic_load_n(&s->misses, __ATOMIC_RELAXED);
+        out->insertions += s->insertions;
+        out->evictions += s->evictions;
+        out->capacity += s->num_sets * MEMO_WAYS;
+        pthread_rwlock_unlock(&s->lock);
+    }
+}
+
+/*
+ * MurmurHash3's 64-bit finalizer
+ */
+static uint64_t fmix64(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+static uint64_t rotl64(uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/*
+ * Find the set of entries a key belongs in. The high half of the hash picks
+ * the stripe and the low half the set.
+ * @param stripe output for the set's stripe
+ * @param set output for the set's index in its stripe
+ * @return the set's first entry
+ */
+static struct memo_entry *find_set(struct memo_cache *cache,
+        const struct memo_key *key, struct memo_stripe **stripe,
+        size_t *set)
+{
+    struct memo_stripe *s = &cache->stripes[key->hash[1] %
+        cache->num_stripes];
+    *stripe = s;
+    *set = key->hash[0] & (s->num_sets - 1);
+    return &s->entries[*set * MEMO_WAYS];
+}
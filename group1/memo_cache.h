@@ -0,0 +1,104 @@
+/*
+ * memo_cache.h
+ * A bounded cache of analysis results, addressed by a 128-bit MurmurHash3 of
+ * the input bytes and the parameters they were analysed with. Inputs are not
+ * kept: two inputs are taken to be the same if their hashes are. The cache
+ * is split into stripes, each behind a reader-writer lock, so lookups run
+ * side by side; each stripe is a set-associative table that evicts with the
+ * clock algorithm, so lookups never have to take the write lock.
+ */
+
+#ifndef ___memo_cache_h___
+#define ___memo_cache_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Largest result a cache entry holds; entries are then one cache line each
+#define MEMO_VALUE_MAX 46
+
+struct memo_cache;
+
+// Identifies a result: the hash of an operation's input and parameters
+struct memo_key {
+    uint64_t hash[2];
+};
+
+// Running totals for a cache, summed over all of its stripes
+struct memo_cache_stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t insertions;
+    uint64_t evictions;
+    size_t capacity;    // entries the cache can hold
+};
+
+/*
+ * Create a result cache
+ * @param max_bytes most memory to use for entries; each stripe's share is
+ *        rounded down to a power of two sets of entries
+ * @param stripes number of independently locked partitions
+ *        precondition: stripes > 0
+ * @return pointer to the new cache, or NULL if it could not be allocated or
+ *         max_bytes is too small for one set per stripe
+ */
+struct memo_cache *memo_cache_create(size_t max_bytes, size_t stripes);
+
+/*
+ * Free a cache and all of its entries
+ */
+void memo_cache_destroy(struct memo_cache *cache);
+
+/*
+ * Compute the 128-bit x64 variant of MurmurHash3
+ * @param src bytes to hash
+ * @param len number of bytes in src
+ * @param seed seed
+ * @param out output for the two 64-bit halves of the hash
+ */
+void murmur3_128(const void *src, size_t len, uint32_t seed,
+        uint64_t out[2]);
+
+/*
+ * Make the key for a result
+ * @param op identifies the operation, so that different operations on the
+ *        same input don't share results
+ * @param param the operation's parameters, packed into 64 bits
+ * @param src input bytes
+ * @param len number of bytes in src
+ * @return the key
+ */
+struct memo_key memo_key(uint32_t op, uint64_t param, const void *src,
+        size_t len);
+
+/*
+ * Look up a result
+ * @param cache cache to look in
+ * @param key key from memo_key
+ * @param value output for the result
+ *        precondition: length of value buffer >= MEMO_VALUE_MAX
+ * @return size of the result, or SIZE_MAX if it isn't cached
+ */
+size_t memo_cache_get(struct memo_cache *cache, const struct memo_key *key,
+        void *value);
+
+/*
+ * Store a result, replacing any stored under the same key
+ * @param cache cache to store in
+ * @param key key from memo_key
+ * @param value result to store
+ * @param size size of the result
+ * @return 0 on success, or -1 if size > MEMO_VALUE_MAX
+ */
+int memo_cache_put(struct memo_cache *cache, const struct memo_key *key,
+        const void *value, size_t size);
+
+/*
+ * Read the counters of a cache
+ * @param cache cache to read
+ * @param out pointer to stats struct to write the totals to
+ */
+void memo_cache_get_stats(struct memo_cache *cache,
+        struct memo_cache_stats *out);
+
+#endif  // ___memo_cache_h___
@@ -0,0 +1,3903 @@
+/*
+ * ngram_tables.c
+ * Generated by ngram_tables.py from SampleText/; do not edit.
+ */
+
+#include "ngram_tables.h"
+
+const uint8_t english_byte_class[256] = {
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 58, 58, 60, 60, 58, 60, 60,
+    60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+    52, 57, 56, 59, 59, 59, 59, 56, 57, 57, 59, 59, 55, 57, 54, 59,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 57, 57, 59, 59, 59, 57,
+    59, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 59, 59, 59, 59, 59,
+    59, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 59, 59, 59, 59, 60,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+    61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+};
+
+const int16_t english_bigram_log2[NGRAM_CLASSES][NGRAM_CLASSES] = {
+    {
+        -3934, -1220, -1329, -1053, -3122, -1691, -1425, -3678, -1207, -3934,
+        -1577, -995, -1277, -617, -2887, -1468, -3934, -851, -803, -735,
+        -1630, -1266, -1773, -3016, -1308, -2760, -3934, -3934, -3934, -3934,
+        -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934,
+        -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934, -3934,
+        -3934, -3934, -1106, -3934, -2760, -2349, -2481, -2654, -3215, -3934,
+        -3934, -3528, -3934, -3934,
+    },
+    {
+        -1242, -2565, -3333, -3077, -276, -3333, -3333, -2565, -1562, -1403,
+        -3333, -772, -2739, -3077, -966, -3333, -3333, -1234, -1466, -1591,
+        -854, -3077, -3333, -3333, -926, -3333, -3333, -3333, -3333, -3333,
+        -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333,
+        -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333, -3333,
+        -3333, -3333, -2483, -3333, -3077, -3333, -3333, -3077, -3333, -3333,
+        -3333, -3333, -3333, -3333,
+    },
+    {
+        -870, -3511, -1353, -2999, -613, -3511, -3511, -680, -1182, -3511,
+        -1270, -1356, -3511, -3511, -566, -3511, -1807, -1368, -2743, -828,
+        -1321, -3511, -3511, -3511, -1210, -3511, -3511, -3511, -3511, -3511,
+        -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511,
+        -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511, -3511,
+        -3511, -3511, -1981, -3511, -2370, -2626, -3511, -2743, -2999, -3511,
+        -3511, -3511, -3511, -3511,
+    },
+    {
+        -1289, -3186, -3698, -1713, -800, -2574, -1915, -3186, -894, -3442,
+        -3442, -1845, -2053, -2174, -1181, -3698, -3442, -1669, -1479, -3698,
+        -1677, -1994, -2592, -3698, -1478, -3698, -3698, -3698, -3698, -3698,
+        -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698,
+        -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698, -3698,
+        -3698, -3698, -225, -3698, -1401, -1145, -2611, -1526, -2631, -3698,
+        -3698, -2467, -3698, -3698,
+    },
+    {
+        -1150, -2708, -1355, -939, -1324, -1701, -1980, -2269, -1544, -2693,
+        -2477, -1211, -1440, -890, -2433, -1733, -2169, -667, -1095, -1216,
+        -2981, -1446, -1927, -1685, -1514, -4122, -4122, -3148, -4122, -4122,
+        -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122,
+        -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122, -4122,
+        -4122, -4122, -479, -4122, -1595, -1374, -2414, -1807, -2779, -4122,
+        -4122, -2629, -4122, -4122,
+    },
+    {
+        -1020, -3476, -3476, -3476, -875, -1122, -3476, -3476, -1008, -3476,
+        -3476, -1662, -3476, -3071, -629, -3476, -3476, -990, -2964, -1241,
+        -1285, -3476, -3476, -3476, -2070, -3476, -3476, -3476, -3476, -3476,
+        -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476,
+        -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476, -3476,
+        -3476, -3476, -373, -3476, -1696, -1654, -3220, -1798, -2882, -3476,
+        -3476, -2591, -3476, -3476,
+    },
+    {
+        -1030, -1748, -3410, -2816, -765, -3410, -2097, -702, -1082, -3410,
+        -3410, -1115, -2560, -1636, -1095, -3410, -3410, -1016, -1410, -2038,
+        -1545, -3410, -3410, -3410, -2221, -3410, -3410, -3410, -3410, -3410,
+        -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410,
+        -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410, -3410,
+        -3410, -3410, -434, -3410, -1536, -1340, -2560, -1490, -2463, -2816,
+        -3410, -2598, -3410, -3410,
+    },
+    {
+        -623, -2387, -3853, -3003, -310, -2935, -3853, -3259, -748, -3853,
+        -3853, -2455, -2212, -3191, -952, -3853, -3853, -1963, -2585, -1322,
+        -1868, -3853, -3259, -3853, -2239, -3853, -3853, -3853, -3853, -3853,
+        -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853,
+        -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853, -3853,
+        -3853, -3853, -834, -3853, -2025, -1673, -2447, -2025, -3042, -3853,
+        -3853, -2967, -3853, -3853,
+    },
+    {
+        -1443, -1731, -1164, -1212, -1175, -1485, -1369, -3216, -3878, -3878,
+        -1859, -1115, -1127, -471, -1027, -1954, -3216, -1183, -736, -754,
+        -2720, -1355, -3622, -2385, -3878, -1424, -3878, -3878, -3878, -3878,
+        -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878,
+        -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878, -3878,
+        -3878, -3878, -3622, -3878, -3878, -3878, -3878, -3878, -3878, -3878,
+        -3878, -3878, -3878, -3878,
+    },
+    {
+        -2421, -2421, -2421, -2421, -302, -2421, -2421, -2421, -2165, -2421,
+        -2421, -2421, -2421, -2421, -580, -2421, -2421, -2421, -2421, -2421,
+        -495, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421,
+        -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421,
+        -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421,
+        -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421, -2421,
+        -2421, -2421, -2421, -2421,
+    },
+    {
+        -1925, -2993, -2993, -2993, -426, -1649, -2587, -1043, -770, -2993,
+        -2993, -1905, -2993, -716, -2587, -2993, -2993, -2993, -1157, -2993,
+        -2993, -2993, -1969, -2993, -1946, -2993, -2993, -2993, -2993, -2993,
+        -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993,
+        -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993, -2993,
+        -2993, -2993, -583, -2993, -1541, -1267, -2993, -1776, -2481, -2737,
+        -2993, -2587, -2993, -2993,
+    },
+    {
+        -1029, -3682, -2402, -939, -655, -1302, -2594, -3682, -715, -3682,
+        -1658, -706, -2077, -2540, -1074, -2244, -3682, -2426, -1683, -1628,
+        -1645, -1949, -1910, -3682, -819, -3682, -3682, -3682, -3682, -3682,
+        -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682,
+        -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682, -3682,
+        -3682, -3682, -809, -3682, -1831, -1672, -3170, -1910, -2764, -3682,
+        -3682, -2831, -3682, -3682,
+    },
+    {
+        -729, -1551, -3512, -3512, -534, -2006, -3512, -3256, -886, -3512,
+        -3512, -2488, -1484, -2354, -863, -1073, -3512, -3512, -1385, -2700,
+        -1079, -3512, -3512, -3512, -1087, -3512, -3512, -3512, -3512, -3512,
+        -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512,
+        -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512, -3512,
+        -3512, -3512, -702, -3512, -1459, -1347, -2098, -1737, -2465, -3512,
+        -3512, -2744, -3512, -3512,
+    },
+    {
+        -1546, -2225, -1155, -704, -840, -1880, -763, -2643, -1386, -2330,
+        -1719, -1690, -2952, -1438, -911, -2741, -2310, -2899, -1193, -886,
+        -2003, -1856, -2586, -2470, -1517, -3643, -3899, -3899, -3899, -3899,
+        -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899,
+        -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899, -3899,
+        -3899, -3899, -598, -3899, -1643, -1460, -2413, -1817, -2775, -3899,
+        -3899, -2656, -3899, -3899,
+    },
+    {
+        -2202, -1765, -1911, -1593, -2227, -856, -2192, -3113, -1775, -2279,
+        -1719, -1354, -1074, -699, -1270, -1543, -3330, -853, -1326, -1003,
+        -690, -1601, -1146, -3263, -2284, -3519, -3925, -3925, -3925, -3925,
+        -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925,
+        -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925, -3925,
+        -3925, -3925, -697, -3925, -2293, -2060, -3263, -2350, -2977, -3925,
+        -3925, -2950, -3925, -3925,
+    },
+    {
+        -789, -2934, -3339, -2934, -599, -3083, -2571, -1690, -1100, -3339,
+        -3339, -817, -2678, -3339, -772, -914, -3339, -672, -1484, -1187,
+        -1424, -3339, -3339, -3339, -1542, -3339, -3339, -3339, -3339, -3339,
+        -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339,
+        -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339, -3339,
+        -3339, -3339, -1287, -3339, -2293, -1986, -2365, -2293, -3083, -3339,
+        -3339, -2934, -3339, -3339,
+    },
+    {
+        -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420,
+        -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420,
+        -35, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420,
+        -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420,
+        -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420, -2420,
+        -2420, -2420, -2420, -2420, -2164, -2420, -2420, -2420, -2420, -2420,
+        -2420, -2420, -2420, -2420,
+    },
+    {
+        -1167, -2360, -1428, -1351, -551, -1860, -1722, -2101, -1021, -3591,
+        -1884, -1578, -1577, -1473, -1040, -2046, -3847, -1494, -1056, -1190,
+        -1742, -1861, -2210, -3847, -1188, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -540, -3847, -1204, -1311, -2040, -1827, -2846, -3847,
+        -3847, -2590, -3847, -3847,
+    },
+    {
+        -1191, -2360, -1710, -2523, -794, -2049, -2523, -940, -1013, -3847,
+        -2146, -2019, -2043, -2740, -1076, -1431, -3252, -3079, -1062, -828,
+        -1146, -3441, -2055, -3847, -2305, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847, -3847,
+        -3847, -3847, -430, -3847, -1328, -1290, -2311, -1786, -2759, -3441,
+        -3847, -2494, -3847, -3847,
+    },
+    {
+        -1253, -3720, -2271, -3570, -857, -2322, -3976, -467, -989, -3976,
+        -3976, -1555, -2181, -2381, -815, -3126, -3976, -1478, -1661, -1360,
+        -1528, -3976, -1958, -3976, -1516, -2642, -3976, -3976, -3976, -3976,
+        -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976,
+        -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976, -3976,
+        -3976, -3976, -511, -3976, -1647, -1448, -2503, -1924, -2696, -3976,
+        -3976, -2745, -3976, -3976,
+    },
+    {
+        -1300, -1535, -998, -1496, -1356, -2097, -1065, -3564, -1383, -3564,
+        -3308, -799, -1526, -868, -2796, -1303, -3564, -654, -812, -759,
+        -3564, -3308, -3564, -3308, -2902, -3052, -3564, -3564, -3564, -3564,
+        -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564,
+        -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564, -3564,
+        -3564, -3564, -935, -3564, -2052, -1882, -3308, -2261, -2969, -3564,
+        -3564, -2752, -3564, -3564,
+    },
+    {
+        -1027, -3205, -3205, -3205, -114, -3205, -3205, -3205, -700, -3205,
+        -3205, -3205, -3205, -3205, -1177, -3205, -3205, -2949, -3205, -3205,
+        -2693, -3205, -3205, -3205, -2394, -3205, -3205, -3205, -3205, -3205,
+        -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205,
+        -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205,
+        -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205, -3205,
+        -3205, -3205, -3205, -3205,
+    },
+    {
+        -547, -3063, -2807, -2750, -723, -2957, -3469, -639, -612, -3469,
+        -2494, -1933, -3469, -1198, -893, -3469, -3469, -1671, -1787, -3213,
+        -3469, -3469, -2521, -3469, -3469, -3469, -3469, -3469, -3469, -3469,
+        -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469,
+        -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469, -3469,
+        -3469, -3469, -902, -3469, -2016, -1757, -2874, -2189, -3213, -3469,
+        -3469, -2957, -3469, -3469,
+    },
+    {
+        -955, -2524, -649, -2524, -965, -2268, -2524, -1756, -934, -2524,
+        -2524, -2524, -2524, -2524, -2524, -417, -2268, -2524, -2524, -671,
+        -2012, -2524, -2524, -2524, -2268, -2524, -2524, -2524, -2524, -2524,
+        -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524,
+        -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524, -2524,
+        -2524, -2524, -1293, -2524, -2268, -2012, -2524, -2118, -2268, -2524,
+        -2524, -2524, -2524, -2524,
+    },
+    {
+        -2605, -1954, -3234, -1591, -1396, -2722, -3490, -3234, -1579, -3490,
+        -3490, -2423, -2046, -2423, -694, -2829, -3490, -2423, -1327, -1566,
+        -3490, -3490, -2829, -3490, -3490, -3490, -3490, -3490, -3490, -3490,
+        -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490,
+        -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490, -3490,
+        -3490, -3490, -195, -3490, -1194, -966, -1732, -1412, -2423, -3234,
+        -3490, -2332, -3490, -3490,
+    },
+    {
+        -152, -2550, -2550, -2550, -1237, -2550, -2550, -2550, -1831, -2550,
+        -2550, -1956, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550,
+        -2550, -2550, -1217, -2550, -864, -849, -2550, -2550, -2550, -2550,
+        -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550,
+        -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550,
+        -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550, -2550,
+        -2550, -2550, -2550, -2550,
+    },
+    {
+        -2366, -1554, -1960, -1854, -2366, -1013, -1854, -1704, -2366, -2366,
+        -2366, -1192, -1854, -446, -2366, -2110, -2366, -1086, -847, -952,
+        -1554, -2366, -2110, -2366, -1647, -2366, -2366, -1960, -1704, -1960,
+        -2366, -2110, -1598, -2366, -2110, -2366, -2110, -1854, -1704, -1391,
+        -2366, -2110, -2366, -1208, -1704, -1771, -2366, -2110, -2366, -2366,
+        -2366, -2366, -914, -2366, -2110, -2366, -2366, -2366, -2366, -2366,
+        -2366, -2366, -2366, -2366,
+    },
+    {
+        -1950, -2612, -2612, -2612, -446, -2612, -2612, -2612, -491, -2612,
+        -2612, -2206, -2612, -2612, -1093, -2612, -2612, -1356, -2612, -2612,
+        -482, -2612, -2612, -2612, -1588, -2612, -2612, -2612, -2612, -2612,
+        -1844, -2612, -2612, -2612, -2017, -2612, -2612, -2356, -2612, -2612,
+        -2206, -2612, -2612, -2100, -2612, -2612, -2100, -2612, -2612, -2612,
+        -2612, -2612, -2612, -2612, -2100, -2612, -2612, -2612, -2612, -2612,
+        -2612, -2612, -2612, -2612,
+    },
+    {
+        -550, -2436, -2436, -2436, -1625, -2436, -2436, -537, -2180, -2436,
+        -2436, -1717, -2436, -2436, -351, -2436, -2436, -2180, -2436, -2436,
+        -2436, -2436, -2436, -2436, -2436, -2436, -2180, -2436, -2436, -2436,
+        -1550, -2436, -2436, -1842, -1842, -2436, -2436, -2030, -2436, -2436,
+        -1924, -2436, -2436, -2436, -2436, -1586, -2436, -2436, -2436, -2436,
+        -2180, -2436, -2180, -2436, -2180, -2436, -2436, -2436, -2436, -2436,
+        -2436, -2436, -2436, -2436,
+    },
+    {
+        -164, -2399, -2399, -2399, -947, -2399, -2399, -2399, -1375, -2399,
+        -2399, -2399, -2399, -2399, -933, -2399, -2399, -1993, -2399, -2399,
+        -1993, -2399, -2399, -2399, -2399, -2399, -1737, -2399, -2399, -2399,
+        -1353, -2399, -2399, -2399, -1399, -2399, -2399, -2399, -2399, -2399,
+        -2143, -2399, -2399, -2399, -2399, -2399, -2399, -2399, -2143, -2399,
+        -2399, -2399, -1452, -2399, -2143, -1887, -2399, -2399, -2399, -2399,
+        -2399, -2399, -2399, -2399,
+    },
+    {
+        -1802, -2520, -2520, -2264, -2520, -2520, -2520, -2520, -2520, -2520,
+        -2520, -124, -2264, -1709, -2520, -2008, -2520, -2520, -2264, -2520,
+        -2520, -1317, -2520, -1670, -2520, -2520, -1573, -1859, -1752, -1752,
+        -2008, -2115, -2264, -2520, -2264, -2008, -2520, -2520, -1859, -1474,
+        -2520, -2115, -2264, -1546, -1709, -2115, -2520, -2264, -2520, -2115,
+        -2264, -2520, -1362, -2520, -1332, -2115, -2520, -2520, -1859, -2520,
+        -2520, -2520, -2520, -2520,
+    },
+    {
+        -1406, -2068, -2068, -2068, -1812, -2068, -2068, -2068, -670, -2068,
+        -2068, -2068, -2068, -2068, -390, -2068, -2068, -879, -2068, -2068,
+        -1812, -2068, -2068, -2068, -2068, -2068, -2068, -2068, -2068, -2068,
+        -2068, -2068, -2068, -2068, -1662, -2068, -2068, -2068, -2068, -2068,
+        -1406, -2068, -2068, -1812, -2068, -2068, -1556, -2068, -2068, -2068,
+        -2068, -2068, -1150, -1812, -1044, -2068, -2068, -1812, -2068, -2068,
+        -2068, -2068, -2068, -2068,
+    },
+    {
+        -456, -2160, -2160, -2160, -904, -2160, -2160, -2160, -1648, -2160,
+        -2160, -2160, -2160, -2160, -987, -2160, -2160, -1073, -2160, -2160,
+        -524, -2160, -2160, -2160, -2160, -2160, -1648, -2160, -2160, -2160,
+        -1566, -2160, -2160, -1904, -1904, -2160, -2160, -1648, -2160, -2160,
+        -2160, -2160, -2160, -1566, -2160, -2160, -1566, -2160, -2160, -2160,
+        -2160, -2160, -1442, -2160, -2160, -2160, -2160, -1904, -2160, -2160,
+        -2160, -2160, -2160, -2160,
+    },
+    {
+        -934, -2452, -2452, -2452, -253, -2452, -2452, -2452, -795, -2452,
+        -2452, -2452, -2452, -2452, -812, -2452, -2452, -2452, -2452, -2452,
+        -934, -2452, -2452, -2452, -2452, -2452, -1791, -2452, -2452, -2452,
+        -1734, -2452, -2452, -2452, -1734, -2452, -2452, -2452, -2452, -2452,
+        -2196, -2452, -2452, -2452, -2452, -2196, -2452, -2452, -2452, -2452,
+        -2452, -2452, -1858, -2452, -2452, -2452, -2452, -2452, -2196, -2452,
+        -2452, -2452, -2452, -2452,
+    },
+    {
+        -2924, -2924, -2924, -2924, -2924, -1205, -2668, -2924, -2924, -2924,
+        -2924, -2924, -2156, -1158, -2924, -2924, -2924, -2668, -1735, -874,
+        -2924, -2924, -2924, -2924, -2924, -2924, -2205, -2329, -2156, -2262,
+        -2156, -2668, -2518, -2924, -2412, -2924, -2924, -2205, -2262, -1900,
+        -2518, -2924, -2924, -2262, -2073, -2006, -2924, -2518, -2924, -2924,
+        -2924, -2518, -105, -2924, -2668, -2073, -2412, -2924, -2668, -2924,
+        -2924, -2924, -2924, -2924,
+    },
+    {
+        -97, -2208, -2208, -2208, -1358, -2208, -2208, -2208, -2208, -2208,
+        -2208, -2208, -2208, -2208, -1440, -2208, -2208, -2208, -2208, -2208,
+        -1546, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208,
+        -1614, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208,
+        -2208, -2208, -2208, -2208, -2208, -2208, -1696, -2208, -2208, -2208,
+        -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208, -2208,
+        -2208, -2208, -2208, -2208,
+    },
+    {
+        -1886, -1886, -1886, -1886, -839, -1886, -1886, -1886, -272, -1886,
+        -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886,
+        -1886, -1886, -1886, -1886, -1630, -1886, -1886, -1886, -1886, -1886,
+        -1886, -1886, -1886, -1886, -1630, -1886, -1886, -1886, -1886, -1886,
+        -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886, -1886,
+        -1886, -1886, -1374, -1886, -1886, -1630, -1886, -1886, -1630, -1886,
+        -1886, -1886, -1886, -1886,
+    },
+    {
+        -609, -2492, -2492, -2492, -1224, -2492, -2492, -2492, -718, -2492,
+        -2492, -2492, -2492, -2492, -568, -2492, -2492, -2492, -2492, -2492,
+        -851, -2492, -2492, -2492, -593, -2492, -1980, -2492, -2492, -2492,
+        -1980, -2492, -2492, -2492, -1405, -2492, -2492, -1773, -2492, -2492,
+        -2492, -2492, -2492, -2492, -2492, -2492, -2236, -2492, -2492, -2492,
+        -2236, -2492, -1898, -2492, -2492, -2086, -2492, -2492, -2492, -2492,
+        -2492, -2492, -2492, -2492,
+    },
+    {
+        -1129, -2766, -2766, -2766, -1247, -2766, -2766, -2766, -670, -2766,
+        -2766, -2766, -2766, -2766, -1659, -2766, -2766, -169, -2766, -2766,
+        -2104, -2766, -2766, -2766, -1016, -2766, -2171, -2766, -2766, -2766,
+        -2104, -2766, -2766, -2766, -2254, -2766, -2766, -2766, -2766, -2510,
+        -2766, -2510, -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766,
+        -1998, -2766, -2360, -2766, -2510, -2766, -2766, -2766, -2766, -2766,
+        -2766, -2766, -2766, -2766,
+    },
+    {
+        -1510, -2172, -2172, -2172, -490, -2172, -2172, -2172, -1766, -2172,
+        -2172, -2172, -2172, -2172, -374, -2172, -2172, -2172, -2172, -2172,
+        -2172, -2172, -2172, -2172, -2172, -2172, -1916, -1577, -1660, -1197,
+        -1360, -2172, -1660, -2172, -1660, -2172, -2172, -2172, -2172, -1916,
+        -1510, -2172, -2172, -2172, -1510, -1286, -2172, -2172, -2172, -2172,
+        -1577, -2172, -1660, -2172, -2172, -1916, -2172, -2172, -2172, -2172,
+        -2172, -2172, -2172, -2172,
+    },
+    {
+        -1855, -1706, -1706, -2111, -2111, -1111, -2111, -433, -2111, -2111,
+        -2111, -2111, -2111, -612, -2111, -2111, -2111, -1706, -2111, -1599,
+        -1343, -2111, -2111, -1855, -2111, -2111, -2111, -2111, -2111, -2111,
+        -2111, -1226, -2111, -2111, -2111, -1517, -1706, -1706, -2111, -1450,
+        -1706, -2111, -2111, -1164, -1599, -1450, -1343, -1855, -1855, -2111,
+        -2111, -2111, -1599, -2111, -2111, -2111, -2111, -2111, -1855, -2111,
+        -2111, -2111, -2111, -2111,
+    },
+    {
+        -957, -2174, -2174, -2174, -556, -2174, -2174, -850, -2174, -2174,
+        -2174, -1580, -2174, -2174, -1324, -2174, -2174, -425, -2174, -2174,
+        -1512, -2174, -2174, -2174, -2174, -2174, -1918, -2174, -2174, -2174,
+        -2174, -2174, -1768, -1918, -2174, -2174, -2174, -1662, -2174, -2174,
+        -1768, -2174, -2174, -1227, -2174, -1918, -1768, -2174, -2174, -2174,
+        -2174, -2174, -2174, -2174, -1918, -2174, -2174, -2174, -2174, -2174,
+        -2174, -2174, -2174, -2174,
+    },
+    {
+        -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542, -1542, -1542, -1286, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542, -1542,
+        -1542, -1542, -1542, -1542,
+    },
+    {
+        -1514, -2026, -2026, -2026, -795, -2026, -2026, -2026, -1364, -2026,
+        -2026, -2026, -2026, -2026, -546, -2026, -2026, -2026, -2026, -2026,
+        -2026, -2026, -2026, -2026, -2026, -2026, -1214, -2026, -1620, -1514,
+        -958, -2026, -1431, -2026, -1175, -2026, -1620, -2026, -2026, -2026,
+        -1258, -1770, -2026, -1364, -1770, -1620, -2026, -2026, -2026, -2026,
+        -2026, -2026, -938, -2026, -1514, -1431, -2026, -2026, -1620, -2026,
+        -2026, -2026, -2026, -2026,
+    },
+    {
+        -1230, -2388, -1413, -2388, -1321, -2388, -2388, -245, -901, -2388,
+        -2388, -2388, -2132, -2388, -1120, -1876, -2388, -2388, -2388, -1097,
+        -1132, -2388, -2388, -2388, -2388, -2388, -2388, -2388, -1794, -2388,
+        -1577, -2388, -2388, -2388, -1876, -2388, -2388, -2388, -2388, -2388,
+        -2388, -2388, -2388, -2388, -1876, -1669, -2132, -2388, -2388, -2388,
+        -2388, -2388, -1413, -2388, -1669, -2388, -1982, -2132, -2388, -2388,
+        -2388, -2388, -2388, -2388,
+    },
+    {
+        -2016, -2528, -2528, -2528, -1553, -2528, -2528, -111, -1610, -2528,
+        -2528, -2528, -2528, -2528, -1035, -2528, -2528, -1934, -2528, -2528,
+        -1581, -2528, -1809, -2528, -2528, -2528, -2016, -2528, -2528, -2528,
+        -1716, -2528, -2528, -1482, -1716, -2528, -2528, -2528, -2528, -2272,
+        -2016, -2528, -2528, -1866, -2528, -2528, -2272, -2528, -2528, -2528,
+        -1809, -2272, -1460, -2528, -2272, -2016, -2528, -2272, -2272, -2528,
+        -2528, -2528, -2528, -2528,
+    },
+    {
+        -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+        -1803, -1803, -1803, -662, -1803, -829, -1803, -1803, -1398, -1803,
+        -1803, -1803, -1803, -1803, -1803, -1803, -1547, -1803, -1547, -1209,
+        -1547, -1803, -1803, -1803, -1803, -1803, -1803, -1398, -1803, -1209,
+        -1803, -1803, -1803, -1547, -1547, -992, -1803, -1803, -1803, -1803,
+        -1803, -1803, -1085, -1803, -1291, -1803, -1803, -1803, -1803, -1803,
+        -1803, -1803, -1803, -1803,
+    },
+    {
+        -1012, -1674, -1674, -1674, -650, -1674, -1674, -1674, -1418, -1674,
+        -1674, -1674, -1674, -1674, -1162, -1674, -1674, -1674, -1674, -1674,
+        -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+        -1080, -1674, -1674, -1674, -1418, -1674, -1674, -1674, -1674, -1674,
+        -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+        -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+        -1674, -1674, -1674, -1674,
+    },
+    {
+        -1710, -2428, -2428, -2428, -670, -2428, -2428, -436, -333, -2428,
+        -2428, -2428, -2428, -2428, -1660, -2428, -2428, -2023, -2428, -2428,
+        -2428, -2428, -2428, -2428, -2428, -2428, -1834, -2428, -2428, -2428,
+        -2428, -2428, -2428, -2428, -1834, -2428, -2428, -2428, -2428, -2172,
+        -2172, -2428, -2428, -2428, -2428, -2428, -2428, -2428, -2428, -2428,
+        -2428, -2428, -2428, -2428, -1916, -2428, -2428, -2428, -2428, -2428,
+        -2428, -2428, -2428, -2428,
+    },
+    {
+        -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+        -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+        -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1291, -1547,
+        -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+        -1547, -1291, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+        -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+        -1547, -1547, -1547, -1547,
+    },
+    {
+        -2251, -2251, -2251, -2251, -687, -2251, -2251, -2251, -2251, -2251,
+        -2251, -2251, -2251, -2251, -164, -2251, -2251, -2251, -2251, -2251,
+        -2251, -2251, -2251, -2251, -2251, -2251, -2251, -2251, -2251, -1995,
+        -2251, -2251, -2251, -2251, -2251, -2251, -2251, -2251, -2251, -2251,
+        -1532, -2251, -2251, -2251, -2251, -1995, -2251, -2251, -2251, -2251,
+        -2251, -2251, -1250, -2251, -2251, -1656, -1845, -2251, -2251, -2251,
+        -2251, -2251, -2251, -2251,
+    },
+    {
+        -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+        -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+        -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+        -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+        -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1308, -1564,
+        -1158, -1158, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+        -1564, -1564, -1564, -1564,
+    },
+    {
+        -819, -1181, -1244, -1328, -1414, -1258, -1591, -930, -1111, -2295,
+        -1974, -1459, -1174, -1341, -1052, -1374, -2285, -1459, -993, -764,
+        -1765, -1828, -983, -4327, -1516, -4327, -2210, -1783, -2004, -2018,
+        -1973, -2452, -2309, -1997, -1501, -2210, -2657, -1906, -1629, -2434,
+        -2611, -2289, -4327, -2673, -2084, -2007, -3083, -3352, -2049, -4327,
+        -2391, -4327, -2395, -2587, -4327, -4327, -1987, -3024, -4327, -3559,
+        -4327, -3239, -4327, -4327,
+    },
+    {
+        -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175,
+        -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -1663,
+        -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175,
+        -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175,
+        -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175, -2175,
+        -2175, -2175, -1087, -404, -622, -1289, -2175, -1289, -639, -1407,
+        -2175, -2175, -2175, -2175,
+    },
+    {
+        -3240, -3240, -3240, -3240, -3240, -3240, -2579, -2984, -3240, -3240,
+        -3240, -3240, -3240, -3240, -2266, -2984, -3240, -3240, -3240, -3240,
+        -3240, -3240, -3240, -3240, -3240, -2984, -2984, -2984, -2835, -2984,
+        -2082, -2355, -3240, -3240, -3240, -3240, -3240, -3240, -3240, -3240,
+        -3240, -3240, -3240, -3240, -2728, -3240, -3240, -3240, -3240, -3240,
+        -3240, -3240, -129, -1984, -3240, -2522, -698, -2984, -790, -3240,
+        -3240, -2390, -3240, -3240,
+    },
+    {
+        -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377,
+        -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377,
+        -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377,
+        -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377,
+        -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377, -3377,
+        -3377, -3377, -21, -3121, -3377, -3377, -1147, -3377, -2159, -3377,
+        -3377, -2658, -3377, -3377,
+    },
+    {
+        -1629, -1752, -2245, -2245, -2840, -2095, -2840, -2095, -1772, -3096,
+        -3096, -2377, -2434, -2690, -2584, -2690, -3096, -2690, -694, -1487,
+        -3096, -2584, -1816, -3096, -2049, -3096, -1350, -1532, -1865, -1793,
+        -2210, -2178, -2121, -1526, -865, -2584, -2584, -1782, -1414, -1577,
+        -1468, -1865, -3096, -2434, -1743, -1327, -2148, -2245, -1353, -3096,
+        -1214, -3096, -749, -3096, -3096, -2690, -2434, -2690, -474, -3096,
+        -3096, -2434, -3096, -3096,
+    },
+    {
+        -1713, -1807, -1934, -1839, -2319, -2095, -2262, -1678, -1823, -2319,
+        -2575, -1856, -1764, -1981, -2386, -2006, -2725, -1559, -2063, -1303,
+        -2095, -2981, -2034, -2981, -2575, -2981, -2981, -2981, -2981, -2981,
+        -2981, -2981, -2981, -2981, -2725, -2981, -2981, -2725, -2981, -2981,
+        -2981, -2981, -2981, -2981, -2981, -2981, -2981, -2981, -2981, -2981,
+        -2981, -2981, -143, -2319, -2575, -2095, -809, -2169, -1245, -2130,
+        -2981, -1647, -2981, -2981,
+    },
+    {
+        -2012, -2542, -2136, -2542, -2286, -2417, -2880, -2542, -2325, -3136,
+        -2730, -2624, -2730, -2880, -2368, -2012, -3136, -2218, -2368, -2090,
+        -2624, -3136, -1978, -3136, -2624, -3136, -1600, -1783, -2251, -2189,
+        -1350, -2189, -2090, -1606, -1684, -2136, -2730, -1962, -1353, -2251,
+        -2136, -2112, -3136, -2730, -1567, -1257, -2730, -2730, -1606, -3136,
+        -2730, -3136, -1919, -1947, -3136, -3136, -502, -2325, -255, -2474,
+        -3136, -3136, -3136, -3136,
+    },
+    {
+        -1792, -1792, -1536, -1536, -1792, -1536, -1536, -1536, -1792, -1792,
+        -1792, -1536, -1792, -1792, -1792, -1073, -1792, -1792, -1792, -1792,
+        -1792, -1792, -1280, -1792, -1792, -1792, -1792, -1792, -1792, -1792,
+        -1536, -1792, -1792, -1792, -1792, -1792, -1792, -1536, -1792, -1792,
+        -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792,
+        -1792, -1792, -1130, -1024, -1792, -1792, -1792, -1792, -1024, -548,
+        -1792, -1792, -1792, -1792,
+    },
+    {
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536,
+    },
+    {
+        -1053, -1319, -1971, -2120, -2227, -1586, -2227, -1586, -1526, -2376,
+        -2632, -2376, -2038, -1782, -1508, -2120, -2632, -2227, -1309, -1243,
+        -2376, -2227, -1491, -2632, -2227, -2632, -2376, -2632, -2376, -2632,
+        -2227, -2632, -2632, -2632, -1545, -2632, -2632, -2632, -2038, -2632,
+        -2227, -2632, -2632, -2632, -2376, -2376, -2632, -2632, -2376, -2632,
+        -1971, -2632, -2376, -2632, -2632, -2120, -1586, -2632, -1821, -2632,
+        -2632, -160, -2632, -2632,
+    },
+    {
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536,
+    },
+    {
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1536,
+        -1536, -1536, -1536, -1536,
+    },
+};
+
+const uint8_t english_trigram_class[256] = {
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 27, 27, 31, 31, 27, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    26, 29, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 29, 30, 29, 30,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 29, 29, 30, 30, 30, 29,
+    30, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 30, 30, 30, 30, 30,
+    30, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 30, 30, 30, 30, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+};
+
+const int16_t english_trigram_log2[TRIGRAM_TABLE_SIZE] = {
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2211, -2723, -2723, -2723, -339, -2723, -2723, -1955,
+    -1278, -2723, -2723, -355, -2723, -2723, -814, -2723, -2723, -1873,
+    -1199, -2723, -1749, -2723, -2723, -2723, -2723, -2723, -2723, -2723,
+    -2723, -2723, -2723, -2723, -1805, -2616, -663, -2616, -676, -2616,
+    -2616, -633, -1325, -2616, -890, -2210, -2616, -2616, -2360, -2616,
+    -912, -1492, -2616, -575, -1730, -2616, -2616, -2616, -1348, -2616,
+    -2616, -2616, -2616, -2616, -2616, -2616, -1618, -2481, -2886, -1014,
+    -908, -1819, -2886, -2481, -1069, -2630, -2886, -2292, -1250, -2886,
+    -2036, -2886, -2630, -2292, -2001, -2886, -2118, -1182, -2886, -2886,
+    -786, -2886, -238, -2630, -2886, -1297, -2630, -2481, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -768,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -768, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -2298, -2298, -2298, -2298, -1298, -391, -2298, -2298, -2298, -2298,
+    -2298, -2298, -2298, -2298, -2298, -2298, -2298, -945, -2298, -276,
+    -2298, -2298, -2298, -2298, -2298, -2298, -2298, -2298, -2298, -1530,
+    -2042, -2298, -501, -2525, -2525, -2525, -295, -2525, -1757, -2525,
+    -966, -2525, -2525, -2525, -2525, -2269, -1257, -2525, -2525, -721,
+    -2269, -2525, -1863, -2525, -2525, -2525, -2525, -2525, -2525, -2525,
+    -2525, -2525, -2525, -2525, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -625, -1343, -1343, -2734, -2734, -2734, -448,
+    -2140, -2734, -2734, -2734, -2734, -2734, -2734, -1160, -1391, -273,
+    -2734, -2734, -2734, -942, -1261, -1305, -2734, -2478, -2734, -2734,
+    -2734, -2734, -2734, -2734, -2734, -2734, -2734, -2734, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2376, -2376, -2376, -2376, -182, -1146, -2376, -2120, -687, -2376,
+    -2376, -2376, -2376, -1658, -2376, -2376, -2376, -2376, -1782, -2376,
+    -2376, -2376, -2376, -2376, -2376, -2376, -852, -2376, -2376, -1352,
+    -2120, -2376, -1593, -2946, -2178, -2946, -1593, -1347, -2946, -2946,
+    -1372, -2946, -922, -268, -1351, -2946, -1388, -2946, -2946, -1690,
+    -1310, -1393, -1644, -2946, -1178, -2946, -2946, -2946, -699, -2227,
+    -2946, -1280, -2690, -2946, -1388, -1526, -2668, -2668, -551, -2668,
+    -2668, -2668, -659, -2668, -2668, -2668, -1667, -2668, -1253, -1543,
+    -2668, -2668, -2156, -2668, -1399, -2668, -2668, -2668, -2073, -2668,
+    -413, -2668, -2668, -837, -1262, -2262, -1974, -3327, -984, -266,
+    -1200, -3327, -1450, -3327, -1661, -3327, -1713, -2379, -3327, -1236,
+    -1763, -3327, -2515, -3327, -1391, -1089, -2921, -2815, -2665, -1897,
+    -967, -3071, -739, -2815, -3327, -1518, -2035, -2921, -1430, -1430,
+    -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430,
+    -1430, -1430, -1430, -1430, -1430, -383, -1430, -1430, -1430, -1430,
+    -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430, -1430,
+    -1110, -2481, -2481, -2481, -1190, -2481, -2481, -1394, -1481, -2481,
+    -2481, -2481, -2481, -2481, -1307, -190, -2481, -1819, -858, -832,
+    -2481, -2481, -2481, -2481, -2481, -2481, -1969, -2481, -2481, -2481,
+    -2481, -2481, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1202, -2496, -798, -752, -682, -2428,
+    -1532, -3090, -1174, -3090, -1416, -1128, -1382, -1543, -1846, -2371,
+    -3090, -901, -1357, -833, -3090, -2684, -2834, -3090, -1162, -3090,
+    -871, -3090, -3090, -1397, -2834, -2834, -1740, -3138, -2287, -3138,
+    -1196, -3138, -3138, -1846, -1256, -3138, -1484, -3138, -2882, -3138,
+    -1468, -2220, -3138, -3138, -1007, -920, -1376, -3138, -3138, -3138,
+    -1814, -3138, -149, -3138, -3138, -1510, -2370, -2882, -2691, -3203,
+    -1717, -3203, -791, -2947, -3203, -1030, -647, -3203, -3203, -2157,
+    -2485, -2609, -2229, -3203, -3203, -2014, -2318, -1036, -1348, -3203,
+    -3203, -3203, -2392, -3203, -244, -2609, -3203, -1541, -2798, -2798,
+    -2331, -2331, -2075, -1669, -2331, -2331, -356, -2331, -2331, -2331,
+    -2331, -1285, -2331, -677, -2331, -2331, -2331, -2075, -554, -722,
+    -2331, -2331, -2331, -2075, -2331, -2331, -2331, -2331, -2331, -2331,
+    -2331, -2331, -1630, -2676, -2676, -2676, -113, -2676, -2676, -2676,
+    -756, -2676, -2676, -2676, -2676, -2676, -849, -2676, -2676, -2676,
+    -2676, -2676, -2676, -2676, -2676, -2676, -2082, -2676, -2676, -2676,
+    -2676, -2676, -2676, -2676, -360, -2193, -2193, -1937, -1531, -1681,
+    -2193, -2193, -1019, -2193, -1218, -2193, -2193, -1068, -1937, -2193,
+    -2193, -2193, -1307, -2193, -2193, -2193, -2193, -2193, -2193, -2193,
+    -454, -2193, -2193, -1125, -1937, -1937, -1389, -1389, -1389, -1389,
+    -983, -1389, -1389, -1389, -1133, -1389, -1389, -1389, -1389, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389,
+    -1389, -1389, -621, -1133, -1389, -1389, -1389, -1389, -2637, -2637,
+    -2637, -2637, -1334, -2042, -2637, -2637, -1089, -2637, -2637, -2637,
+    -2042, -2381, -2231, -2637, -2637, -2637, -727, -2637, -2637, -2637,
+    -2637, -2637, -2637, -2637, -254, -2637, -2637, -525, -1975, -2125,
+    -1224, -1480, -1480, -1480, -393, -1480, -1480, -1480, -968, -1480,
+    -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480,
+    -1480, -1480, -1480, -1480, -1480, -1224, -1480, -1480, -1480, -1480,
+    -1480, -1480, -1818, -1323, -951, -1067, -2436, -949, -1022, -1262,
+    -1991, -2247, -2123, -934, -835, -1508, -1508, -1014, -1795, -1160,
+    -763, -1210, -2180, -1086, -977, -2842, -1420, -2842, -2842, -2842,
+    -2842, -2842, -2586, -2842, -1343, -1343, -831, -1087, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1087, -1343, -1343, -1343, -1343, -1087, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1846, -1846,
+    -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846,
+    -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846, -1846,
+    -1846, -1846, -1846, -1846, -168, -1184, -1846, -1846, -778, -1590,
+    -906, -1418, -1674, -1418, -1674, -1674, -1674, -1674, -1674, -1674,
+    -1674, -1674, -1418, -1674, -1674, -1674, -1674, -1674, -268, -955,
+    -1674, -1674, -1674, -1674, -1674, -1674, -1418, -1674, -1674, -1674,
+    -1674, -1674, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -2135, -655, -698, -1089, -2135, -2135,
+    -1879, -2135, -2135, -2135, -1879, -713, -2135, -588, -2135, -2135,
+    -2135, -844, -1416, -961, -2135, -2135, -2135, -2135, -2135, -2135,
+    -2135, -2135, -2135, -2135, -2135, -2135, -1353, -1353, -1353, -1353,
+    -759, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1097, -1353, -1353, -1353, -1097, -1353, -1353, -1353, -1353, -1353,
+    -1097, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1442, -3092, -1402, -2068, -785, -1077, -1324, -1426,
+    -1180, -3092, -3092, -1176, -3092, -913, -3092, -3092, -2686, -1075,
+    -1523, -623, -3092, -3092, -2497, -3092, -1720, -3092, -467, -2497,
+    -3092, -1678, -3092, -2836, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -585, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -2014, -2270, -2270, -1323, -2270, -2270, -2270, -2270, -2270, -2270,
+    -2270, -752, -2270, -142, -2270, -2270, -2270, -1459, -2014, -936,
+    -2270, -2270, -2270, -2270, -2270, -2270, -2270, -2270, -2270, -2270,
+    -2270, -2270, -1987, -1987, -1987, -1987, -59, -1987, -1987, -1987,
+    -1987, -1987, -1987, -1987, -1987, -1987, -1731, -1987, -1987, -1987,
+    -1987, -1987, -1987, -1987, -1987, -1987, -1987, -1987, -1987, -1987,
+    -1987, -1987, -1987, -1987, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1271, -2573, -2573, -2573,
+    -122, -2573, -2573, -2573, -840, -2573, -2573, -2573, -2573, -2573,
+    -1979, -2573, -2573, -2573, -2573, -2573, -1549, -2573, -2573, -2573,
+    -844, -2573, -2573, -2573, -2573, -2573, -2573, -2573, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -729, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1374, -2420, -2420, -723, -2420, -2420, -2420, -2420,
+    -2164, -2420, -2420, -1908, -1473, -1908, -968, -2420, -2420, -1140,
+    -2014, -816, -279, -1278, -1333, -1908, -1652, -2420, -2420, -2420,
+    -2420, -2420, -2420, -2420, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -765, -2171,
+    -2171, -2171, -684, -2171, -2171, -2171, -539, -2171, -2171, -2171,
+    -2171, -2171, -348, -2171, -2171, -2171, -2171, -2171, -1452, -2171,
+    -2171, -2171, -2171, -2171, -2171, -2171, -2171, -2171, -2171, -2171,
+    -1934, -1934, -1678, -1934, -219, -1934, -1934, -1934, -1215, -1934,
+    -1934, -1934, -1934, -1934, -760, -1934, -1934, -1934, -1934, -934,
+    -1122, -1934, -1934, -1934, -1934, -1934, -1678, -1934, -1934, -1934,
+    -1934, -1934, -886, -1833, -1833, -1833, -602, -1427, -1833, -1833,
+    -1321, -1833, -1833, -1427, -1833, -1833, -947, -1833, -1833, -1427,
+    -886, -1833, -1833, -1833, -1833, -1833, -1833, -1833, -602, -1833,
+    -1833, -833, -1833, -1833, -2611, -2611, -2611, -2611, -2611, -2611,
+    -2611, -2611, -1843, -2611, -2355, -1949, -2611, -2017, -2611, -2611,
+    -2611, -1892, -1087, -40, -2611, -2611, -2611, -2611, -1949, -2611,
+    -2611, -2611, -2611, -2611, -2611, -2611, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2432, -2432, -2432, -2432, -1770, -2432, -2432, -2432,
+    -2432, -2432, -2432, -2432, -2432, -2432, -2432, -2432, -2432, -2432,
+    -1243, -2432, -2432, -2432, -2432, -2432, -2432, -2432, -37, -1770,
+    -2432, -1920, -2176, -2432, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1116, -1116, -1372, -1372, -1372, -1372, -1372,
+    -1372, -966, -1372, -1372, -777, -1372, -1116, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -812, -1324,
+    -1324, -1324, -1068, -1324, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1035, -1291, -1291, -1291, -1291, -1291, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -2694, -1883,
+    -1694, -2694, -2694, -2694, -2694, -2694, -2694, -2694, -2438, -894,
+    -929, -517, -2694, -1164, -2694, -706, -734, -707, -948, -2694,
+    -2694, -2694, -2694, -2694, -2694, -2694, -2694, -2694, -2694, -2694,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -626, -2190, -2190, -2190, -434, -2190, -2190, -2190,
+    -1243, -2190, -2190, -2190, -2190, -2190, -497, -2190, -2190, -2190,
+    -2190, -2190, -724, -2190, -2190, -2190, -2190, -2190, -2190, -2190,
+    -2190, -2190, -2190, -2190, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -801, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1543, -2905, -2055, -995,
+    -1341, -2093, -2905, -2905, -979, -2905, -2905, -1296, -1905, -1166,
+    -2905, -1212, -2905, -810, -903, -2905, -2905, -2905, -2905, -2905,
+    -2905, -2905, -427, -2393, -2905, -656, -2137, -2055, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -663, -2609, -2865, -2865, -975, -2353, -2865, -2865,
+    -1079, -2865, -2865, -2353, -1597, -2609, -1252, -2865, -2865, -2015,
+    -2609, -2865, -1741, -2865, -2865, -2865, -2865, -2865, -203, -2609,
+    -2865, -1059, -2865, -2609, -931, -1758, -2353, -1009, -725, -1841,
+    -2353, -2353, -1841, -2353, -2353, -1405, -2353, -939, -915, -981,
+    -2353, -817, -1228, -768, -2353, -739, -2353, -2353, -2353, -2353,
+    -2353, -2353, -2353, -2353, -2353, -2353, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -2267, -2267,
+    -2267, -2267, -999, -2267, -1861, -319, -1179, -2267, -2267, -1320,
+    -2267, -878, -1861, -2267, -2267, -2267, -1499, -2267, -2267, -2267,
+    -1861, -2267, -1220, -2267, -653, -2011, -2267, -1036, -2267, -2267,
+    -572, -2195, -2195, -2195, -406, -2195, -2195, -2195, -781, -2195,
+    -2195, -2195, -2195, -2195, -789, -2195, -2195, -2195, -2195, -2195,
+    -736, -2195, -2195, -2195, -1683, -2195, -2195, -2195, -2195, -2195,
+    -2195, -2195, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1795, -2984, -2984, -2578,
+    -2984, -2216, -2472, -2728, -2472, -2984, -2984, -812, -552, -426,
+    -2098, -1562, -2728, -1454, -2036, -2066, -488, -1524, -2728, -2984,
+    -2984, -2984, -2984, -2984, -2984, -2728, -2984, -2984, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -99, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -1803, -1803, -1583, -2177, -2177, -2177, -365, -2177, -2177, -2177,
+    -341, -2177, -2177, -2177, -2177, -2177, -1003, -2177, -2177, -2177,
+    -2177, -2177, -988, -2177, -2177, -2177, -1665, -2177, -2177, -2177,
+    -2177, -2177, -2177, -2177, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -947, -1353, -1353, -1353, -1353, -1353, -1353,
+    -947, -1353, -1353, -841, -1353, -1353, -1188, -2694, -2694, -2694,
+    -658, -2288, -2694, -2694, -474, -2694, -2694, -975, -2694, -2694,
+    -1694, -2694, -2694, -1438, -1314, -2694, -1130, -2694, -2694, -2694,
+    -2694, -2694, -528, -1607, -2694, -986, -2694, -2694, -2219, -2219,
+    -1963, -2219, -1963, -2219, -2219, -2219, -1963, -2219, -2219, -394,
+    -726, -1707, -2219, -1301, -2219, -507, -797, -1195, -2219, -2219,
+    -2219, -2219, -2219, -2219, -2219, -2219, -2219, -2219, -2219, -2219,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2324, -2324, -2324, -2324,
+    -2324, -2324, -2324, -2324, -1730, -2324, -2324, -2324, -2324, -2324,
+    -2324, -2324, -2324, -2324, -2324, -2324, -2324, -2324, -2324, -2324,
+    -2324, -2324, -251, -2324, -2324, -392, -910, -2068, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1170, -1426, -1020, -870, -1276, -1170, -1682, -1276, -1087, -1682,
+    -1682, -1682, -1276, -1426, -1426, -1170, -1682, -1682, -1426, -1170,
+    -1682, -1682, -493, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -801, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -411, -1147, -1553, -959, -741, -1553, -1324, -1068,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1068, -1324, -1324, -1324, -918, -1324,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -2600, -1714, -2194, -2600, -2600, -2600, -2600, -2600,
+    -1625, -2600, -2600, -1938, -1344, -848, -2600, -2088, -2600, -320,
+    -2600, -1076, -786, -2194, -2194, -2600, -555, -2344, -2600, -2600,
+    -2600, -2600, -2600, -2600, -907, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1057, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -2035, -2035,
+    -2035, -2035, -345, -2035, -2035, -2035, -637, -2035, -2035, -1316,
+    -2035, -2035, -1523, -2035, -2035, -605, -1523, -2035, -2035, -2035,
+    -2035, -2035, -2035, -2035, -1117, -2035, -2035, -1316, -2035, -2035,
+    -767, -1738, -1193, -736, -1163, -1419, -1681, -2912, -2400, -2400,
+    -2912, -1123, -1709, -937, -2912, -1338, -2506, -689, -876, -1303,
+    -2317, -2026, -2912, -2912, -2912, -2912, -778, -2656, -2912, -1234,
+    -2656, -2317, -741, -1459, -1459, -1459, -1459, -1459, -1459, -1459,
+    -1459, -1459, -1459, -1459, -1459, -1459, -1459, -1459, -1459, -1459,
+    -1459, -1459, -459, -1459, -1459, -1459, -1459, -1459, -1459, -1459,
+    -1459, -1459, -1459, -1459, -1865, -1865, -1865, -1865, -132, -1865,
+    -1865, -1865, -1015, -1865, -1865, -1865, -1097, -1865, -1865, -1865,
+    -1865, -1865, -1865, -1865, -1865, -1865, -1865, -1865, -1865, -1865,
+    -1865, -1865, -1865, -1865, -1865, -1865, -1313, -1313, -1313, -1313,
+    -907, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1057, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -755, -2221,
+    -1444, -737, -1104, -1047, -1612, -2816, -2816, -2816, -2816, -1559,
+    -2304, -539, -2004, -2816, -2816, -1241, -540, -1122, -2154, -1642,
+    -2816, -2816, -2816, -2816, -2816, -2816, -2816, -2816, -2816, -2816,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1922, -1922, -1922, -1922, -654, -1922,
+    -1922, -1922, -1666, -1922, -1922, -1922, -1922, -1922, -1516, -1922,
+    -1922, -1922, -1922, -1922, -1922, -1922, -1922, -1922, -160, -1922,
+    -1922, -1922, -1922, -1922, -1922, -1922, -1759, -1759, -1759, -1759,
+    -1353, -1759, -1759, -1759, -122, -1759, -1759, -1759, -1759, -1759,
+    -1759, -1759, -1759, -1759, -1759, -1759, -1759, -1759, -1759, -1759,
+    -1759, -1759, -1759, -1759, -1759, -1759, -1759, -1759, -1674, -1674,
+    -1674, -1674, -150, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+    -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+    -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674, -1674,
+    -2550, -2550, -2038, -2550, -896, -2550, -2550, -2550, -1306, -2550,
+    -2550, -1782, -1206, -599, -1144, -1955, -2550, -1955, -2294, -2038,
+    -960, -2144, -821, -2550, -2550, -2144, -425, -2144, -2550, -1098,
+    -2550, -2550, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -678, -2076, -2076, -2076,
+    -220, -2076, -2076, -2076, -845, -2076, -2076, -2076, -2076, -2076,
+    -934, -2076, -2076, -2076, -2076, -2076, -2076, -2076, -2076, -2076,
+    -2076, -2076, -2076, -2076, -2076, -1670, -2076, -2076, -2246, -2246,
+    -2246, -2246, -2246, -2246, -2246, -780, -2246, -2246, -2246, -2246,
+    -2246, -2246, -809, -2246, -2246, -2246, -2246, -1435, -2246, -2246,
+    -2246, -2246, -2246, -2246, -301, -2246, -2246, -542, -1990, -1652,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1069, -2069, -298, -2069, -1069, -2069, -2069, -2069,
+    -2069, -2069, -2069, -838, -2069, -2069, -1663, -1475, -2069, -726,
+    -1813, -945, -2069, -2069, -2069, -2069, -2069, -2069, -2069, -2069,
+    -2069, -2069, -2069, -2069, -267, -1803, -1803, -1803, -1291, -1803,
+    -1803, -1803, -490, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1203, -1459, -1459, -1459,
+    -459, -1459, -1459, -1459, -1054, -1459, -1459, -1459, -1459, -1459,
+    -1203, -1459, -1459, -1203, -1459, -1459, -1459, -1459, -1459, -1459,
+    -1459, -1459, -1459, -1459, -1459, -1203, -1459, -1459, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2247, -2247, -1991, -2247, -2247, -2247, -2247, -2247, -1479, -2247,
+    -2247, -2247, -2247, -2247, -2247, -2247, -2247, -2247, -858, -2247,
+    -2247, -2247, -2247, -2247, -2247, -2247, -148, -2247, -2247, -795,
+    -1273, -1991, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -890, -961, -1450, -1448, -1259, -1288,
+    -1676, -828, -993, -1856, -1994, -1489, -1107, -1003, -1098, -1464,
+    -2285, -1552, -1046, -654, -1738, -1905, -1072, -3474, -1536, -3474,
+    -3474, -3474, -3068, -3474, -2706, -3218, -1181, -1437, -1437, -1437,
+    -1181, -1181, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1181, -1437, -1181, -1032, -925, -1437, -1437, -776, -1437,
+    -1437, -1437, -1032, -1437, -1437, -1437, -1437, -1437, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780,
+    -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780, -2780,
+    -2780, -2780, -2780, -2780, -2780, -2780, -68, -976, -2780, -2780,
+    -942, -2118, -1666, -1260, -1666, -1666, -1666, -1154, -1666, -854,
+    -1666, -1666, -1666, -1410, -1666, -947, -1666, -1666, -1666, -1666,
+    -579, -620, -1410, -1666, -1410, -1666, -1666, -1666, -1260, -1666,
+    -1666, -1410, -1666, -1666, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -2978, -1414, -1216, -896,
+    -2978, -2466, -1655, -2978, -2978, -2978, -1125, -990, -2316, -1123,
+    -2978, -2316, -2978, -467, -638, -766, -1541, -1143, -2978, -2978,
+    -2978, -2978, -1564, -2978, -2978, -1932, -2466, -2978, -1276, -1426,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -465, -1682, -1682, -1170, -1682, -524, -1426, -1682,
+    -1682, -1682, -1276, -1682, -963, -1682, -1682, -1682, -1682, -1682,
+    -1125, -2775, -2519, -2263, -709, -2775, -2775, -1558, -1222, -2775,
+    -1687, -1377, -2775, -2775, -894, -2775, -2775, -1633, -2369, -205,
+    -1386, -2775, -2775, -2775, -1889, -2775, -2775, -2775, -2775, -2775,
+    -2775, -2775, -2591, -3186, -3186, -2185, -1906, -3186, -1655, -3186,
+    -1216, -3186, -3186, -1788, -3186, -2139, -2467, -3186, -3186, -2780,
+    -2780, -3186, -1942, -3186, -2780, -3186, -2591, -3186, -115, -2211,
+    -3186, -632, -2591, -2118, -1269, -2805, -1781, -803, -2805, -2805,
+    -2805, -2805, -1269, -2805, -1252, -877, -957, -396, -2805, -1177,
+    -2805, -1549, -1698, -1100, -2805, -2293, -2805, -2805, -2805, -2805,
+    -753, -2293, -2805, -1781, -2293, -2549, -1777, -2439, -2439, -2439,
+    -903, -1033, -2439, -2439, -1182, -2439, -2439, -1049, -2439, -2439,
+    -323, -2439, -2439, -1491, -2183, -891, -798, -2439, -2439, -2439,
+    -1844, -2439, -1085, -2439, -2439, -1491, -2439, -2439, -324, -2177,
+    -2177, -2177, -1409, -2177, -1291, -2177, -677, -2177, -2177, -1090,
+    -2177, -2177, -1771, -2177, -2177, -697, -1921, -2177, -1202, -2177,
+    -2177, -2177, -1771, -2177, -1131, -2177, -2177, -1921, -2177, -2177,
+    -337, -1922, -1922, -1922, -477, -1922, -1922, -1922, -922, -1922,
+    -1922, -1922, -1922, -1922, -898, -1922, -1922, -1922, -1922, -1922,
+    -1922, -1922, -1922, -1922, -1922, -1922, -1922, -1922, -1922, -1922,
+    -1922, -1922, -2589, -2589, -2589, -2589, -2589, -2589, -948, -2589,
+    -2589, -2589, -2589, -2589, -2333, -559, -2589, -1995, -2589, -335,
+    -1565, -840, -2589, -699, -2589, -2589, -2589, -1995, -2589, -2589,
+    -2589, -2589, -2589, -2589, -1628, -1628, -1628, -1628, -604, -1628,
+    -1628, -1628, -1628, -1628, -1628, -1628, -1628, -1628, -486, -1628,
+    -1628, -1628, -1628, -1628, -627, -1628, -1628, -1628, -1628, -1628,
+    -1628, -1628, -1628, -1628, -1628, -1628, -1759, -1759, -1759, -1759,
+    -652, -1759, -1759, -1759, -991, -1759, -1759, -1759, -1759, -1759,
+    -1759, -1759, -1759, -1759, -601, -1759, -1759, -1759, -1759, -1759,
+    -1759, -1759, -556, -1759, -1759, -812, -1759, -1759, -1268, -2997,
+    -1808, -1164, -1315, -670, -2997, -2997, -403, -2997, -2997, -771,
+    -2591, -2997, -1625, -1567, -2997, -2997, -1491, -1229, -2402, -1497,
+    -2997, -2997, -785, -2997, -1214, -2741, -2997, -2022, -2741, -2997,
+    -819, -841, -2692, -2692, -507, -2692, -2692, -2692, -1550, -2692,
+    -2692, -2692, -2692, -1624, -1139, -897, -2692, -2692, -1192, -2692,
+    -2692, -2692, -2692, -2692, -2436, -2692, -603, -2692, -2692, -776,
+    -2692, -2436, -1814, -1558, -981, -863, -1076, -2830, -1413, -2830,
+    -1383, -2018, -2385, -2032, -3236, -1069, -1486, -3236, -3236, -2980,
+    -1245, -450, -2212, -2350, -3236, -3236, -2385, -3236, -501, -2641,
+    -3236, -1294, -2468, -2574, -1792, -1792, -1792, -1792, -1792, -1792,
+    -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1386, -1792, -319,
+    -1792, -618, -1792, -1792, -1024, -874, -1792, -1792, -1792, -1792,
+    -1792, -1792, -1792, -1792, -1792, -1792, -863, -2410, -2410, -2410,
+    -645, -2410, -2410, -1221, -1285, -2410, -2410, -564, -2410, -2410,
+    -1193, -2004, -2410, -937, -1492, -645, -1559, -2410, -2410, -2410,
+    -2410, -2410, -951, -2410, -2410, -1691, -2410, -2410, -2008, -2008,
+    -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008,
+    -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008, -53, -2008,
+    -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008, -2008,
+    -1415, -2226, -1921, -2457, -714, -1482, -1714, -1825, -1284, -3201,
+    -3201, -1735, -1643, -1695, -2268, -2411, -3457, -1984, -941, -1349,
+    -2738, -1487, -2012, -3457, -955, -3457, -353, -2738, -3457, -794,
+    -1611, -2240, -2776, -3032, -1484, -1890, -942, -3032, -3032, -1944,
+    -1231, -3032, -3032, -2520, -2520, -3032, -1468, -1257, -2626, -3032,
+    -473, -655, -2008, -3032, -3032, -3032, -2626, -3032, -554, -2626,
+    -3032, -804, -2057, -2008, -1694, -2911, -1568, -2911, -1143, -2250,
+    -2911, -393, -1241, -2911, -2911, -1994, -2911, -2143, -1911, -2911,
+    -2911, -1787, -1668, -751, -1146, -2911, -1370, -2911, -1298, -2911,
+    -610, -2655, -2911, -949, -1609, -2911, -1466, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1061, -1466, -748, -1061, -1210, -1466, -1210, -1466, -1466,
+    -1466, -1466, -698, -1466, -1466, -1061, -1466, -1466, -1448, -2691,
+    -2691, -2691, -44, -2691, -2691, -2691, -1050, -2691, -2691, -2691,
+    -2691, -2691, -1567, -2691, -2691, -2691, -2691, -2691, -2691, -2691,
+    -2691, -2691, -2691, -2691, -2691, -2691, -2691, -2691, -2691, -2691,
+    -1178, -1819, -1563, -2225, -1178, -2225, -2225, -1157, -956, -2225,
+    -2225, -1969, -2225, -2225, -1713, -2225, -2225, -2225, -795, -2225,
+    -2225, -2225, -2225, -2225, -2225, -2225, -248, -1969, -2225, -945,
+    -1819, -2225, -889, -2458, -581, -2458, -1087, -2458, -2458, -1739,
+    -1300, -2458, -2458, -2458, -2458, -2458, -2458, -351, -2202, -2458,
+    -2458, -638, -1946, -2458, -2458, -2458, -2458, -2458, -1864, -2458,
+    -2458, -1864, -2458, -2458, -2619, -2619, -2619, -2619, -1015, -2619,
+    -2619, -2619, -2213, -2619, -2619, -2619, -2619, -1733, -1285, -2619,
+    -2619, -2619, -1900, -2619, -2619, -2619, -2619, -2619, -2619, -2619,
+    -140, -2619, -2619, -729, -1146, -2619, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -918, -1253,
+    -1068, -1230, -1336, -1177, -1479, -933, -1043, -2158, -1933, -1320,
+    -1099, -1332, -951, -1202, -2200, -1340, -961, -837, -1770, -1688,
+    -885, -3645, -1481, -3645, -3645, -3645, -3389, -3645, -2577, -2697,
+    -995, -1590, -1334, -1334, -1334, -1078, -1590, -1334, -1334, -1590,
+    -1590, -1078, -1590, -1590, -1590, -822, -1590, -1334, -1078, -1078,
+    -1334, -1590, -1078, -1590, -1590, -1590, -871, -1078, -1590, -1590,
+    -1590, -1590, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2979, -2979, -2979, -2979, -2979, -2979,
+    -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979,
+    -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979, -2979,
+    -67, -1144, -1855, -2979, -842, -2032, -994, -1317, -1506, -1912,
+    -1506, -1912, -1506, -1506, -1912, -1912, -1656, -1400, -1400, -1656,
+    -1912, -1656, -1912, -1400, -222, -1656, -1506, -1912, -1656, -1912,
+    -1912, -1912, -1317, -1912, -1912, -1317, -1656, -1656, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -2473, -1812, -828, -2473, -2473, -2473, -2473, -2473, -894, -2473,
+    -2473, -1111, -564, -1182, -2473, -2473, -2473, -820, -1000, -623,
+    -1427, -920, -2473, -2473, -2473, -2473, -2473, -2473, -2473, -2473,
+    -2473, -2473, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1064, -2355,
+    -604, -1949, -669, -2611, -2611, -2611, -2205, -2611, -2611, -789,
+    -1726, -1298, -2611, -2611, -2611, -596, -1205, -1892, -2611, -2205,
+    -1021, -2611, -2611, -2611, -1111, -2611, -2611, -1152, -2099, -2355,
+    -1105, -2373, -2373, -2373, -219, -2373, -2373, -2373, -651, -2373,
+    -2373, -1778, -2373, -1967, -1142, -2373, -2373, -1654, -2373, -2373,
+    -1605, -2373, -2373, -2373, -2117, -2373, -975, -2373, -2373, -1248,
+    -2373, -2373, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1840, -2502, -682, -1233,
+    -629, -1584, -1554, -2502, -2502, -2502, -2502, -1616, -2502, -618,
+    -2502, -2502, -2502, -594, -1434, -954, -2502, -1210, -2502, -1258,
+    -2502, -2502, -2502, -2502, -2502, -2502, -2502, -2502, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -716, -1890, -1890, -1890, -547, -1890, -1890, -1890,
+    -687, -1890, -1890, -1890, -1890, -1890, -1005, -1890, -1890, -1890,
+    -1890, -1890, -716, -1890, -1890, -1890, -823, -1890, -1890, -1890,
+    -1890, -1890, -1890, -1890, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1302, -1302, -1302, -1302,
+    -897, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -2868, -2868,
+    -2868, -2868, -2868, -2868, -2868, -2868, -2868, -2868, -2868, -1178,
+    -2868, -1781, -1801, -2868, -2868, -51, -2868, -2868, -1038, -2868,
+    -2868, -2612, -2868, -2868, -2868, -2868, -2868, -2868, -2868, -2868,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1073, -2510, -2510, -2510, -848, -2510,
+    -2510, -2510, -550, -2510, -2510, -2510, -2510, -2510, -198, -2510,
+    -2510, -2510, -2510, -2510, -1998, -2510, -2510, -2510, -2510, -2510,
+    -2510, -2510, -2510, -2510, -2510, -2510, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -801, -1313, -1313, -1313, -1313, -1313, -2261, -2261,
+    -2261, -2261, -104, -2261, -2261, -2005, -2005, -2261, -2261, -2261,
+    -2261, -2005, -2261, -2261, -2261, -2261, -2261, -2261, -2261, -2261,
+    -2261, -2261, -1493, -2261, -687, -2261, -2261, -2005, -2261, -2261,
+    -2224, -2224, -2224, -2224, -2224, -2224, -1818, -2224, -2224, -2224,
+    -2224, -186, -2224, -1117, -2224, -2224, -2224, -880, -737, -1117,
+    -2224, -2224, -2224, -2224, -2224, -2224, -2224, -2224, -2224, -2224,
+    -2224, -2224, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1599, -1599,
+    -1599, -1599, -1599, -1599, -1599, -1599, -575, -1599, -1599, -1599,
+    -1599, -1599, -1599, -1599, -1599, -1599, -1599, -1599, -1599, -1599,
+    -1599, -1599, -1599, -1599, -369, -1599, -1599, -1194, -1599, -1599,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -907, -1402, -1244, -1413, -1312, -1475, -1532, -679,
+    -1042, -1933, -2083, -1410, -979, -1583, -1348, -1345, -2388, -1538,
+    -1043, -574, -1735, -1965, -1197, -3107, -1161, -3107, -3107, -3107,
+    -2851, -3107, -2701, -2851, -1324, -1324, -1324, -1324, -1068, -1324,
+    -1324, -1324, -1068, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1068, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1068, -1324, -1324, -1324, -1324, -1324, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -2167, -2167,
+    -2167, -2167, -2167, -2167, -2167, -2167, -2167, -2167, -2167, -2167,
+    -2167, -2167, -1399, -2167, -2167, -2167, -2167, -2167, -2167, -2167,
+    -2167, -2167, -2167, -2167, -126, -1025, -1316, -1761, -875, -2167,
+    -742, -1628, -909, -909, -1372, -1372, -1222, -860, -966, -1628,
+    -1628, -1372, -1628, -1628, -1372, -1372, -1628, -1222, -1222, -1628,
+    -1628, -1628, -1222, -1628, -1372, -1628, -1372, -1628, -1628, -1372,
+    -1628, -1628, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -2451, -2451, -1939, -2451, -2451, -2451,
+    -815, -2451, -405, -2451, -2451, -1310, -1534, -773, -2451, -2195,
+    -2451, -540, -2451, -1195, -2195, -965, -2451, -2451, -1939, -2195,
+    -2451, -2451, -2451, -2451, -2451, -2451, -1771, -1771, -1771, -1771,
+    -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1515,
+    -113, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771,
+    -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -729, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -2663, -2663, -2663, -773, -2663, -2663, -2663, -2663,
+    -2663, -2663, -2663, -2001, -1094, -633, -1432, -2663, -2663, -731,
+    -1163, -793, -2663, -2663, -2663, -2663, -2663, -2663, -580, -2663,
+    -2663, -871, -2257, -2257, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1547, -1547, -1547, -1547,
+    -344, -1547, -1547, -1547, -1142, -1547, -1547, -779, -1547, -1547,
+    -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+    -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -2459, -1256,
+    -2715, -2715, -1485, -2459, -2715, -2715, -1715, -2715, -2715, -1447,
+    -2715, -2715, -2121, -2715, -2715, -2715, -2459, -187, -2715, -2715,
+    -2715, -2715, -2715, -2715, -520, -2715, -2715, -1131, -2053, -2203,
+    -1327, -1377, -2351, -2095, -1946, -2095, -2095, -2351, -2351, -2351,
+    -2351, -2351, -1148, -513, -1690, -2351, -2351, -715, -1351, -1377,
+    -2351, -337, -2351, -2351, -2351, -2351, -2351, -2351, -2351, -2351,
+    -2351, -2351, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -771, -2319, -2319, -2319,
+    -156, -2319, -2319, -2319, -1433, -2319, -2319, -2319, -2319, -2319,
+    -1344, -2319, -2319, -2319, -2319, -2319, -2319, -2319, -2319, -2319,
+    -771, -2319, -2319, -2319, -2319, -2319, -2319, -2319, -1372, -1372,
+    -1372, -1372, -521, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -812, -1858, -1602, -1858, -684, -1858, -1858, -1858, -655, -1858,
+    -1858, -1858, -1858, -1858, -669, -1858, -1858, -1858, -1196, -1858,
+    -1858, -1858, -1858, -1858, -1858, -1858, -790, -1858, -1858, -1007,
+    -1858, -1602, -2095, -2351, -2351, -1583, -1946, -2351, -2351, -2351,
+    -852, -2351, -2351, -2351, -2351, -793, -370, -2351, -2351, -1946,
+    -2095, -962, -1690, -1404, -1501, -2351, -2351, -2351, -685, -2351,
+    -2351, -989, -2351, -1839, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -483, -2423,
+    -2423, -2423, -223, -2423, -2423, -2423, -1155, -2423, -2423, -2423,
+    -2423, -2423, -957, -2423, -2423, -2423, -2423, -2423, -2423, -2423,
+    -2423, -2423, -1356, -2423, -2423, -2423, -2423, -2423, -2423, -2423,
+    -2048, -2048, -2048, -2048, -2048, -2048, -2048, -2048, -2048, -2048,
+    -2048, -2048, -2048, -2048, -2048, -2048, -2048, -2048, -2048, -1101,
+    -2048, -2048, -2048, -2048, -2048, -2048, -239, -2048, -2048, -430,
+    -2048, -2048, -1580, -1580, -1580, -1580, -1580, -1580, -1580, -226,
+    -1580, -1580, -1580, -1580, -1580, -1580, -1324, -1580, -1580, -1580,
+    -1580, -1580, -1580, -1580, -1580, -1580, -1580, -1580, -1580, -1580,
+    -1580, -1580, -1324, -1580, -782, -2073, -2073, -2073, -739, -2073,
+    -2073, -2073, -771, -2073, -2073, -1073, -1187, -1667, -1817, -2073,
+    -2073, -1223, -1126, -395, -2073, -2073, -2073, -2073, -2073, -2073,
+    -2073, -2073, -2073, -2073, -2073, -2073, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487,
+    -1487, -1487, -1487, -1487, -675, -1487, -1487, -1487, -1487, -1081,
+    -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -719, -1487,
+    -1487, -719, -1487, -1487, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -793, -1302, -1385, -1521,
+    -1314, -1294, -1856, -823, -993, -2169, -2386, -1258, -1044, -1566,
+    -975, -1456, -2468, -1618, -1171, -575, -1712, -1956, -1021, -2980,
+    -1381, -2980, -2980, -2980, -2980, -2980, -2574, -2980, -992, -1398,
+    -1142, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -992,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1142, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -679, -1398, -1398, -1398, -1398,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2326, -2326, -2326, -2326, -2326, -2326, -2326, -2326,
+    -2326, -2326, -2326, -2326, -2326, -2326, -1607, -2326, -2326, -2326,
+    -2326, -2326, -2326, -2326, -2326, -2326, -2326, -2326, -80, -1122,
+    -2326, -2326, -928, -2070, -1838, -1838, -1838, -1582, -1582, -1582,
+    -1838, -1838, -1838, -1838, -1838, -1582, -1838, -1838, -1838, -1119,
+    -1838, -547, -1244, -332, -1838, -1838, -1582, -1838, -1838, -1838,
+    -1176, -1838, -1582, -1582, -1582, -1838, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -3236, -2212,
+    -2517, -623, -2424, -3236, -2724, -3236, -2111, -3236, -2424, -1192,
+    -1216, -944, -3236, -1048, -3236, -1097, -1174, -403, -2385, -681,
+    -3236, -3236, -2980, -2980, -3236, -3236, -3236, -3236, -3236, -3236,
+    -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1380, -1636,
+    -1636, -1636, -1636, -1636, -177, -1636, -1636, -1636, -1636, -1636,
+    -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636,
+    -1636, -1636, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -521, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1398, -3553, -2507, -1575,
+    -2323, -3553, -3553, -3553, -1288, -3553, -3553, -2047, -1260, -1175,
+    -3297, -3553, -3553, -454, -1695, -2060, -3553, -3147, -2336, -3553,
+    -1188, -3553, -261, -2466, -3553, -1817, -3297, -3553, -1389, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1133,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -504, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1324, -1324, -1324, -1324, -729, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -3115, -2396, -784, -2709, -1812, -2709,
+    -1603, -3115, -3115, -3115, -3115, -1191, -604, -627, -2197, -1541,
+    -3115, -1437, -348, -2008, -3115, -2140, -3115, -3115, -3115, -3115,
+    -3115, -3115, -3115, -3115, -3115, -3115, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1595, -1595, -1595, -1595, -933, -1595, -1595, -1595, -1595, -1595,
+    -1595, -1595, -1595, -1595, -1595, -1595, -1595, -1595, -1595, -1595,
+    -1595, -1595, -1595, -1595, -242, -1595, -1595, -1595, -1595, -1595,
+    -1595, -1595, -1350, -1756, -1756, -1756, -124, -1756, -1756, -1756,
+    -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756,
+    -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756,
+    -1756, -1756, -1756, -1756, -1334, -1334, -1334, -1334, -822, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -928, -1334, -1334, -1334, -1334, -1334, -2917, -2917, -1871, -2149,
+    -2511, -2917, -2917, -2917, -1893, -2917, -2917, -1116, -1062, -1353,
+    -1247, -987, -2917, -1178, -1074, -2255, -349, -2917, -701, -2917,
+    -2917, -2917, -860, -2511, -2917, -1714, -2917, -2917, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1359, -1953, -1953, -1953, -354, -1953, -1953, -1953,
+    -1068, -1953, -1953, -1953, -1953, -1953, -369, -1953, -1953, -1953,
+    -1953, -1953, -1291, -1953, -1953, -1953, -1953, -1953, -1953, -1953,
+    -1953, -1953, -1953, -1953, -1268, -1524, -1524, -1524, -1524, -1524,
+    -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524,
+    -1524, -1524, -1524, -1268, -1524, -1524, -1524, -1524, -1524, -1524,
+    -550, -1524, -1524, -550, -1119, -1524, -2543, -2543, -2287, -2543,
+    -602, -1313, -2543, -2138, -2031, -2543, -2543, -1596, -2287, -2287,
+    -1355, -2543, -2543, -2543, -1287, -1732, -2543, -2543, -2543, -2543,
+    -1949, -2543, -223, -2287, -2543, -821, -2031, -2287, -2115, -2115,
+    -2115, -2115, -2115, -2115, -1859, -2115, -2115, -2115, -2115, -2115,
+    -573, -813, -2115, -2115, -2115, -453, -479, -1453, -2115, -2115,
+    -2115, -2115, -2115, -2115, -2115, -2115, -2115, -2115, -2115, -2115,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -812, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1068, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1736, -1736, -1736, -1736,
+    -1736, -1736, -1736, -1736, -1736, -1736, -1736, -1736, -1736, -1330,
+    -1736, -1142, -1736, -1736, -1142, -1736, -1736, -1736, -1736, -1736,
+    -1736, -1736, -263, -1736, -1736, -712, -1736, -1736, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -669, -1475, -1293, -1492, -1353, -1314, -1536, -794, -1044, -1834,
+    -1999, -1438, -1055, -1585, -1022, -1382, -2428, -1448, -989, -731,
+    -1779, -1999, -985, -3023, -1443, -3023, -3023, -3023, -2075, -3023,
+    -3023, -3023, -860, -1372, -1372, -1116, -1372, -1372, -1372, -1372,
+    -1116, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -966, -1372, -1372, -1372, -1372, -1116, -1372, -1372, -1116,
+    -1372, -1372, -1372, -1372, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2407, -2407, -2407, -2407,
+    -2407, -2407, -2407, -2151, -2407, -2407, -2407, -2407, -2407, -2407,
+    -2407, -2407, -2407, -2407, -2407, -2407, -2407, -2407, -2407, -2407,
+    -2407, -2151, -69, -1026, -2407, -2407, -1044, -2001, -1604, -1348,
+    -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604,
+    -1604, -1604, -1604, -1604, -1604, -1604, -198, -1604, -1604, -1604,
+    -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604, -1604,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -2453, -994, -2453, -2453, -2453, -2453, -691, -2453,
+    -2453, -2453, -2453, -694, -817, -1016, -2453, -2453, -2453, -1329,
+    -2453, -738, -2453, -2453, -2453, -2453, -2453, -2453, -764, -2453,
+    -2453, -941, -1082, -2048, -2184, -2184, -2184, -2184, -795, -2184,
+    -2184, -2184, -882, -2184, -2184, -248, -2184, -2184, -2184, -2184,
+    -2184, -995, -2184, -2184, -725, -2184, -2184, -2184, -2184, -2184,
+    -2184, -2184, -2184, -2184, -2184, -2184, -1001, -2723, -2723, -2723,
+    -664, -2723, -2723, -380, -958, -2723, -713, -1837, -2723, -2723,
+    -2129, -2723, -2723, -2723, -2061, -1223, -977, -2723, -2723, -2723,
+    -2467, -2723, -1193, -2211, -2723, -1581, -2467, -2723, -1652, -2676,
+    -2676, -1825, -419, -2676, -1728, -2676, -1270, -2676, -2676, -1728,
+    -2676, -2676, -2164, -2676, -2676, -2676, -1957, -2676, -1825, -2676,
+    -2676, -2676, -2420, -2676, -257, -2676, -2676, -943, -2676, -2270,
+    -2712, -2712, -1323, -469, -2712, -1165, -2712, -2712, -2712, -2712,
+    -2712, -1055, -2712, -617, -2712, -2712, -2712, -1688, -682, -980,
+    -1765, -807, -1350, -2712, -2712, -2712, -2118, -2712, -2712, -2307,
+    -2712, -2712, -2463, -2463, -2463, -2463, -741, -692, -2463, -2463,
+    -864, -2463, -2463, -1545, -2463, -2463, -1695, -2463, -2463, -2463,
+    -2463, -1339, -1322, -2463, -2463, -2463, -1233, -2463, -287, -2463,
+    -2463, -1652, -2463, -2207, -1576, -2523, -2523, -2523, -987, -2523,
+    -2523, -129, -1190, -2523, -2523, -2523, -2523, -791, -2117, -2523,
+    -2523, -2267, -2267, -2523, -1436, -2523, -2523, -2523, -2523, -2523,
+    -2523, -2523, -2523, -2267, -2523, -2523, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -672, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1057, -1313, -1313, -907, -1313,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2065, -2065, -2065, -2065, -56, -2065, -2065, -2065,
+    -1297, -2065, -2065, -2065, -2065, -2065, -2065, -2065, -2065, -2065,
+    -2065, -2065, -2065, -2065, -2065, -2065, -2065, -2065, -2065, -2065,
+    -2065, -2065, -2065, -2065, -1823, -2770, -2770, -1246, -703, -2052,
+    -2770, -2770, -855, -2770, -2770, -264, -2770, -2770, -2002, -2770,
+    -2770, -2770, -1823, -1823, -2514, -2770, -2514, -2770, -707, -2770,
+    -1373, -2514, -2770, -1612, -2514, -2514, -1098, -2760, -2760, -2760,
+    -582, -2760, -2760, -2760, -1504, -2760, -2760, -2760, -1146, -2504,
+    -1875, -727, -2760, -2760, -943, -2760, -2504, -2760, -2760, -2760,
+    -2760, -2760, -453, -2760, -2760, -708, -2760, -2248, -1648, -3413,
+    -1285, -1106, -958, -1636, -351, -2602, -1517, -2346, -1355, -1800,
+    -2602, -1883, -2819, -3413, -1914, -3413, -1171, -999, -1613, -1795,
+    -3413, -3413, -3157, -3413, -563, -3008, -3413, -1489, -2240, -2695,
+    -2856, -2856, -2600, -1789, -2856, -2856, -2856, -2856, -2856, -2856,
+    -2856, -1683, -2856, -60, -2856, -2856, -2856, -1576, -1653, -2856,
+    -868, -2856, -2856, -2856, -2856, -2856, -2856, -2856, -2856, -2856,
+    -2856, -2856, -702, -1982, -1982, -1982, -1982, -1982, -1982, -1982,
+    -1214, -1982, -1982, -1214, -1470, -1982, -1982, -1576, -1982, -1982,
+    -568, -958, -1982, -1982, -1982, -1982, -1982, -1982, -610, -1982,
+    -1982, -875, -1007, -1982, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -672, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1324, -2448, -1157, -1786,
+    -590, -2704, -2704, -2704, -1026, -2704, -2192, -1059, -1530, -2704,
+    -1892, -2704, -2704, -1729, -780, -1370, -2448, -2704, -2704, -2704,
+    -1818, -2704, -376, -2704, -2704, -1198, -2704, -2704, -1498, -2891,
+    -1439, -2261, -1027, -1450, -1856, -941, -1296, -3147, -2379, -1845,
+    -2335, -3147, -2079, -1446, -2891, -2379, -993, -780, -1989, -3147,
+    -3147, -3147, -2552, -3147, -249, -2485, -3147, -1439, -2741, -2891,
+    -1349, -3147, -2553, -3147, -982, -2741, -3147, -458, -1203, -3147,
+    -3147, -2261, -3147, -2261, -1903, -3147, -3147, -3147, -1233, -976,
+    -1442, -3147, -3147, -3147, -958, -1804, -473, -2891, -3147, -967,
+    -2741, -2379, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -1473, -349, -1473, -1473, -1473, -1473, -1473,
+    -1068, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -1473, -988, -2536, -2536, -2536, -134, -2536,
+    -2536, -2536, -596, -2536, -2536, -2536, -2536, -2536, -1874, -2536,
+    -2536, -2536, -2536, -2536, -2536, -2536, -2536, -2536, -2536, -2536,
+    -2536, -2536, -2536, -2536, -2536, -2536, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1654, -1654,
+    -1654, -1654, -465, -1654, -1654, -1654, -1142, -1654, -1654, -1654,
+    -1654, -1654, -1654, -1398, -1654, -1654, -1654, -679, -1654, -1654,
+    -1654, -1654, -1654, -1654, -630, -1654, -1654, -1654, -1654, -1654,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -73, -2470, -2470, -2470, -1470, -2470, -2470, -2470,
+    -2064, -2470, -2470, -2470, -2470, -2470, -2470, -2470, -2470, -2470,
+    -2470, -2470, -2470, -2470, -2470, -2470, -2470, -776, -2470, -2470,
+    -2470, -2470, -2470, -2470, -647, -1294, -890, -896, -1607, -1471,
+    -1938, -691, -2056, -2568, -1288, -1666, -1166, -1426, -1568, -1849,
+    -2418, -1471, -811, -1123, -2056, -2229, -827, -2824, -2824, -2824,
+    -2824, -2824, -2824, -2824, -2824, -2824, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -612, -1380, -1380, -1380,
+    -868, -1380, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1057, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -907, -1313,
+    -1313, -1313, -1313, -1313, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -2147, -2147, -2147, -2147,
+    -2147, -2147, -2147, -2147, -2147, -2147, -2147, -2147, -1429, -43,
+    -2147, -2147, -2147, -2147, -2147, -2147, -2147, -2147, -2147, -2147,
+    -2147, -2147, -2147, -2147, -2147, -2147, -2147, -2147, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1400, -2168, -56, -2168, -2168, -2168,
+    -2168, -2168, -2168, -2168, -2168, -2168, -2168, -1317, -2168, -2168,
+    -2168, -2168, -1912, -2168, -2168, -2168, -1762, -2168, -2168, -2168,
+    -2168, -2168, -2168, -2168, -2168, -2168, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1926, -1926, -1926, -1926, -1926, -1926,
+    -1926, -1520, -327, -1926, -1264, -1926, -1926, -1264, -1926, -1926,
+    -1926, -1926, -1926, -1670, -768, -1926, -1926, -1926, -537, -1926,
+    -1926, -1926, -1926, -1926, -1926, -1926, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1997, -1997, -1997, -552,
+    -1997, -1997, -1591, -1997, -1997, -1997, -1997, -1741, -1403, -1229,
+    -1997, -1997, -1997, -1079, -235, -1997, -1997, -1997, -1997, -1997,
+    -1997, -1997, -1997, -1997, -1997, -1997, -1997, -1997, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1437, -370, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -2583, -2583,
+    -2583, -494, -1065, -2583, -2583, -2583, -2583, -2583, -2583, -1153,
+    -2583, -850, -2583, -1516, -2583, -1864, -1221, -1697, -2583, -2583,
+    -1496, -2583, -2583, -2583, -349, -2327, -2583, -1194, -2177, -2583,
+    -333, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -678, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -897, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -54, -2004, -2004, -2004, -2004, -2004,
+    -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004,
+    -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004, -2004,
+    -2004, -2004, -2004, -2004, -2004, -2004, -2310, -2310, -2310, -2310,
+    -2054, -2310, -2310, -2310, -2310, -2310, -2310, -1286, -2310, -99,
+    -2310, -2310, -2310, -2310, -1798, -726, -2310, -2310, -2310, -2310,
+    -2310, -2310, -2310, -2310, -2310, -2310, -2310, -2310, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1445, -1445, -1445, -1445, -594, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -594, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2300, -2300, -2300, -2300,
+    -696, -2300, -2300, -2300, -1895, -2300, -2300, -2300, -2300, -2300,
+    -89, -2300, -2300, -2300, -2300, -2300, -2300, -2300, -2300, -2300,
+    -2300, -2300, -2300, -2300, -2300, -2300, -2300, -2300, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -897, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1908, -1908, -1908, -1908,
+    -1908, -1908, -1908, -1908, -1908, -1908, -1908, -1908, -1908, -1908,
+    -1502, -1908, -1908, -1908, -1908, -1908, -1908, -1908, -1908, -1908,
+    -1908, -1908, -237, -1396, -1908, -486, -1908, -1652, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -398, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1181, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -520, -1437, -1437, -776, -1437, -1437,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -778, -1481, -1577, -2428, -1616, -1404, -2022, -898,
+    -783, -2428, -2428, -1542, -1286, -1542, -660, -1340, -2172, -1766,
+    -1136, -750, -1542, -2172, -941, -2428, -1184, -2428, -2428, -2428,
+    -2428, -2428, -2022, -2428, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1068, -1324, -1324, -1068, -1324, -1324, -1324,
+    -1324, -1068, -1324, -1324, -1068, -1324, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1978, -1978,
+    -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978,
+    -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978,
+    -1978, -1978, -1978, -1978, -104, -1260, -1978, -1978, -978, -1722,
+    -1324, -1068, -1068, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1068, -1068, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -2705, -1819, -937, -543, -2705, -1893,
+    -1787, -2705, -997, -2705, -1937, -2705, -1267, -972, -2705, -1986,
+    -2705, -761, -890, -687, -1283, -2299, -1402, -2705, -1136, -2449,
+    -2299, -2705, -2705, -2193, -2705, -2705, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1530, -1530,
+    -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530,
+    -1530, -1530, -341, -1530, -1530, -1530, -1530, -1530, -762, -1530,
+    -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530,
+    -2749, -2749, -2749, -2749, -1283, -2749, -2749, -2493, -1662, -2749,
+    -2749, -2030, -2749, -2343, -1864, -2749, -2749, -1546, -1802, -2749,
+    -2749, -2749, -2749, -2749, -2749, -2749, -70, -2749, -2749, -938,
+    -2493, -2343, -775, -2627, -1210, -941, -2221, -1480, -1709, -3033,
+    -2033, -3033, -3033, -2438, -1321, -1105, -3033, -2777, -3033, -1527,
+    -961, -999, -3033, -1986, -2265, -2147, -845, -3033, -473, -2777,
+    -3033, -885, -1945, -2438, -1736, -2398, -2398, -2398, -2398, -2398,
+    -2398, -2398, -1547, -2398, -2398, -2398, -2398, -2398, -2398, -2398,
+    -2398, -2398, -2398, -2398, -1630, -2398, -2398, -2398, -2398, -2398,
+    -261, -2398, -2398, -394, -953, -1630, -933, -1445, -1445, -1445,
+    -445, -1445, -1445, -1445, -1189, -1445, -1445, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1169, -1541, -1167, -2268, -827, -1407, -991, -2325, -2986, -2986,
+    -984, -2986, -1520, -657, -2392, -1572, -2986, -2175, -1289, -762,
+    -2986, -1282, -2986, -2986, -2986, -538, -2986, -2986, -2986, -2986,
+    -2986, -2986, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2069, -2069, -2069, -2069, -420, -2069,
+    -2069, -2069, -522, -2069, -2069, -2069, -2069, -2069, -2069, -2069,
+    -2069, -2069, -1407, -2069, -2069, -2069, -2069, -2069, -2069, -2069,
+    -551, -2069, -2069, -895, -2069, -2069, -1763, -2980, -2980, -2980,
+    -1062, -2724, -2980, -2980, -742, -2980, -2980, -2980, -2980, -2468,
+    -1117, -2980, -2980, -2980, -1893, -2980, -1874, -2980, -2980, -2980,
+    -791, -2980, -248, -2468, -2980, -902, -1600, -2212, -1324, -1729,
+    -1729, -1729, -1324, -1729, -1729, -1729, -1729, -1729, -1729, -1473,
+    -1729, -1135, -205, -1729, -1729, -1729, -1729, -1729, -1729, -1729,
+    -1729, -1729, -1729, -1729, -1135, -1729, -1729, -1324, -1729, -1729,
+    -1466, -1466, -1466, -1466, -325, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1466, -2413, -2413, -1623, -1645, -2669, -2413, -1481, -2669,
+    -2669, -2669, -2669, -2669, -2669, -430, -718, -1563, -2157, -1563,
+    -999, -947, -1051, -886, -716, -2669, -1466, -2669, -2669, -2669,
+    -2669, -2669, -2669, -2669, -1618, -1618, -1618, -1618, -1618, -1618,
+    -1618, -1618, -1106, -1618, -1618, -1618, -1618, -1618, -1618, -1618,
+    -1618, -1362, -1618, -1618, -1618, -1618, -1618, -1618, -1618, -1618,
+    -238, -1618, -1618, -1106, -1618, -1618, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1518, -1518,
+    -1518, -1518, -262, -1518, -1518, -1518, -1518, -1518, -1518, -1518,
+    -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518,
+    -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518,
+    -2047, -2047, -2047, -2047, -457, -2047, -2047, -2047, -1791, -2047,
+    -2047, -2047, -2047, -2047, -703, -2047, -2047, -2047, -2047, -1452,
+    -2047, -2047, -2047, -2047, -2047, -2047, -483, -2047, -2047, -675,
+    -2047, -2047, -1690, -2095, -2095, -2095, -839, -2095, -2095, -892,
+    -1245, -2095, -2095, -1839, -2095, -2095, -1284, -2095, -2095, -1434,
+    -1501, -2095, -2095, -2095, -2095, -2095, -865, -2095, -286, -2095,
+    -2095, -1071, -2095, -1839, -1231, -1922, -416, -756, -844, -2178,
+    -2178, -2178, -1922, -2178, -2178, -2178, -1666, -1020, -2178, -2178,
+    -2178, -1666, -876, -672, -2178, -2178, -2178, -2178, -2178, -2178,
+    -2178, -2178, -2178, -2178, -2178, -2178, -1825, -1825, -1825, -1825,
+    -132, -1825, -1825, -1825, -907, -1825, -1825, -1825, -1825, -1825,
+    -1825, -1825, -1825, -1825, -1825, -1825, -1825, -1825, -1825, -1825,
+    -1825, -1825, -1825, -1825, -1825, -1825, -1825, -1825, -87, -1855,
+    -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855,
+    -1855, -1855, -1599, -1855, -1855, -1855, -1855, -1855, -1855, -1855,
+    -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2893, -2893, -2893, -992, -2893, -2893, -2893, -2893,
+    -1847, -2893, -2893, -2893, -2893, -2487, -2893, -2893, -2893, -2893,
+    -2893, -2893, -2893, -2893, -2893, -2893, -2893, -2893, -97, -2487,
+    -2893, -730, -2381, -2125, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -956, -994, -1166, -1354,
+    -1378, -1083, -1489, -992, -1053, -2216, -1831, -1433, -1113, -1072,
+    -997, -1246, -2216, -1426, -1069, -650, -1831, -1878, -1177, -2878,
+    -1411, -2878, -2878, -2878, -2622, -2878, -2622, -2472, -1389, -1133,
+    -1389, -1389, -1389, -1133, -1389, -1133, -1389, -1389, -1389, -1133,
+    -1389, -1389, -1389, -983, -1389, -877, -1389, -983, -1389, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2288, -2288, -2288, -2288, -2288, -2288, -2288, -2288,
+    -2288, -2288, -2288, -2288, -2288, -2288, -2288, -2288, -2288, -2288,
+    -2288, -2288, -2288, -2288, -2288, -2288, -2288, -2288, -93, -1313,
+    -2288, -2288, -752, -1882, -1609, -947, -1353, -1203, -1353, -1353,
+    -1353, -1015, -1353, -947, -1353, -1609, -1353, -890, -1609, -1609,
+    -1353, -1203, -1015, -1203, -1097, -1609, -1015, -1609, -1609, -1609,
+    -1353, -1609, -1609, -1609, -1609, -1609, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -2805, -2399,
+    -1887, -960, -2805, -2805, -1332, -2805, -1201, -2805, -818, -1258,
+    -1887, -446, -2805, -2805, -2805, -672, -1443, -896, -2805, -2805,
+    -2805, -2549, -829, -1699, -2399, -2805, -2805, -1955, -2037, -2805,
+    -872, -2013, -2013, -2013, -271, -2013, -2013, -2013, -1757, -2013,
+    -2013, -576, -2013, -2013, -2013, -2013, -2013, -1128, -2013, -1128,
+    -2013, -2013, -2013, -2013, -2013, -2013, -2013, -2013, -2013, -2013,
+    -2013, -2013, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1107, -2221, -2733, -927,
+    -1483, -2583, -2989, -2583, -2989, -2989, -2989, -1771, -1559, -525,
+    -2733, -2989, -2989, -1028, -1230, -1124, -2989, -2989, -2041, -2989,
+    -2989, -2989, -443, -2989, -2989, -775, -2989, -2138, -1662, -1662,
+    -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662,
+    -1662, -1662, -156, -1662, -1662, -1662, -1662, -1662, -1662, -1662,
+    -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662, -1662,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1379, -2712, -2050, -1666, -2306, -2712,
+    -753, -2712, -2712, -2712, -2712, -621, -2712, -533, -2712, -2712,
+    -2712, -1138, -430, -1306, -2712, -2712, -2712, -1862, -2712, -2712,
+    -2712, -2712, -2712, -2712, -2712, -2712, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1422, -1422, -1422, -1422, -1016, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -447, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -947, -2072, -2072, -2072, -244, -2072, -2072, -2072,
+    -1124, -2072, -2072, -2072, -2072, -2072, -627, -2072, -2072, -2072,
+    -2072, -2072, -947, -2072, -2072, -2072, -2072, -2072, -2072, -2072,
+    -2072, -2072, -2072, -2072, -1480, -1480, -1480, -1480, -669, -1480,
+    -1480, -1480, -712, -1480, -1480, -1480, -1480, -1480, -1480, -1480,
+    -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480, -1480,
+    -761, -1480, -1480, -1074, -1480, -1480, -2662, -2662, -2662, -1489,
+    -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -1022, -726,
+    -2406, -2662, -2662, -382, -602, -751, -1196, -1196, -2662, -2662,
+    -2662, -2662, -2662, -2662, -2662, -2662, -2662, -2662, -645, -2454,
+    -2454, -2454, -942, -2198, -2454, -1367, -1942, -2454, -2454, -520,
+    -2454, -2454, -651, -2454, -2454, -761, -1942, -840, -1330, -2454,
+    -2454, -2454, -2454, -2454, -2048, -2454, -2454, -1860, -2454, -2198,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606,
+    -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606,
+    -449, -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606, -2606,
+    -2606, -144, -2606, -2606, -2161, -2161, -2161, -2161, -282, -2161,
+    -1649, -2161, -1905, -2161, -2161, -2161, -2161, -2161, -2161, -1649,
+    -2161, -2161, -2161, -732, -2161, -2161, -2161, -2161, -2161, -2161,
+    -543, -2161, -2161, -1003, -2161, -2161, -1362, -1362, -1362, -1362,
+    -1362, -1362, -1362, -551, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -2450, -2450,
+    -309, -2194, -2450, -2194, -2450, -2450, -2450, -2450, -2450, -1856,
+    -2194, -1326, -2450, -2450, -2450, -2045, -270, -1732, -2450, -2450,
+    -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2496, -2496, -2496, -2496,
+    -2496, -2496, -2496, -2496, -2496, -2496, -2496, -2496, -2496, -2496,
+    -2496, -2496, -2496, -2496, -810, -2496, -2496, -2496, -2496, -2496,
+    -2496, -2496, -63, -2496, -2496, -1610, -2496, -2496, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -737, -1356, -1363, -1513, -1356, -1303, -1513, -941, -965, -1815,
+    -2154, -1418, -1145, -1297, -1107, -1513, -1898, -1709, -891, -609,
+    -1868, -1657, -965, -2815, -1748, -2815, -2815, -2815, -2815, -2815,
+    -2815, -2815, -1430, -1174, -918, -1430, -918, -1430, -1430, -1430,
+    -1430, -1430, -1430, -1024, -1430, -1430, -1174, -1174, -1430, -1430,
+    -1430, -1430, -1430, -1430, -1174, -1430, -1430, -1430, -918, -1174,
+    -1430, -1430, -1430, -1430, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2450, -2450, -2450, -2450,
+    -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450,
+    -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450, -2450,
+    -2450, -2450, -85, -1053, -2450, -2450, -818, -2194, -1609, -1609,
+    -1609, -1609, -1609, -1609, -1609, -1609, -1353, -1609, -1609, -1609,
+    -1609, -1609, -1609, -1609, -1609, -1609, -203, -1609, -1609, -1609,
+    -1609, -1609, -1609, -1609, -1353, -1609, -1609, -1609, -1609, -1609,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -2376, -791, -1608, -2120, -2376, -1608, -1063, -2376,
+    -2376, -2376, -2376, -796, -946, -978, -2376, -2120, -2376, -1032,
+    -1657, -364, -2376, -1781, -2120, -2376, -1490, -2376, -1429, -2376,
+    -2376, -1864, -1864, -2376, -1792, -1792, -1792, -1792, -106, -1792,
+    -1792, -1792, -1792, -1792, -1792, -1536, -1792, -1792, -1792, -1792,
+    -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792, -1792,
+    -1792, -1792, -1792, -1792, -1792, -1792, -1866, -2752, -2752, -2752,
+    -132, -2752, -2752, -1705, -1090, -2752, -2752, -899, -2752, -2752,
+    -1047, -2752, -2752, -1389, -2752, -1578, -1901, -2752, -2752, -2752,
+    -1307, -2752, -2752, -2752, -2752, -2752, -2752, -2752, -1580, -2942,
+    -3198, -3198, -866, -2792, -3198, -3198, -1284, -3198, -2942, -1995,
+    -2792, -1930, -1490, -3198, -3198, -2348, -1291, -3198, -1668, -3198,
+    -2792, -3198, -3198, -3198, -119, -2792, -3198, -1071, -1995, -2942,
+    -1435, -3072, -1323, -783, -1792, -2072, -1883, -3072, -1410, -3072,
+    -3072, -1513, -2260, -1930, -2816, -1883, -2410, -811, -797, -841,
+    -3072, -1030, -1236, -1418, -1553, -3072, -603, -2816, -3072, -919,
+    -1566, -2260, -1065, -2065, -2065, -2065, -676, -2065, -2065, -2065,
+    -628, -2065, -2065, -923, -2065, -2065, -451, -2065, -2065, -1659,
+    -2065, -2065, -785, -2065, -2065, -2065, -2065, -2065, -2065, -2065,
+    -2065, -2065, -2065, -2065, -1503, -1481, -3139, -2545, -1104, -3139,
+    -3139, -2883, -1908, -3139, -3139, -928, -3139, -2371, -2883, -3139,
+    -3139, -1666, -1144, -1767, -1837, -3139, -3139, -3139, -3139, -3139,
+    -167, -2627, -3139, -844, -1717, -2327, -360, -1518, -1518, -1518,
+    -800, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518,
+    -1518, -1518, -1518, -1518, -1518, -1518, -1262, -1518, -1518, -1518,
+    -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1518, -1553, -2272,
+    -1010, -2528, -981, -1386, -992, -2528, -2528, -2528, -2528, -2016,
+    -1642, -370, -785, -2528, -2272, -2528, -870, -776, -2122, -1716,
+    -2528, -2528, -2528, -2016, -2528, -2528, -2528, -2528, -2528, -2528,
+    -1705, -1705, -1705, -1705, -681, -1705, -1705, -1705, -1705, -1705,
+    -1705, -1705, -1705, -1705, -487, -1705, -1705, -1705, -1705, -1705,
+    -461, -1705, -1705, -1705, -1705, -1705, -1705, -1705, -1705, -1705,
+    -1705, -1705, -2210, -2210, -2210, -2210, -1399, -1324, -2210, -2210,
+    -821, -2210, -2210, -1616, -2210, -1235, -2210, -2210, -2210, -2210,
+    -1007, -2210, -2210, -2210, -2210, -2210, -2210, -2210, -195, -2210,
+    -2210, -954, -2210, -1954, -1981, -2237, -2237, -2237, -1048, -2237,
+    -2237, -2237, -1095, -2237, -2237, -2237, -2237, -2237, -1981, -2237,
+    -2237, -2237, -2237, -2237, -1262, -2237, -2237, -2237, -89, -2237,
+    -2237, -2237, -2237, -2237, -2237, -2237, -886, -1398, -1398, -1398,
+    -586, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1142, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1965, -2477,
+    -2477, -2477, -113, -2477, -2477, -2477, -1220, -2477, -2477, -2477,
+    -2477, -2477, -682, -2477, -2477, -2477, -2221, -2477, -1882, -2477,
+    -2477, -2477, -1529, -2477, -1882, -2477, -2477, -1965, -2477, -2477,
+    -3006, -1738, -2412, -2750, -2750, -2288, -3006, -3006, -2288, -3006,
+    -3006, -2121, -2195, -1673, -2345, -3006, -3006, -1248, -2494, -226,
+    -1065, -2089, -638, -3006, -2750, -3006, -748, -2750, -3006, -1600,
+    -3006, -2345, -879, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1068, -1473, -1473, -588, -1473, -1473, -1473, -1473, -1473, -755,
+    -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -1473, -1719, -1719, -1719, -1719, -1719, -1719,
+    -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719,
+    -1719, -1719, -1719, -1719, -129, -1719, -1719, -1719, -1719, -1719,
+    -1719, -1719, -1719, -1719, -1719, -1719, -1158, -1414, -1414, -1414,
+    -439, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1830, -2715,
+    -1648, -2715, -783, -1498, -2715, -1648, -707, -2715, -2715, -2715,
+    -2715, -2715, -1301, -1798, -2715, -2715, -2715, -800, -1310, -2715,
+    -990, -2715, -2715, -2715, -467, -2203, -2715, -789, -1472, -2054,
+    -1042, -3018, -3018, -3018, -687, -2424, -3018, -1665, -780, -3018,
+    -3018, -1018, -1647, -2506, -1173, -3018, -3018, -1104, -1121, -3018,
+    -1994, -3018, -3018, -3018, -1685, -3018, -455, -2506, -3018, -798,
+    -1894, -2250, -871, -1703, -1959, -1959, -423, -1959, -1703, -1959,
+    -1240, -1959, -1959, -1959, -852, -1959, -1553, -1447, -1959, -1553,
+    -1703, -485, -1959, -1959, -1959, -1959, -1959, -1959, -1959, -1959,
+    -1959, -1959, -1959, -1959, -1139, -2086, -2086, -2086, -357, -2086,
+    -2086, -2086, -321, -2086, -2086, -2086, -2086, -2086, -1169, -2086,
+    -2086, -2086, -2086, -2086, -2086, -2086, -2086, -2086, -1492, -2086,
+    -2086, -2086, -2086, -2086, -2086, -2086, -1547, -1547, -1547, -1547,
+    -779, -1547, -1547, -886, -480, -1547, -1547, -1547, -1547, -1547,
+    -886, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+    -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1614, -1614,
+    -1614, -1614, -1614, -1614, -1614, -1614, -184, -1614, -1614, -1614,
+    -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614,
+    -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614, -1614,
+    -2402, -1199, -2402, -2402, -2402, -2402, -2402, -2146, -1890, -2402,
+    -2402, -2402, -1808, -2402, -1146, -2402, -2402, -2402, -2402, -770,
+    -2402, -2402, -1890, -2402, -2402, -2402, -143, -1740, -2402, -1122,
+    -2146, -2402, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -786, -1296, -1381, -1450, -1207, -1269,
+    -1606, -896, -1022, -1990, -2179, -1429, -1120, -1714, -931, -1494,
+    -2114, -1584, -1034, -579, -1699, -1851, -1014, -3303, -1476, -3303,
+    -3047, -3303, -2386, -3303, -2642, -3047, -947, -1459, -1459, -1459,
+    -1459, -1459, -1459, -1459, -1203, -1459, -1459, -1459, -1054, -1203,
+    -1459, -1203, -1459, -1054, -1459, -1459, -1459, -1459, -1203, -1459,
+    -1459, -1459, -1459, -741, -1459, -1459, -947, -1459, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693,
+    -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693, -2693,
+    -2693, -2693, -2693, -2693, -2693, -2693, -68, -1084, -2693, -2693,
+    -873, -2437, -1503, -1759, -1759, -1759, -1759, -1759, -1759, -991,
+    -1164, -1759, -1759, -784, -1353, -1759, -1759, -1759, -1759, -1759,
+    -353, -812, -1503, -1759, -1759, -1759, -1759, -1759, -1759, -1503,
+    -1759, -1759, -1759, -1759, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1820, -1820, -360, -678,
+    -1820, -1820, -1820, -1820, -1820, -1820, -1414, -1564, -1820, -1820,
+    -1820, -1820, -1820, -1101, -796, -969, -1820, -1820, -1820, -1564,
+    -1820, -1820, -1820, -1820, -1820, -1820, -1820, -1820, -635, -1937,
+    -2193, -2193, -1474, -2193, -2193, -2193, -1598, -535, -2193, -646,
+    -2193, -2193, -1086, -2193, -2193, -2193, -570, -1193, -2193, -1937,
+    -2193, -2193, -2193, -2193, -1787, -2193, -2193, -2193, -2193, -2193,
+    -1177, -2062, -343, -2062, -819, -2062, -2062, -2062, -648, -2062,
+    -760, -1806, -2062, -2062, -2062, -2062, -2062, -1468, -2062, -1806,
+    -1251, -2062, -2062, -2062, -2062, -2062, -2062, -2062, -2062, -2062,
+    -2062, -2062, -2351, -2351, -2351, -1540, -1060, -2095, -1327, -2351,
+    -1404, -2351, -2351, -2351, -2351, -1466, -2351, -2351, -2351, -2351,
+    -1377, -2351, -852, -2351, -1946, -2351, -677, -2351, -335, -2095,
+    -2351, -871, -1264, -2095, -1798, -1798, -1798, -1798, -1798, -1798,
+    -1798, -1798, -1798, -1798, -1798, -1798, -1798, -1798, -1798, -1798,
+    -1798, -1798, -132, -1392, -1542, -1286, -1798, -1798, -1798, -1798,
+    -1798, -1798, -1798, -1542, -1542, -1798, -2817, -3073, -3073, -3073,
+    -1949, -1124, -3073, -3073, -2354, -3073, -3073, -2667, -3073, -3073,
+    -2354, -3073, -3073, -2817, -2667, -1365, -2667, -3073, -3073, -3073,
+    -3073, -3073, -38, -2479, -3073, -1771, -3073, -2667, -1419, -1825,
+    -1825, -1825, -235, -1825, -1569, -1825, -850, -1825, -1825, -1825,
+    -1825, -1313, -1825, -1825, -1825, -1163, -1825, -1825, -1313, -1825,
+    -1825, -1825, -1014, -1825, -1825, -1825, -1825, -1825, -1825, -1825,
+    -1806, -1806, -1806, -1806, -1550, -1806, -1806, -1806, -1400, -1806,
+    -1806, -1806, -1806, -1400, -1806, -1806, -1806, -1806, -1806, -1806,
+    -1806, -1806, -1806, -1806, -1806, -1806, -1212, -1806, -1806, -132,
+    -1806, -1806, -2182, -2182, -682, -951, -2182, -2182, -2182, -2182,
+    -2182, -2182, -2182, -1588, -2182, -155, -2182, -2182, -2182, -2182,
+    -1414, -2182, -2182, -2182, -2182, -2182, -2182, -2182, -2182, -2182,
+    -2182, -2182, -2182, -2182, -1771, -1771, -1771, -1771, -109, -1771,
+    -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771,
+    -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771, -1771,
+    -1771, -1771, -1771, -1771, -1771, -1771, -2235, -2235, -2235, -2235,
+    -352, -2235, -2235, -2235, -864, -2235, -2235, -2235, -2235, -2235,
+    -2235, -2235, -2235, -2235, -922, -2235, -2235, -2235, -2235, -2235,
+    -2235, -2235, -440, -2235, -2235, -1005, -1979, -2235, -1495, -2582,
+    -2582, -719, -666, -2582, -2582, -2582, -928, -2582, -2582, -401,
+    -2582, -2582, -839, -2582, -2582, -2582, -2326, -2176, -1008, -1130,
+    -2582, -2582, -1920, -2582, -1988, -2582, -2582, -1771, -2326, -2582,
+    -1271, -2599, -2855, -2855, -414, -1350, -2855, -2855, -1044, -2855,
+    -2855, -2599, -1084, -2855, -2044, -731, -2855, -2855, -1881, -2855,
+    -2855, -2855, -2855, -2855, -2087, -2855, -461, -2194, -2855, -1090,
+    -2855, -2599, -1368, -3231, -1263, -1163, -795, -1594, -1016, -3231,
+    -1537, -2143, -3231, -1216, -3231, -1689, -1585, -2975, -2512, -3231,
+    -856, -1222, -3231, -1356, -3231, -3231, -2106, -3231, -402, -2345,
+    -3231, -796, -2073, -2345, -2664, -2664, -2664, -550, -2664, -1618,
+    -2664, -2664, -2664, -2664, -553, -1475, -774, -644, -2664, -2258,
+    -2664, -1019, -1384, -1689, -2664, -2664, -2664, -2664, -2664, -2664,
+    -908, -2664, -2664, -1433, -2408, -2408, -2399, -2399, -2399, -2399,
+    -306, -2399, -2399, -1631, -709, -2399, -2399, -926, -1993, -2399,
+    -1086, -819, -2399, -1292, -1737, -1680, -1993, -2399, -2399, -2399,
+    -1131, -2399, -1481, -2399, -2399, -1737, -2143, -2399, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -729, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1713, -2075, -1742, -1033, -668, -2670, -1401, -3075, -1704, -3075,
+    -1346, -1491, -1113, -1350, -2264, -2307, -3075, -1394, -1353, -783,
+    -2357, -3075, -1773, -3075, -1722, -3075, -354, -2190, -3075, -1443,
+    -2670, -2819, -1468, -2610, -2610, -2610, -409, -2610, -2610, -2610,
+    -757, -2610, -2610, -2610, -2610, -2610, -1759, -1366, -2610, -2610,
+    -664, -471, -1452, -2204, -2610, -2610, -2354, -2610, -2354, -2610,
+    -2610, -2610, -2610, -2610, -2009, -2927, -2521, -2927, -1380, -2927,
+    -2927, -439, -1295, -2927, -2927, -2116, -2671, -2927, -2671, -2927,
+    -2927, -2927, -2333, -1208, -2927, -2927, -2927, -2927, -2927, -2927,
+    -215, -2927, -2927, -1391, -2671, -2415, -3237, -1563, -2351, -1857,
+    -3237, -3237, -856, -3237, -2518, -3237, -3237, -600, -3237, -914,
+    -3237, -2213, -3237, -569, -942, -955, -3237, -3237, -3237, -3237,
+    -3237, -3237, -609, -2643, -3237, -1309, -2981, -2425, -1495, -2345,
+    -2345, -2345, -67, -2345, -2345, -2345, -947, -2345, -2345, -2345,
+    -2345, -2345, -1398, -2345, -2345, -2345, -2345, -2345, -2345, -2345,
+    -2345, -2345, -2345, -2345, -2345, -2345, -2345, -2345, -2345, -2345,
+    -1167, -2785, -2785, -2123, -695, -2785, -2785, -2529, -1158, -2785,
+    -2785, -1255, -2785, -530, -2785, -2785, -2785, -2785, -1442, -2529,
+    -2785, -2785, -2785, -2785, -2785, -2785, -355, -2785, -2785, -999,
+    -2123, -2379, -1343, -1343, -1343, -1343, -1087, -1087, -1343, -1087,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1087, -1343, -1343, -1343,
+    -1343, -938, -1343, -1343, -1094, -1756, -1756, -1756, -709, -1244,
+    -1756, -1756, -1094, -1756, -1756, -1756, -567, -1756, -1756, -1756,
+    -1756, -1756, -1244, -1756, -1756, -1756, -1756, -1756, -1756, -1756,
+    -631, -1500, -1756, -988, -1756, -1756, -1302, -1302, -1302, -1302,
+    -897, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1014, -895,
+    -1170, -1180, -1241, -1286, -1316, -831, -1279, -1763, -1635, -1194,
+    -888, -1277, -1286, -1302, -2312, -1282, -954, -845, -1700, -1841,
+    -1185, -3230, -1392, -3230, -3230, -3230, -3230, -3230, -2974, -3230,
+    -894, -1406, -1150, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1000, -1000, -1406, -1150, -1000, -1406,
+    -1406, -1406, -1150, -1406, -1406, -1406, -1150, -1406, -1406, -1406,
+    -1406, -1406, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2122, -2122, -2122, -2122, -2122, -2122,
+    -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122,
+    -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122, -2122,
+    -112, -1204, -2122, -2122, -751, -2122, -1530, -1530, -868, -680,
+    -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -506, -1274,
+    -1530, -1530, -1530, -1530, -1530, -1274, -1530, -1530, -1530, -1530,
+    -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1530, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -2571, -1354, -1653, -2059, -2571, -2571, -1803, -2571, -913, -2571,
+    -2571, -1269, -2571, -1041, -2571, -1547, -2571, -256, -776, -992,
+    -1368, -2315, -2571, -2571, -1413, -2571, -2165, -2571, -2571, -2059,
+    -2571, -2571, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -897,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -897, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -699, -2764,
+    -687, -1327, -1521, -2764, -2764, -2764, -2764, -2764, -2764, -1846,
+    -1234, -753, -1291, -2764, -2764, -412, -1534, -1623, -2764, -2764,
+    -2764, -2764, -2764, -2764, -1018, -2764, -2764, -1496, -2764, -2764,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -560, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1116, -1372,
+    -1372, -1372, -1372, -1372, -836, -1860, -1860, -1860, -630, -1860,
+    -1860, -1860, -454, -1860, -1860, -1860, -1860, -1860, -1860, -1860,
+    -1860, -1266, -1348, -1860, -1860, -1860, -1860, -1860, -1049, -1860,
+    -814, -1860, -1860, -1199, -1860, -1860, -1603, -2265, -932, -1107,
+    -876, -2265, -2009, -2265, -2265, -2265, -1859, -1380, -2265, -337,
+    -2265, -2265, -1859, -753, -1415, -772, -2265, -2265, -2265, -2265,
+    -2265, -2265, -2009, -2265, -2265, -2265, -2265, -2265, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -493, -2538, -2538, -2538, -355, -2538, -2538, -2538,
+    -547, -2538, -2538, -2538, -2538, -2538, -1334, -2538, -2538, -2538,
+    -2538, -2538, -2538, -2538, -2538, -2538, -974, -2538, -2538, -2538,
+    -2538, -2538, -2538, -2538, -1334, -1334, -1334, -1334, -672, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -2582, -2582,
+    -1863, -2582, -2176, -2582, -2582, -2582, -878, -2582, -1064, -1116,
+    -2070, -900, -1176, -2070, -2582, -744, -330, -1664, -1280, -2176,
+    -1082, -2582, -2582, -2582, -2582, -2582, -2582, -2582, -2582, -2582,
+    -1722, -2441, -2441, -2441, -513, -2441, -2441, -2441, -729, -2441,
+    -2441, -1019, -2441, -2441, -477, -2441, -2441, -851, -2441, -2441,
+    -2441, -2441, -2441, -2441, -751, -2441, -2441, -2441, -2441, -2441,
+    -2441, -2441, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1149, -2707, -2707, -2707, -388, -2707,
+    -2707, -2707, -710, -2707, -2707, -2707, -2707, -2707, -319, -2707,
+    -2707, -2707, -2707, -2707, -1439, -2707, -2707, -2707, -2707, -2707,
+    -2707, -2707, -2707, -2707, -2707, -2707, -1924, -1924, -1924, -1924,
+    -1006, -1924, -1924, -1924, -1518, -1924, -1924, -1924, -1924, -1924,
+    -1412, -1924, -1924, -1924, -1924, -1668, -1924, -1924, -1924, -1924,
+    -1924, -1924, -279, -1924, -1924, -518, -1262, -1924, -1012, -2186,
+    -2186, -2186, -464, -2186, -2186, -2186, -656, -2186, -2186, -1780,
+    -2186, -1780, -1418, -2186, -2186, -2186, -2186, -2186, -1211, -2186,
+    -2186, -2186, -1930, -2186, -447, -1930, -2186, -1186, -2186, -2186,
+    -1987, -784, -1987, -1325, -1987, -1731, -1581, -1987, -1987, -1987,
+    -1987, -1069, -1987, -881, -1987, -1987, -1987, -445, -1987, -500,
+    -1987, -1987, -1987, -1987, -1987, -1475, -1987, -1987, -1987, -1987,
+    -1987, -1987, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1877, -1877,
+    -1877, -1877, -1877, -1877, -1877, -1877, -1282, -1877, -1877, -1877,
+    -1877, -1877, -1877, -1877, -1877, -853, -1877, -1877, -1877, -1877,
+    -1877, -1877, -1877, -1877, -287, -1621, -1877, -564, -1877, -1471,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -838, -1500, -1283, -1838, -1432, -1007, -1838, -920,
+    -1147, -1838, -2094, -1500, -1176, -1838, -1070, -1500, -2094, -1432,
+    -814, -642, -1838, -1838, -850, -2094, -1582, -2094, -2094, -2094,
+    -2094, -2094, -1688, -2094, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1708, -1708,
+    -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708,
+    -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708,
+    -1708, -1708, -1708, -1708, -215, -1452, -1708, -1708, -761, -1452,
+    -1414, -1158, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -439, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -453, -2403, -2403, -2403, -500, -2403,
+    -2403, -2403, -334, -2403, -2403, -2403, -2403, -2403, -2403, -2403,
+    -2403, -2403, -2403, -2403, -2403, -2403, -2403, -2403, -2403, -2403,
+    -2403, -2403, -2403, -2403, -2403, -2403, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291,
+    -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -2690, -982,
+    -787, -1388, -2690, -2690, -1160, -2434, -964, -2690, -2690, -827,
+    -1840, -683, -1644, -1337, -2690, -1238, -1410, -576, -2284, -1318,
+    -1310, -2690, -1366, -2690, -2690, -2690, -2690, -2690, -2690, -2690,
+    -799, -1649, -1649, -1649, -702, -1649, -1649, -1649, -988, -1649,
+    -1649, -1649, -1649, -1649, -1137, -1649, -1649, -1649, -1649, -1649,
+    -1649, -1649, -1649, -1649, -461, -1649, -1393, -1649, -1649, -1393,
+    -1649, -1649, -1717, -2436, -2436, -2436, -668, -2436, -2436, -918,
+    -1369, -2436, -2436, -1625, -2436, -2436, -1369, -2436, -2436, -2436,
+    -2436, -2436, -949, -2436, -2436, -2436, -206, -2436, -2436, -2436,
+    -2436, -2436, -2436, -2436, -1207, -2509, -2509, -2509, -896, -2509,
+    -2509, -2509, -635, -2509, -2509, -1057, -2509, -1997, -1385, -2509,
+    -2509, -2509, -577, -2509, -2253, -2509, -2509, -2509, -2253, -2509,
+    -529, -2509, -2509, -780, -1624, -2253, -842, -2788, -1139, -940,
+    -1238, -1354, -1519, -1855, -2894, -1870, -3300, -1321, -1334, -1299,
+    -2382, -1179, -1672, -2352, -816, -1258, -2894, -1588, -1878, -3300,
+    -2352, -3300, -430, -2894, -3300, -1027, -2325, -2581, -2036, -2036,
+    -2036, -2036, -391, -2036, -2036, -2036, -447, -2036, -2036, -1631,
+    -2036, -2036, -806, -2036, -2036, -2036, -2036, -2036, -780, -2036,
+    -2036, -2036, -2036, -2036, -2036, -2036, -2036, -2036, -2036, -2036,
+    -1758, -2164, -2164, -2164, -493, -2164, -2164, -801, -850, -2164,
+    -2164, -2164, -2164, -2164, -1039, -2164, -2164, -2164, -2164, -2164,
+    -1216, -2164, -2164, -2164, -1163, -2164, -1022, -1313, -2164, -1313,
+    -605, -2164, -226, -1836, -1836, -1836, -1174, -1836, -1836, -1836,
+    -1836, -1836, -1836, -1836, -1836, -1836, -567, -1836, -1836, -1836,
+    -1836, -1836, -1836, -1836, -1836, -1836, -1836, -1836, -1836, -1836,
+    -1836, -1836, -1836, -1836, -955, -1281, -1471, -1176, -554, -1676,
+    -1091, -2834, -2834, -2834, -1983, -1645, -1916, -598, -1045, -1859,
+    -2834, -2834, -948, -805, -1810, -1069, -2578, -2834, -2834, -2322,
+    -2834, -2834, -2834, -2834, -2834, -2834, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -950, -2018,
+    -2018, -2018, -815, -2018, -2018, -2018, -1762, -2018, -2018, -1612,
+    -2018, -2018, -2018, -2018, -2018, -2018, -604, -2018, -2018, -2018,
+    -2018, -2018, -2018, -2018, -444, -1506, -2018, -656, -1612, -2018,
+    -1887, -2292, -2292, -728, -756, -2292, -2292, -2292, -1407, -2292,
+    -2292, -2292, -2292, -2292, -577, -2292, -2292, -2292, -878, -2292,
+    -2292, -2292, -2292, -2292, -483, -2292, -1134, -2292, -2292, -1246,
+    -2036, -2036, -699, -2294, -2294, -2294, -568, -2294, -2294, -2038,
+    -513, -2294, -2294, -1319, -2294, -2038, -1482, -2294, -2294, -2294,
+    -821, -1482, -2038, -2294, -2294, -2294, -1782, -2294, -821, -2294,
+    -2294, -1152, -2038, -2294, -1391, -2392, -2392, -2392, -420, -2392,
+    -2392, -2392, -585, -2392, -2392, -2392, -1986, -2136, -1880, -1986,
+    -2392, -2392, -1417, -1368, -2392, -2392, -2392, -2392, -2392, -2392,
+    -543, -2136, -2392, -783, -2392, -1986, -1293, -1219, -1510, -1287,
+    -2823, -1555, -2012, -2418, -2823, -1162, -1906, -1717, -481, -1031,
+    -906, -1108, -2823, -1799, -1062, -1046, -810, -1068, -1219, -2567,
+    -1973, -2823, -2823, -2823, -2823, -2823, -2823, -2823, -1369, -1881,
+    -1881, -1881, -1113, -1881, -1881, -1881, -1881, -1881, -1881, -1476,
+    -1881, -1881, -548, -1881, -1881, -287, -1163, -1881, -1881, -1881,
+    -1881, -1881, -1881, -1881, -1625, -1881, -1881, -1476, -1881, -1881,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -977, -2375, -2375, -2375, -822, -2375, -2375, -2375,
+    -311, -2375, -2375, -2375, -2375, -2375, -895, -2375, -2375, -2375,
+    -2375, -2375, -1106, -2375, -2375, -2375, -586, -2375, -2375, -2375,
+    -2375, -1863, -2375, -2375, -1233, -2796, -2796, -2202, -577, -2796,
+    -2796, -2540, -1729, -2796, -2796, -2796, -2796, -2796, -1147, -2202,
+    -2796, -2796, -2796, -685, -1222, -2796, -2796, -2796, -2796, -2796,
+    -627, -2540, -2796, -443, -1946, -2391, -646, -2666, -2666, -2666,
+    -1057, -1260, -2666, -927, -669, -2666, -2666, -1598, -1898, -1260,
+    -2071, -2666, -2666, -2071, -1363, -2666, -851, -2666, -2666, -2666,
+    -1008, -2666, -646, -2666, -2666, -1066, -2666, -2666, -1885, -1546,
+    -952, -752, -778, -2141, -1329, -2141, -1193, -2141, -2141, -1166,
+    -1073, -937, -2141, -727, -2141, -2141, -778, -897, -2141, -2141,
+    -2141, -2141, -2141, -2141, -2141, -2141, -2141, -2141, -2141, -2141,
+    -505, -2035, -2035, -2035, -292, -2035, -2035, -2035, -682, -2035,
+    -2035, -2035, -2035, -2035, -1440, -2035, -2035, -2035, -2035, -2035,
+    -2035, -2035, -2035, -2035, -2035, -2035, -2035, -2035, -2035, -2035,
+    -2035, -2035, -205, -1752, -1752, -1752, -1752, -1752, -1752, -1752,
+    -685, -1752, -1752, -1752, -1752, -1752, -1496, -1752, -1752, -1752,
+    -1752, -1752, -1752, -1752, -1752, -1752, -1752, -1752, -1752, -1752,
+    -1752, -1752, -1752, -1752, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2667, -1314, -2667, -2667,
+    -2667, -2667, -2667, -2667, -1269, -2667, -2667, -2667, -2667, -2667,
+    -1948, -2667, -2667, -2667, -2667, -959, -2667, -2667, -2261, -2667,
+    -2667, -2667, -121, -2411, -2667, -799, -2155, -2667, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -852, -1237, -1191, -1254, -1294, -1031, -1627, -939, -1114, -1879,
+    -1929, -1326, -1026, -1466, -1021, -1291, -2424, -1351, -922, -751,
+    -1605, -1850, -1010, -3309, -1616, -3309, -3309, -3309, -1768, -3309,
+    -3053, -3309, -1430, -1430, -1024, -1174, -1174, -1174, -1430, -1430,
+    -1174, -1430, -1430, -1430, -1430, -1430, -1174, -1430, -1430, -1024,
+    -1430, -1430, -1430, -1430, -1024, -1430, -1430, -1430, -1024, -1024,
+    -1174, -1430, -1430, -1430, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2888, -2888, -2888, -2888,
+    -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888,
+    -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888, -2888,
+    -2888, -2888, -45, -1206, -2888, -2888, -1018, -2226, -1676, -1526,
+    -1676, -1676, -1676, -1932, -1932, -1932, -1121, -1932, -1932, -1932,
+    -1932, -1932, -1932, -1526, -1932, -1676, -120, -1526, -1932, -1932,
+    -1932, -1932, -1932, -1932, -1932, -1932, -1932, -1526, -1932, -1932,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -2670, -1820, -1753, -1696, -2670, -1670, -1440, -2670,
+    -455, -2670, -1467, -1226, -1091, -996, -2670, -1273, -2670, -1273,
+    -2414, -682, -2414, -1753, -952, -2670, -694, -2670, -2158, -2670,
+    -2670, -2158, -2670, -2670, -169, -1649, -1649, -1649, -1393, -1649,
+    -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649,
+    -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649, -1649,
+    -1649, -1649, -1649, -1649, -1649, -1649, -592, -2187, -2187, -2187,
+    -681, -2187, -2187, -815, -1081, -2187, -2187, -1301, -2187, -2187,
+    -588, -2187, -2187, -707, -2187, -2187, -1269, -2187, -2187, -2187,
+    -2187, -2187, -2187, -2187, -2187, -2187, -2187, -2187, -240, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1297, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1735, -2653, -1422, -774, -827, -2340, -3058, -2247, -2464, -3058,
+    -1952, -682, -1652, -835, -3058, -1900, -1606, -991, -1236, -1326,
+    -3058, -1661, -2340, -2290, -2464, -3058, -585, -2546, -3058, -937,
+    -2546, -2340, -553, -1877, -1877, -1877, -1621, -1877, -1877, -1877,
+    -524, -1877, -1877, -1877, -1877, -1877, -524, -1877, -1877, -1877,
+    -1877, -1877, -1215, -1877, -1877, -1877, -929, -1877, -1877, -1877,
+    -1877, -1877, -1877, -1877, -1041, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1553, -447, -1553, -1553, -578, -1553, -1553, -1553, -1553, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -932, -2954, -2954, -2954,
+    -170, -2698, -2954, -2954, -1018, -2954, -2954, -2698, -1474, -2549,
+    -757, -2954, -2954, -2186, -2954, -2954, -2293, -2954, -2698, -2954,
+    -2360, -2954, -1087, -2698, -2954, -1711, -2954, -2698, -2849, -925,
+    -1580, -905, -2593, -2593, -1212, -2849, -2849, -2849, -2849, -1116,
+    -1825, -574, -762, -2187, -2849, -1057, -665, -769, -2849, -1525,
+    -2849, -1742, -2849, -2187, -2849, -2849, -2849, -2849, -2849, -2849,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1801, -1801, -1801, -1801, -403, -1801, -1801, -1801,
+    -733, -1801, -1801, -1801, -1801, -1801, -1801, -1801, -1801, -1801,
+    -1545, -1801, -1801, -1801, -1801, -1801, -1801, -1801, -544, -1801,
+    -1801, -989, -1801, -1545, -1389, -1901, -1901, -1901, -855, -1901,
+    -1901, -1901, -365, -1901, -1901, -1901, -1901, -1901, -1133, -1901,
+    -1901, -1901, -1901, -1901, -1901, -1901, -1901, -1901, -442, -1901,
+    -1901, -1901, -1901, -1901, -1901, -1901, -486, -1884, -1884, -1884,
+    -966, -1884, -1884, -1884, -289, -1884, -1884, -1884, -1884, -1884,
+    -1628, -1884, -1884, -1884, -1372, -1884, -1884, -1884, -1884, -1884,
+    -1884, -1884, -1884, -1884, -1884, -1884, -1884, -1884, -1452, -1452,
+    -1452, -1452, -365, -1452, -1452, -1452, -1452, -1452, -1452, -1452,
+    -1452, -1452, -1452, -1452, -1452, -1452, -1452, -1452, -1196, -1452,
+    -1452, -1452, -1452, -1452, -1452, -1452, -1452, -1452, -1452, -1452,
+    -2782, -2526, -1368, -2782, -2270, -1971, -2782, -2782, -2782, -2782,
+    -2782, -890, -571, -758, -771, -2014, -2782, -1150, -2782, -2782,
+    -1502, -2782, -2782, -2782, -2782, -2782, -442, -2782, -2782, -1258,
+    -2782, -2526, -1120, -2433, -2433, -2433, -269, -2433, -2433, -2027,
+    -684, -2433, -2433, -1142, -2433, -2433, -611, -2433, -2433, -1327,
+    -2433, -2433, -1714, -2433, -2433, -2433, -2433, -2433, -2177, -2433,
+    -2433, -2433, -2433, -2433, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -812, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1068, -1324, -1324, -1353, -1353, -1353, -1353,
+    -585, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1285, -2791,
+    -2791, -2791, -714, -2129, -2791, -2791, -597, -2791, -2791, -2279,
+    -1906, -2023, -1745, -2791, -2791, -2791, -2791, -2791, -1076, -2791,
+    -2791, -2791, -2791, -2791, -307, -2791, -2791, -849, -2535, -2385,
+    -743, -2769, -3025, -3025, -630, -3025, -3025, -3025, -950, -3025,
+    -3025, -1734, -2307, -2513, -1175, -2769, -3025, -951, -2108, -3025,
+    -1692, -3025, -3025, -3025, -1852, -3025, -337, -2769, -3025, -1126,
+    -2214, -2513, -1018, -956, -469, -1512, -1797, -1270, -1865, -2715,
+    -1447, -2715, -2715, -1715, -1263, -1591, -2715, -827, -2715, -450,
+    -1318, -2715, -2715, -2715, -2715, -2715, -2715, -2715, -2715, -2715,
+    -2715, -2715, -2715, -2715, -1302, -1302, -1302, -1302, -897, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1466, -1872, -1872, -1872,
+    -89, -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1872,
+    -1616, -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1872,
+    -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1872, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686,
+    -1686, -918, -874, -1280, -1686, -1686, -1686, -1686, -1686, -1686,
+    -1686, -1686, -1686, -1686, -1686, -1686, -497, -1686, -1686, -528,
+    -1686, -1430, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -794, -1118, -1182, -1261, -1289, -1187,
+    -1539, -1140, -1031, -2065, -2150, -1351, -1143, -1115, -933, -1255,
+    -2047, -1376, -930, -812, -1714, -1596, -971, -3418, -1663, -3418,
+    -3418, -3418, -2700, -3418, -2607, -3418, -1445, -1189, -1445, -1445,
+    -1039, -1445, -1189, -1445, -1189, -1445, -1445, -1445, -1445, -1445,
+    -1189, -1189, -1445, -1445, -1189, -1445, -1189, -1445, -933, -1445,
+    -1445, -1445, -850, -1189, -1445, -1445, -1189, -1445, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846,
+    -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846, -2846,
+    -2846, -2846, -2846, -2846, -2846, -2846, -60, -1168, -2846, -2846,
+    -890, -1961, -1722, -1722, -1722, -1722, -1722, -1722, -1722, -1210,
+    -1317, -1722, -1722, -1722, -1722, -1466, -1722, -1466, -1722, -1722,
+    -342, -1722, -1722, -1722, -1722, -1722, -1722, -1722, -564, -1466,
+    -1722, -1210, -1722, -1722, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -2731, -919, -1184, -2731,
+    -2731, -2475, -1219, -2731, -663, -2731, -826, -845, -2325, -561,
+    -2731, -2731, -2731, -1333, -1685, -704, -1920, -2731, -2731, -1881,
+    -1244, -2731, -2731, -2731, -2731, -2475, -2731, -2731, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1398, -1803, -1803, -1803, -1803, -1803, -1803, -158, -1803, -1803,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803,
+    -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -1803, -829,
+    -1803, -1803, -1046, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1046, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1482, -3123, -2237, -636, -1725, -2016,
+    -2611, -3123, -3123, -3123, -3123, -1082, -1407, -696, -2717, -1949,
+    -3123, -378, -1311, -2311, -2717, -1809, -2461, -2867, -3123, -3123,
+    -791, -2717, -3123, -1328, -1934, -2717, -1765, -1765, -1765, -1765,
+    -1509, -1765, -1765, -1765, -1509, -1765, -1765, -1765, -1765, -1765,
+    -385, -1765, -1765, -1765, -1765, -1765, -359, -1765, -1765, -1765,
+    -1765, -1765, -1765, -1765, -1765, -1765, -1765, -1765, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -735, -3529, -3529, -2679, -211, -2811, -3529, -2935, -895, -3529,
+    -3529, -2679, -3529, -3529, -1122, -3529, -3529, -1686, -2326, -3529,
+    -2238, -3529, -3017, -3529, -2718, -3529, -794, -2761, -3529, -1413,
+    -2158, -2868, -1534, -2046, -1057, -2181, -1264, -1335, -2143, -2993,
+    -2993, -2993, -2993, -1051, -861, -721, -283, -2993, -2587, -1613,
+    -1311, -1500, -2993, -1271, -2993, -2993, -2993, -2993, -2993, -2993,
+    -2993, -2993, -2993, -2993, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1626, -2437,
+    -2437, -2437, -240, -2437, -2437, -2437, -1843, -2437, -2437, -2437,
+    -2437, -2437, -2031, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -2437, -2437, -322, -2437, -2437, -2437, -2437, -2437, -2437, -2437,
+    -1106, -1874, -1874, -1874, -401, -1874, -1874, -1874, -1874, -1874,
+    -1874, -1874, -1874, -1874, -989, -1874, -1874, -1874, -1874, -1874,
+    -1874, -1874, -1874, -1874, -1874, -1874, -460, -989, -1874, -1469,
+    -1618, -1874, -1320, -1726, -1726, -1726, -281, -1726, -1726, -1726,
+    -552, -1726, -1726, -1726, -1726, -1726, -1726, -1726, -1726, -1726,
+    -1726, -1726, -1470, -1726, -1726, -1726, -1726, -1726, -1726, -1726,
+    -1726, -1726, -1726, -1726, -3167, -2911, -2911, -2911, -3167, -2911,
+    -1583, -3167, -2762, -3167, -2762, -1452, -2250, -1252, -1157, -2121,
+    -3167, -1514, -3167, -2250, -2143, -3167, -1307, -3167, -3167, -3167,
+    -75, -2356, -3167, -1964, -1964, -2655, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1116, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372, -1372,
+    -1372, -1372, -1372, -1372, -1372, -560, -1372, -1372, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -571, -2514, -2514, -2514, -633, -2514, -2514, -2514, -684, -2514,
+    -2514, -2514, -2514, -2514, -656, -2514, -2514, -2514, -2514, -2514,
+    -671, -2514, -2514, -2514, -891, -2514, -2514, -2514, -2514, -2514,
+    -2514, -2514, -2336, -2336, -1824, -2336, -1361, -2336, -2336, -1930,
+    -1824, -2336, -2336, -2336, -2080, -2336, -1824, -2336, -2336, -2336,
+    -2336, -1824, -2336, -2336, -2080, -2336, -2336, -2336, -155, -1930,
+    -2336, -544, -2080, -2080, -1145, -2625, -2625, -2625, -216, -2625,
+    -2625, -2625, -1084, -2625, -2625, -570, -2625, -2625, -2031, -1814,
+    -2625, -1501, -2625, -2625, -2625, -2625, -2625, -2625, -928, -2625,
+    -2369, -2625, -2625, -2369, -2625, -2625, -806, -2212, -2468, -956,
+    -1310, -2212, -2468, -2468, -2468, -2468, -2468, -1238, -1874, -719,
+    -2063, -1618, -2468, -227, -1874, -1807, -2468, -2468, -2468, -2468,
+    -2468, -2468, -2468, -2468, -2468, -2468, -2468, -2468, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2072, -2072, -2072, -2072, -402, -2072, -2072, -2072, -1072, -2072,
+    -2072, -2072, -2072, -2072, -255, -2072, -2072, -2072, -2072, -2072,
+    -2072, -2072, -2072, -2072, -2072, -2072, -2072, -2072, -2072, -2072,
+    -2072, -2072, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2477, -2477, -2477, -2477, -2477, -2477,
+    -2477, -2477, -2221, -2477, -2477, -1592, -2477, -2477, -2477, -2221,
+    -2477, -2477, -2477, -2477, -2477, -2477, -2477, -2477, -2477, -2477,
+    -187, -2072, -2477, -413, -1709, -1759, -1564, -1564, -1564, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -220, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -890, -1120,
+    -1285, -1305, -1418, -1380, -1534, -877, -843, -1954, -1780, -1290,
+    -1113, -1412, -967, -1363, -2235, -1515, -1003, -755, -1683, -2060,
+    -918, -3466, -1451, -3466, -3466, -3466, -2804, -3466, -2954, -3210,
+    -1130, -1280, -1536, -1536, -1536, -1280, -490, -1130, -1280, -1536,
+    -1536, -1280, -1536, -1536, -1280, -1024, -1536, -1536, -1280, -1536,
+    -1536, -1536, -1536, -1536, -1536, -1536, -1536, -1280, -1130, -1536,
+    -1536, -1536, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2761, -2761, -2761, -2761, -2761, -2761,
+    -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761,
+    -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761, -2761,
+    -66, -1103, -2761, -2761, -868, -2355, -1708, -1302, -1708, -1452,
+    -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708, -1708,
+    -1708, -1302, -1708, -1114, -235, -1196, -1302, -1708, -1708, -1708,
+    -1708, -1708, -1302, -1708, -1708, -1452, -1708, -1708, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -2289, -1341, -2289, -844, -2289, -2289, -1521, -2289, -619, -2289,
+    -2289, -360, -2289, -1627, -2289, -2289, -2289, -815, -1438, -844,
+    -2289, -2289, -2289, -2289, -2289, -2289, -2289, -2289, -2289, -2289,
+    -2289, -2289, -2073, -1411, -2073, -1817, -1667, -2073, -2073, -2073,
+    -1667, -380, -2073, -607, -1479, -2073, -2073, -2073, -2073, -2073,
+    -1073, -526, -2073, -2073, -2073, -2073, -2073, -2073, -2073, -2073,
+    -2073, -2073, -2073, -2073, -876, -2577, -1187, -2577, -1083, -2577,
+    -2577, -139, -1982, -2577, -1171, -2577, -2577, -2577, -2577, -2577,
+    -2577, -2577, -2577, -1077, -2321, -2577, -2577, -2577, -2321, -2577,
+    -2577, -2577, -2577, -2577, -2577, -2577, -1857, -2113, -2113, -895,
+    -338, -2113, -789, -2113, -750, -2113, -2113, -1601, -2113, -2113,
+    -2113, -2113, -2113, -2113, -2113, -2113, -2113, -2113, -2113, -2113,
+    -1165, -2113, -1066, -2113, -2113, -988, -2113, -2113, -1830, -2236,
+    -2236, -667, -2236, -2236, -2236, -2236, -2236, -2236, -2236, -1236,
+    -2236, -517, -2236, -2236, -2236, -1642, -528, -1574, -2236, -2236,
+    -2236, -2236, -2236, -2236, -749, -2236, -2236, -865, -2236, -2236,
+    -1636, -1636, -1636, -1636, -1636, -170, -1636, -1636, -1636, -1636,
+    -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636,
+    -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636, -1636,
+    -1636, -1636, -2106, -2512, -2512, -2512, -2256, -2512, -1466, -27,
+    -2256, -2512, -2512, -2000, -2106, -2106, -2512, -2512, -2512, -2512,
+    -2512, -2512, -2000, -2512, -2512, -2512, -2512, -2512, -2106, -2512,
+    -2512, -2256, -2512, -2512, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -2211, -2211, -1143, -1443,
+    -1037, -2211, -2211, -2211, -2211, -2211, -2211, -1087, -2211, -1053,
+    -1805, -1617, -2211, -575, -980, -337, -2211, -1805, -2211, -2211,
+    -2211, -2211, -2211, -2211, -2211, -2211, -2211, -2211, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -949, -2771, -2771, -137, -1747, -2366, -1684, -2771,
+    -1771, -2771, -2771, -1135, -2771, -1684, -1854, -2515, -2771, -2771,
+    -2053, -1253, -2771, -2515, -2771, -2771, -1960, -2771, -988, -2771,
+    -2771, -1480, -2771, -2771, -1231, -813, -2081, -2081, -710, -2081,
+    -2081, -2081, -1057, -2081, -2081, -2081, -837, -2081, -790, -923,
+    -2081, -2081, -622, -2081, -1569, -2081, -2081, -2081, -2081, -2081,
+    -1231, -1825, -2081, -1270, -2081, -2081, -1140, -2198, -854, -532,
+    -1032, -1453, -772, -1603, -991, -1898, -1663, -1288, -2304, -1603,
+    -2710, -1603, -2304, -1735, -1338, -649, -2454, -2454, -1453, -2710,
+    -2710, -2710, -1603, -2710, -2710, -2115, -2710, -2710, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1097, -1353, -1353, -634, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -2039, -1889, -2295, -1889, -1026, -2295, -2295, -2295, -1248, -2295,
+    -2295, -1153, -2295, -2295, -671, -464, -2295, -2039, -2039, -951,
+    -2039, -2295, -2295, -2295, -1889, -2295, -562, -2039, -2295, -1136,
+    -2295, -2039, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1103, -2064, -1534, -1711, -562, -2914,
+    -1477, -1646, -1162, -2914, -2658, -2914, -2253, -773, -2402, -1203,
+    -2914, -1434, -855, -1455, -2914, -2146, -2914, -2914, -2509, -2914,
+    -466, -2914, -2914, -1296, -2253, -2658, -1293, -1279, -2503, -2759,
+    -541, -2759, -2759, -1735, -831, -2759, -2759, -1330, -2759, -1909,
+    -2759, -1388, -2759, -2759, -1842, -468, -1362, -2759, -2759, -2759,
+    -2098, -2759, -682, -2759, -2759, -1102, -2503, -2759, -2001, -2812,
+    -2556, -2406, -802, -2812, -2812, -1306, -1163, -2812, -2812, -2300,
+    -1927, -2812, -2406, -2812, -2812, -2556, -2001, -1638, -1623, -2812,
+    -2812, -2812, -1423, -2812, -140, -2406, -2812, -1080, -2812, -2406,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1078, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -739, -1334, -1334, -1334, -1334, -1334,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -801, -1313, -1313, -1313, -1313,
+    -1313, -1313, -713, -1360, -990, -1153, -1616, -1436, -1665, -874,
+    -1436, -2045, -1187, -1383, -794, -1396, -1360, -1326, -1978, -1593,
+    -1045, -931, -1872, -2045, -777, -2640, -2234, -2640, -2640, -2640,
+    -2640, -2640, -2384, -2640, -1324, -1324, -1068, -1068, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1068, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1068, -1324, -1324, -1324, -1324, -1324, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1994, -1994,
+    -1994, -1994, -1994, -1994, -1994, -1994, -1994, -1994, -1994, -1994,
+    -1994, -1994, -1994, -1994, -1994, -1994, -1482, -1994, -1994, -1994,
+    -1994, -1994, -1994, -1994, -171, -1738, -1994, -1994, -564, -1994,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -2213, -1618, -1401, -1957, -2213, -2213,
+    -1295, -2213, -799, -2213, -2213, -572, -2213, -427, -2213, -2213,
+    -2213, -889, -1494, -768, -2213, -2213, -2213, -2213, -2213, -2213,
+    -2213, -2213, -2213, -2213, -2213, -2213, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2583, -3095, -2839, -924, -3095, -3095, -3095, -2839,
+    -3095, -3095, -3095, -1450, -1922, -913, -3095, -3095, -3095, -341,
+    -1395, -3095, -3095, -3095, -3095, -1922, -2327, -3095, -398, -2690,
+    -3095, -1276, -2284, -2839, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -2113, -2519, -1053, -961, -1122, -2519, -2113, -2519, -2519, -2519,
+    -2519, -767, -2519, -405, -874, -2519, -2519, -1572, -742, -950,
+    -2519, -1572, -2519, -2519, -2519, -2519, -2519, -2519, -2519, -2519,
+    -2519, -2519, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2077, -2077, -1565, -2077, -2077, -2077, -1821, -2077,
+    -632, -2077, -1159, -671, -2077, -2077, -2077, -2077, -2077, -1821,
+    -2077, -1415, -297, -2077, -1266, -2077, -2077, -2077, -2077, -2077,
+    -2077, -2077, -2077, -2077, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -801, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1106, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -701, -1362,
+    -1362, -1106, -1106, -1362, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -2927, -2671,
+    -2927, -2671, -2927, -2927, -2927, -2927, -1556, -2927, -2159, -1102,
+    -2671, -1238, -2927, -2927, -2927, -937, -149, -1697, -2927, -2415,
+    -2927, -2927, -759, -2927, -2927, -2927, -2927, -2927, -2927, -2927,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -897, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -739, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1078, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1343, -1343, -1343, -1343, -749, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1087, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1087, -1496, -2008, -2776, -1021,
+    -987, -2776, -2776, -2776, -1926, -2776, -2776, -682, -2776, -1136,
+    -2776, -2776, -2776, -340, -1965, -2371, -2776, -962, -2776, -2776,
+    -2776, -2776, -713, -2520, -2776, -2264, -2776, -2776, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -801, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -557, -2871, -2871, -2871, -527, -2871, -2871, -2871,
+    -472, -2871, -2871, -2871, -2871, -2871, -549, -2871, -2871, -2871,
+    -2871, -2871, -2871, -2871, -2871, -2871, -1397, -2871, -2871, -2871,
+    -2871, -2871, -2871, -2871, -2906, -2906, -926, -1882, -2906, -1476,
+    -2906, -2906, -2906, -2906, -2906, -570, -2906, -1034, -2906, -2906,
+    -2906, -2906, -877, -244, -2906, -2650, -2906, -2906, -2906, -2906,
+    -2906, -2906, -2906, -2906, -2906, -2906, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -431, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1682, -1682, -1682, -1682, -195, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -914, -1682, -1426, -1682, -1682, -1682,
+    -1682, -1682, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2295, -2295, -2295, -2295, -1271, -2295,
+    -2295, -2295, -2039, -2295, -2295, -2039, -2295, -2295, -2295, -2295,
+    -2295, -2295, -1348, -2295, -2295, -2295, -2295, -2295, -2295, -2295,
+    -153, -2295, -2295, -566, -2039, -1889, -2589, -2589, -2589, -2589,
+    -2333, -2589, -2589, -2589, -2589, -2589, -2333, -2589, -952, -1089,
+    -1589, -2589, -2589, -474, -2589, -2589, -309, -2589, -2589, -2589,
+    -2589, -2589, -800, -2589, -2589, -1738, -2589, -2589, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1881, -1881, -1881, -1881, -907, -1881, -1881, -1881,
+    -249, -1881, -1881, -1881, -1881, -1881, -548, -1881, -1881, -1881,
+    -1881, -1881, -1881, -1881, -1881, -1881, -1881, -1881, -1881, -1881,
+    -1881, -1881, -1881, -1881, -1786, -1786, -1786, -1786, -1786, -1786,
+    -1786, -1786, -1786, -1786, -1786, -1530, -1786, -1786, -1380, -1530,
+    -1786, -1786, -1786, -1786, -1786, -1786, -1786, -1786, -1530, -1786,
+    -262, -1786, -1786, -597, -1530, -1274, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -679, -1398, -1398, -1398, -1398, -1398,
+    -1398, -679, -1398, -1398, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -907, -1360, -1196, -1297, -1403, -1275, -1659, -812, -982, -2065,
+    -2171, -1346, -824, -1147, -1111, -1419, -2321, -1809, -1084, -747,
+    -1727, -1630, -928, -2577, -1602, -2577, -2577, -2577, -2577, -2577,
+    -2577, -2577, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1982, -1982, -1982, -1982,
+    -1982, -1982, -1320, -1982, -1982, -1982, -1982, -1982, -1982, -1982,
+    -1982, -1726, -1982, -1982, -1982, -1982, -1982, -1982, -1982, -1982,
+    -1982, -1982, -141, -1320, -1982, -1982, -779, -1726, -1362, -1362,
+    -957, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1106, -1362, -1362, -1362, -1362, -1362, -768, -1106, -1362, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1705, -1705, -402, -1705, -1705, -1705, -1299, -1705,
+    -1705, -1705, -1705, -1705, -598, -1705, -1705, -1705, -1705, -1705,
+    -1299, -730, -1705, -1705, -1705, -1705, -1705, -1705, -1705, -1705,
+    -1705, -1705, -1705, -1705, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1942, -1942, -1942, -1942,
+    -226, -1942, -1942, -1686, -918, -1942, -1942, -800, -1942, -1942,
+    -1942, -1942, -1942, -1942, -1942, -1942, -817, -1942, -1942, -1942,
+    -1942, -1942, -1942, -1942, -1942, -1942, -1942, -1942, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1697, -1697, -929, -384, -1697, -1697, -1697, -1697, -1697, -1697,
+    -1697, -1697, -1291, -1697, -1697, -1697, -1697, -539, -1291, -1697,
+    -1697, -1697, -1697, -1697, -1697, -1697, -1697, -1697, -1697, -1697,
+    -1697, -1697, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -947, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -759, -1353, -1353, -1353, -1353, -1353,
+    -1097, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1719, -1463,
+    -1719, -1719, -612, -1719, -1463, -1719, -1719, -1719, -1719, -1719,
+    -1463, -1124, -395, -1719, -1719, -1719, -833, -1313, -1719, -1719,
+    -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719, -1719,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2144, -2144, -2144, -2144, -296, -2144, -2144, -2144,
+    -2144, -2144, -2144, -821, -2144, -2144, -1077, -2144, -2144, -440,
+    -2144, -2144, -2144, -2144, -2144, -2144, -2144, -2144, -2144, -2144,
+    -2144, -2144, -2144, -2144, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1922, -1922, -1922, -1922, -748, -1922, -1922, -1666, -1666, -1922,
+    -1922, -1922, -1922, -1922, -1516, -1922, -1922, -500, -1922, -1922,
+    -1260, -1922, -1922, -1922, -1922, -1922, -353, -1922, -1922, -1516,
+    -1922, -1666, -1313, -907, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1057, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035,
+    -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -994, -1250, -1506, -1250, -994, -1506,
+    -1506, -1250, -1100, -1506, -1506, -1506, -912, -1506, -994, -1506,
+    -1506, -1506, -1506, -844, -1506, -1506, -912, -1506, -1506, -1506,
+    -1506, -1506, -1506, -1506, -1506, -1506, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -682, -1343, -1343, -1343,
+    -1087, -1343, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -719, -1380, -1380,
+    -1380, -1380, -1380, -1124, -1380, -1380, -1380, -1380, -786, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -146, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962,
+    -61, -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962,
+    -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962, -1962,
+    -1962, -1962, -1962, -1962, -655, -2203, -2203, -805, -1691, -2203,
+    -2203, -2203, -1947, -2203, -2203, -1947, -2203, -2203, -2203, -2203,
+    -2203, -1691, -372, -613, -2203, -2203, -2203, -2203, -2203, -2203,
+    -1255, -2203, -2203, -1228, -2203, -1797, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -585, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1971, -1971, -1971, -1971, -1121, -1971, -1971, -1971,
+    -1971, -1971, -1971, -1971, -1971, -81, -1971, -1971, -1971, -1971,
+    -1715, -1971, -1971, -1971, -1971, -1971, -1971, -1971, -1971, -1971,
+    -1971, -1971, -1971, -1971, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1437, -1437,
+    -1437, -1437, -552, -1437, -1437, -1437, -1437, -1437, -1437, -669,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -812, -1623, -1623, -1623, -379, -1623, -1623, -1623, -1623, -1623,
+    -1623, -1623, -1367, -1623, -1029, -812, -1623, -1623, -1623, -1623,
+    -1623, -1623, -1623, -1623, -1623, -1623, -1623, -1623, -1623, -1623,
+    -1623, -1623, -1437, -1437, -1437, -1437, -776, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -490, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -2853, -2853, -2853, -2853, -2853, -2853,
+    -2853, -2853, -2853, -2853, -2853, -2853, -2853, -1268, -2853, -2853,
+    -2853, -2447, -2853, -2853, -18, -2853, -2853, -2853, -2853, -2853,
+    -2853, -2853, -2853, -2853, -2853, -2853, -1334, -1334, -1334, -1334,
+    -928, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -822, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1181, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -391, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -2195, -2195, -2195, -2195, -513, -2195, -2195, -642,
+    -1683, -2195, -2195, -2195, -2195, -2195, -2195, -2195, -2195, -2195,
+    -2195, -1789, -2195, -2195, -2195, -2195, -2195, -2195, -309, -1939,
+    -2195, -1171, -1939, -1683, -1984, -1984, -1984, -1984, -1984, -1984,
+    -1984, -194, -1984, -1984, -1984, -1984, -1984, -1984, -484, -1984,
+    -1984, -1984, -1984, -1984, -1984, -1984, -1984, -1984, -1984, -1984,
+    -1984, -1984, -1984, -1984, -1984, -1984, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -672, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -840, -1227,
+    -1043, -1075, -1307, -1165, -1475, -1015, -1089, -2108, -1804, -1307,
+    -1143, -1421, -962, -1227, -2636, -1297, -981, -831, -1623, -1984,
+    -891, -3297, -1713, -3297, -3297, -3297, -3297, -3297, -2785, -3297,
+    -1032, -1437, -1437, -1437, -1437, -1181, -1437, -1437, -1181, -1437,
+    -1032, -1437, -1437, -1437, -1437, -843, -1437, -1437, -1437, -1181,
+    -1437, -1437, -1032, -1437, -1181, -1437, -1032, -1437, -1437, -1437,
+    -1181, -1437, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -2753, -2753, -2753, -2753, -2753, -2753,
+    -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753,
+    -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753, -2753,
+    -77, -1108, -2753, -2753, -789, -2034, -1888, -1632, -1888, -1888,
+    -1888, -1632, -1888, -1632, -1888, -1888, -1888, -1632, -1632, -1888,
+    -1888, -1482, -1888, -1632, -123, -1632, -1888, -1888, -1888, -1888,
+    -1888, -1888, -1376, -1482, -1888, -1632, -1632, -1888, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -2415, -31, -2415, -2415, -2415, -2415, -2415, -2415, -2415, -2415,
+    -2415, -2415, -2415, -2415, -2415, -2415, -2415, -2159, -2159, -2415,
+    -2415, -2415, -2415, -2415, -2415, -2415, -1820, -2415, -2415, -1327,
+    -2415, -2415, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1547, -1547,
+    -1547, -600, -1547, -1547, -1547, -1547, -1547, -1547, -1547, -1547,
+    -662, -1142, -1547, -1547, -1547, -1547, -1142, -1547, -1547, -1547,
+    -1547, -1547, -1547, -1547, -829, -1547, -1547, -1142, -1547, -1547,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -682,
+    -1343, -1087, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343,
+    -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1343, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1324, -1324, -1324, -1324, -812, -1324, -1324, -1324,
+    -1068, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -220, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564, -1564,
+    -1564, -1564, -1564, -1564, -1564, -1564, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1795, -1795,
+    -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795,
+    -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795, -1795,
+    -1795, -1795, -1795, -1795, -795, -1795, -1795, -172, -1389, -1539,
+    -1806, -1806, -1806, -1806, -1806, -1806, -1806, -1806, -1806, -1806,
+    -1806, -1212, -1806, -1806, -1806, -1806, -1806, -1806, -1806, -1806,
+    -1806, -1806, -1806, -1806, -113, -1806, -1806, -1806, -1806, -1806,
+    -1806, -1806, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -3517, -1384, -1309, -1349, -3517, -1282,
+    -1319, -3517, -2204, -3517, -3261, -933, -1251, -403, -3517, -1482,
+    -3517, -1222, -817, -946, -1761, -2214, -1638, -3517, -3517, -3517,
+    -715, -2798, -3517, -3517, -3261, -3517, -1410, -3214, -3214, -3214,
+    -215, -3214, -3214, -3214, -1069, -3214, -3214, -1666, -3214, -3214,
+    -1200, -3214, -3214, -1146, -3214, -3214, -684, -3214, -3214, -3214,
+    -822, -3214, -3214, -3214, -3214, -2808, -3214, -3214, -599, -3134,
+    -3134, -3134, -1257, -3134, -3134, -800, -1320, -3134, -3134, -1433,
+    -3134, -3134, -220, -3134, -3134, -1196, -3134, -3134, -1697, -3134,
+    -3134, -3134, -3134, -3134, -3134, -3134, -3134, -3134, -3134, -3134,
+    -546, -3055, -3055, -3055, -511, -3055, -3055, -3055, -504, -3055,
+    -3055, -3055, -3055, -3055, -598, -3055, -3055, -1206, -3055, -3055,
+    -1470, -3055, -2054, -3055, -2543, -3055, -3055, -3055, -3055, -3055,
+    -3055, -3055, -946, -1922, -2043, -1816, -2990, -1601, -2990, -2990,
+    -1415, -2990, -2990, -572, -1454, -664, -2990, -2395, -1484, -1943,
+    -1254, -1966, -2990, -598, -2990, -621, -1421, -2990, -2990, -2990,
+    -2990, -2990, -2734, -2990, -693, -3086, -3086, -3086, -811, -3086,
+    -3086, -3086, -825, -3086, -3086, -1619, -3086, -3086, -340, -3086,
+    -3086, -623, -3086, -3086, -1367, -3086, -3086, -3086, -3086, -3086,
+    -3086, -3086, -2830, -2424, -3086, -3086, -778, -2535, -2791, -2791,
+    -716, -2791, -2791, -2791, -680, -2791, -2791, -1238, -2791, -2791,
+    -510, -2791, -2791, -572, -2791, -2791, -1020, -2791, -2791, -2791,
+    -2791, -2791, -2791, -2791, -2791, -2791, -2791, -2791, -479, -3418,
+    -3418, -3418, -333, -3418, -3418, -3418, -568, -3418, -3418, -3418,
+    -3418, -3418, -919, -3418, -3418, -3418, -3418, -2699, -1450, -3418,
+    -3418, -3418, -2756, -3418, -3418, -3418, -3418, -3418, -3418, -3418,
+    -3328, -3328, -3328, -1733, -3328, -1201, -2154, -3328, -3328, -3328,
+    -3328, -1700, -1162, -360, -3328, -3328, -3328, -2281, -831, -606,
+    -3328, -3328, -3328, -3328, -3328, -3328, -571, -3328, -3328, -2477,
+    -3072, -3328, -259, -2352, -2352, -2352, -1246, -2352, -2352, -2352,
+    -2096, -2352, -2352, -2352, -2352, -2352, -640, -2352, -2352, -2352,
+    -2352, -2352, -522, -2352, -2352, -2352, -2352, -2352, -2352, -2352,
+    -2352, -2352, -2352, -2352, -2423, -2423, -2423, -2423, -849, -2423,
+    -2423, -2423, -481, -2423, -2423, -2423, -2423, -198, -2423, -2423,
+    -2423, -2423, -2423, -2423, -2423, -2423, -2423, -2423, -2167, -2423,
+    -2423, -2423, -2423, -2423, -2423, -2423, -583, -2968, -2968, -2968,
+    -588, -2968, -2968, -2968, -502, -2968, -2968, -2968, -2968, -2968,
+    -530, -2968, -2968, -2968, -2968, -2968, -1252, -2968, -2968, -2968,
+    -1084, -2968, -2968, -2968, -2968, -2968, -2968, -2968, -568, -3249,
+    -3249, -3249, -710, -3249, -3249, -3249, -800, -3249, -3249, -3249,
+    -3249, -3249, -697, -3249, -3249, -695, -3249, -3249, -845, -3249,
+    -3249, -3249, -799, -3249, -3249, -3249, -3249, -3249, -3249, -3249,
+    -1261, -3007, -3007, -3007, -582, -3007, -3007, -3007, -1398, -3007,
+    -3007, -3007, -3007, -3007, -119, -3007, -3007, -3007, -3007, -3007,
+    -2007, -3007, -3007, -3007, -3007, -3007, -3007, -3007, -3007, -3007,
+    -3007, -3007, -2876, -1260, -1563, -2364, -3281, -219, -3281, -2078,
+    -3281, -3281, -3281, -2157, -2769, -643, -3281, -1342, -3281, -1059,
+    -2876, -1180, -1204, -1456, -1294, -3025, -3281, -3281, -3281, -3281,
+    -3281, -3281, -2620, -3281, -569, -2986, -2986, -2986, -681, -2986,
+    -2580, -1520, -1527, -2986, -2986, -787, -2986, -2986, -813, -2986,
+    -2986, -430, -2986, -2986, -1143, -2986, -2986, -2986, -2730, -2986,
+    -2986, -2986, -2986, -2730, -2986, -2986, -2085, -2085, -2085, -2085,
+    -2085, -2085, -2085, -2085, -2085, -2085, -2085, -2085, -2085, -2085,
+    -2085, -2085, -2085, -2085, -2085, -2085, -43, -2085, -2085, -2085,
+    -2085, -2085, -2085, -2085, -2085, -2085, -2085, -2085, -1018, -2885,
+    -2885, -2885, -97, -2885, -2885, -2885, -1139, -2885, -2885, -2885,
+    -2885, -2885, -872, -2885, -2885, -2885, -2885, -2885, -1532, -2885,
+    -2885, -2885, -2885, -2885, -2885, -2885, -2885, -2885, -2885, -2885,
+    -800, -3353, -1521, -3353, -802, -3353, -3353, -502, -893, -3353,
+    -2692, -1880, -1617, -2841, -685, -1167, -3097, -3353, -3353, -1026,
+    -777, -3353, -2229, -3353, -2307, -3353, -3353, -3353, -3353, -2948,
+    -3097, -3353, -1435, -3576, -3576, -3576, -1499, -3576, -3576, -182,
+    -1434, -3576, -3576, -3576, -3576, -3576, -449, -3576, -3576, -1518,
+    -3576, -3576, -1864, -3576, -1681, -3576, -3320, -3576, -3576, -3576,
+    -3576, -3576, -3576, -3576, -2582, -2582, -2582, -2582, -2582, -2582,
+    -2070, -2582, -2582, -2582, -2582, -2326, -2582, -232, -2582, -620,
+    -2582, -1732, -564, -1409, -2582, -2582, -2582, -2582, -2582, -2582,
+    -2582, -2582, -2582, -2070, -2582, -2582, -768, -2517, -2517, -2517,
+    -202, -2517, -2517, -2517, -587, -2517, -2517, -2517, -2517, -2517,
+    -1051, -2517, -2517, -2517, -2517, -2517, -2005, -2517, -2517, -2517,
+    -2517, -2517, -2517, -2517, -2517, -2517, -2517, -2517, -509, -3365,
+    -3365, -3365, -738, -3365, -3365, -528, -505, -3365, -3365, -3365,
+    -3365, -3365, -848, -3365, -3365, -1571, -3365, -3365, -3365, -3365,
+    -2960, -3365, -3365, -3365, -3365, -3365, -3365, -2960, -3365, -3365,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -2187, -2849, -2849, -2849, -950, -2849, -2849, -2849,
+    -1998, -2849, -2849, -2849, -2849, -2849, -37, -2849, -2849, -2849,
+    -2849, -2849, -2849, -2849, -2849, -2849, -2849, -2849, -2849, -2849,
+    -2849, -2849, -2849, -2849, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1487, -1825, -528, -1231,
+    -1569, -1825, -1569, -1487, -957, -2081, -2081, -1569, -1569, -1825,
+    -1569, -1419, -2081, -1487, -1419, -1057, -1675, -2081, -1825, -2081,
+    -1163, -2081, -454, -1825, -1825, -2081, -1825, -2081, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830,
+    -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830, -1830,
+    -1830, -1830, -1830, -1830, -1830, -1830, -1425, -945, -231, -657,
+    -1830, -1830, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -836, -939, -1498, -1436, -1978, -1296,
+    -1872, -1153, -556, -2128, -1978, -1316, -1316, -1872, -1296, -1533,
+    -2384, -1872, -1242, -770, -1872, -1722, -917, -2384, -1040, -2384,
+    -1872, -2384, -1872, -2384, -1722, -2384, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1752, -1496,
+    -1158, -1752, -1752, -728, -1240, -1752, -1752, -1752, -1752, -1091,
+    -1752, -728, -1752, -1496, -1752, -1240, -628, -902, -1496, -1752,
+    -1496, -1752, -1752, -1752, -1091, -1752, -1752, -1752, -1752, -1752,
+    -1590, -1590, -1590, -1590, -822, -1590, -1590, -1590, -871, -1590,
+    -1590, -1590, -1590, -1590, -1334, -1590, -1590, -1590, -1590, -1590,
+    -386, -1590, -1590, -1590, -1078, -1590, -1590, -1590, -1590, -1590,
+    -1590, -1590, -1231, -1487, -1487, -1487, -1487, -1487, -1487, -825,
+    -1487, -1487, -1487, -1487, -1487, -1487, -440, -1487, -1487, -1081,
+    -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487,
+    -1487, -1487, -1487, -1487, -544, -1430, -1430, -1430, -1174, -1430,
+    -1430, -1430, -1024, -1430, -1430, -1430, -1430, -1430, -1174, -1430,
+    -1430, -1430, -1430, -1430, -1024, -1430, -1430, -1430, -1430, -1430,
+    -1430, -1430, -1430, -1430, -1430, -1430, -1888, -1888, -1888, -1632,
+    -1888, -1632, -1888, -1888, -1888, -1888, -1888, -102, -1888, -1482,
+    -1888, -1888, -1888, -1888, -1888, -1888, -1888, -1226, -1888, -1888,
+    -1888, -1888, -1888, -1888, -1888, -1888, -1888, -1888, -1189, -1445,
+    -1445, -1445, -1189, -1445, -1445, -1445, -1189, -1445, -1445, -1445,
+    -1445, -1445, -726, -1445, -1445, -594, -1445, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445, -1445,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1181, -1437, -1437, -1437, -1437, -1437,
+    -391, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -843, -1693, -1693, -1693, -296, -1693, -1693, -1693,
+    -975, -1693, -1693, -1693, -1693, -1693, -975, -1693, -1693, -1693,
+    -1693, -1288, -1693, -1693, -1693, -1693, -1693, -1693, -1693, -1693,
+    -1693, -1693, -1693, -1693, -1662, -1662, -1662, -1662, -1662, -943,
+    -1662, -1662, -1662, -1662, -1662, -1662, -1662, -328, -1662, -1662,
+    -1662, -1662, -1406, -638, -1662, -1662, -1662, -1662, -1662, -1662,
+    -1662, -1662, -1662, -1662, -1662, -1662, -414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414,
+    -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1414, -1324, -1324,
+    -1324, -1324, -918, -1324, -1324, -1324, -918, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324, -1324,
+    -552, -1500, -1500, -1500, -1500, -1500, -1500, -1500, -732, -1500,
+    -1500, -1500, -1500, -1500, -1244, -1500, -1500, -1500, -1500, -1500,
+    -1500, -1500, -1500, -1500, -781, -1500, -1500, -1500, -1500, -1500,
+    -1500, -1500, -1208, -1870, -1870, -1870, -1614, -1870, -1870, -1870,
+    -782, -1870, -1870, -1870, -1870, -1870, -1358, -1870, -1870, -173,
+    -1870, -1870, -1614, -1870, -1870, -1870, -1870, -1870, -1870, -1870,
+    -1870, -1870, -1870, -1870, -1389, -1389, -1389, -1389, -1133, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1389, -1389, -539, -1389,
+    -1389, -1389, -1389, -1389, -1133, -1389, -1389, -1389, -1389, -1389,
+    -1389, -1389, -1389, -1389, -1389, -1389, -1466, -1466, -1210, -1466,
+    -1466, -1061, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -492,
+    -1466, -1210, -1466, -954, -1466, -1466, -1210, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1466, -1041, -1553,
+    -1553, -1553, -785, -1553, -1553, -1297, -1553, -1553, -1553, -1147,
+    -1553, -1553, -1041, -1553, -1553, -465, -1553, -1553, -1297, -1553,
+    -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553, -1553,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1406, -1406, -1406, -1406, -459, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1150, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1729, -1729, -1473, -1729, -961, -1729,
+    -1729, -243, -1217, -1729, -1729, -1729, -1729, -1729, -1473, -1473,
+    -1729, -1729, -1729, -1135, -1135, -1729, -1729, -1729, -1729, -1729,
+    -1729, -1729, -1729, -1729, -1729, -1729, -1973, -1973, -1973, -1973,
+    -1567, -1973, -1973, -106, -1567, -1973, -1973, -1973, -1973, -1973,
+    -973, -1973, -1973, -1567, -1973, -1973, -1973, -1973, -1717, -1973,
+    -1973, -1973, -1973, -1973, -1973, -1973, -1973, -1973, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -928, -1334, -928, -1334, -1334, -1078, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1302, -1302, -1302, -1302, -1046, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1046, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1161, -1756, -1756, -1756, -1756, -1756, -1756, -350,
+    -538, -1756, -1756, -1756, -1756, -1756, -905, -1756, -1756, -1500,
+    -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756, -1756,
+    -1756, -1756, -1756, -1756, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1334, -1334, -1334, -1334,
+    -928, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -822, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500,
+    -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500, -1500,
+    -1500, -1500, -1500, -1500, -1500, -1500, -282, -1500, -1500, -1500,
+    -1500, -1500, -1346, -1523, -1990, -1958, -1090, -2026, -2876, -1352,
+    -1446, -1876, -2470, -1808, -1096, -1990, -1876, -1958, -2876, -2620,
+    -1323, -1011, -2470, -2470, -1358, -2876, -2470, -2876, -2620, -808,
+    -1734, -2876, -244, -2876, -1487, -1487, -1487, -1487, -1487, -1487,
+    -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487,
+    -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487, -1487,
+    -1487, -1487, -1081, -329, -1487, -1487, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -950, -1147,
+    -1473, -1367, -1796, -1761, -1699, -1153, -521, -2241, -2391, -1458,
+    -1015, -1141, -1078, -1522, -2647, -2052, -1416, -939, -1761, -1879,
+    -969, -2647, -816, -2647, -2052, -2647, -2647, -2647, -1796, -2647,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -801, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1039, -1189, -1445, -850, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1445, -1445, -1189, -1189, -933, -1445,
+    -1445, -1445, -1189, -1039, -1445, -1445, -1039, -1445, -1445, -1445,
+    -1445, -1445, -1445, -1445, -1189, -1445, -1426, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1426, -1682, -1682, -1682, -1682,
+    -1682, -1682, -1682, -158, -1682, -1682, -1682, -1682, -1855, -1855,
+    -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1855,
+    -1855, -1855, -1855, -1855, -1855, -1855, -1855, -1343, -1855, -1855,
+    -1855, -1855, -1855, -1855, -1005, -389, -512, -1087, -908, -1855,
+    -1473, -1473, -1324, -1473, -571, -844, -1729, -1729, -1729, -1729,
+    -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729,
+    -1729, -1729, -1729, -1729, -1729, -1729, -449, -1011, -1473, -1473,
+    -1729, -1729, -1437, -1437, -1032, -1437, -1437, -1437, -1437, -1032,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437,
+    -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -776, -925,
+    -776, -1437, -1437, -1437, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035, -1291, -1291,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302, -1302,
+    -1302, -1302, -1302, -1302, -1302, -1302, -1046, -1302, -1302, -1046,
+    -1302, -1302, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1035, -1291, -1291, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1217, -1473, -1473, -332, -1473, -1473, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380, -1380,
+    -1380, -1380, -1380, -1380, -1380, -495, -1380, -1380, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -672, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1035,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -431, -1406, -1406, -1406, -1406, -1406, -1406, -1406, -1406,
+    -1406, -1406, -1406, -1406, -1406, -1406, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313, -1313,
+    -1313, -801, -1313, -1313, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -590, -903,
+    -1372, -1300, -1473, -1402, -1705, -1000, -830, -1961, -2348, -1617,
+    -1179, -1571, -1347, -1700, -2797, -1887, -1057, -832, -2018, -2309,
+    -911, -3565, -1402, -3565, -1951, -3565, -2903, -3565, -1239, -3565,
+    -2523, -2523, -2117, -2523, -2523, -2267, -2523, -2267, -2011, -2523,
+    -2523, -2523, -2523, -2523, -2523, -2117, -2523, -2523, -2267, -2011,
+    -2267, -2523, -2523, -2523, -2267, -2523, -2117, -22, -2523, -2523,
+    -1805, -2523, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524,
+    -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524,
+    -1524, -1524, -1524, -1524, -1524, -1524, -1524, -1524, -806, -1268,
+    -1268, -366, -1524, -1524, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353, -1353,
+    -691, -947, -1353, -1353, -1353, -1353, -2766, -2766, -2766, -2766,
+    -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766,
+    -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766, -2766,
+    -2766, -2766, -439, -147, -2766, -2766, -1916, -2172, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -2002, -1596, -2002, -2002, -2002, -1746, -1746, -1340, -2002, -2002,
+    -2002, -1408, -1234, -237, -2002, -1746, -2002, -1190, -956, -1408,
+    -2002, -1746, -2002, -2002, -1283, -2002, -1027, -2002, -2002, -2002,
+    -1234, -2002, -1362, -1874, -1874, -1874, -957, -1874, -1874, -1874,
+    -1469, -1874, -1874, -1618, -1874, -1874, -1063, -1874, -1874, -1063,
+    -1874, -1874, -238, -1874, -1874, -1874, -957, -1874, -1874, -1874,
+    -1874, -1874, -1618, -1874, -693, -1641, -1641, -1641, -873, -1641,
+    -1641, -1129, -1641, -1641, -1641, -979, -1641, -1641, -499, -1641,
+    -1641, -1235, -1641, -1641, -1641, -1641, -1641, -1641, -1641, -1641,
+    -1641, -1641, -1641, -1641, -1129, -1641, -800, -1686, -1686, -1686,
+    -618, -1686, -1686, -1686, -800, -1686, -1686, -1686, -1686, -1686,
+    -455, -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686,
+    -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1686, -1437, -1181,
+    -1437, -1032, -1437, -1437, -1437, -1437, -1437, -1437, -1437, -1032,
+    -1437, -1032, -1437, -1437, -1437, -1437, -1181, -1437, -1437, -1181,
+    -1437, -669, -1437, -1437, -1437, -1437, -1437, -1181, -1437, -1437,
+    -1153, -1558, -1558, -1558, -1558, -1558, -1558, -1558, -1153, -1558,
+    -1558, -1558, -1558, -1558, -355, -1558, -1558, -840, -1558, -1558,
+    -1302, -1558, -1558, -1558, -1558, -1558, -1558, -1558, -1558, -1558,
+    -1558, -1558, -1210, -1466, -1466, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1061, -1466, -1466, -549, -1466, -1466, -748,
+    -1466, -1466, -1210, -1466, -1466, -1466, -1466, -1466, -1466, -1466,
+    -1466, -1466, -1466, -1466, -761, -1848, -1848, -1848, -535, -1848,
+    -1848, -1848, -1037, -1848, -1848, -1848, -1848, -1848, -450, -1848,
+    -1848, -1848, -1848, -1848, -901, -1848, -1848, -1848, -1848, -1848,
+    -1848, -1848, -1848, -1442, -1848, -1848, -2302, -2302, -2302, -2302,
+    -2302, -904, -2302, -2302, -2302, -2302, -2302, -2302, -1534, -888,
+    -2302, -2302, -2302, -2302, -1128, -778, -2302, -2302, -2302, -2302,
+    -2302, -2302, -198, -2302, -2302, -2046, -2302, -2302, -1106, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1362, -1362, -1106, -1362, -1362, -1362, -1362, -1362, -644, -1362,
+    -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362, -1362,
+    -1334, -1334, -1334, -1334, -1078, -1334, -1334, -1334, -822, -1334,
+    -1334, -1334, -1334, -1078, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334, -1334,
+    -1334, -1334, -451, -1682, -1682, -1682, -796, -1682, -1682, -1682,
+    -707, -1682, -1682, -1426, -1682, -1682, -831, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -1682, -1682, -1170, -1682, -1682, -1682,
+    -1682, -1682, -1682, -1682, -950, -1867, -1867, -1867, -1462, -1867,
+    -1867, -1867, -867, -1867, -1867, -1867, -1867, -1867, -761, -1867,
+    -1867, -709, -1867, -1867, -1462, -1867, -1867, -1867, -394, -1867,
+    -1611, -1867, -1867, -1611, -1867, -1867, -683, -1729, -1729, -1729,
+    -1068, -1729, -1729, -1729, -1473, -1729, -1729, -1729, -1729, -1473,
+    -256, -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729,
+    -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1729, -1768, -1512,
+    -1768, -1768, -1768, -1000, -1768, -210, -1768, -1768, -1768, -1768,
+    -1768, -1000, -1768, -1512, -1768, -1174, -1768, -1768, -1512, -1768,
+    -1768, -1768, -1768, -1768, -1768, -1768, -1768, -1768, -1768, -1768,
+    -807, -1618, -1618, -1618, -671, -1618, -900, -1618, -1213, -1618,
+    -1618, -957, -1618, -1618, -1362, -1618, -1618, -618, -1618, -1618,
+    -1618, -1618, -1618, -1618, -1618, -1618, -1618, -1618, -1618, -1618,
+    -1618, -1618, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1035, -1291, -1291, -1291, -1291, -1291, -1291, -1291,
+    -1291, -1291, -1291, -1291, -1385, -1641, -1641, -1641, -829, -1641,
+    -1641, -1641, -1385, -1641, -1641, -1641, -1641, -1641, -252, -1641,
+    -1641, -1641, -1641, -1641, -1385, -1641, -1641, -1641, -1641, -1641,
+    -1641, -1641, -1641, -1641, -1641, -1641, -1931, -2443, -2187, -2443,
+    -1724, -2443, -2443, -1240, -1724, -2443, -2443, -2443, -2443, -2443,
+    -1632, -1931, -2443, -2443, -2443, -2037, -1781, -2443, -2443, -2443,
+    -2443, -2443, -67, -2187, -2443, -1163, -2187, -2443, -1157, -2132,
+    -2132, -2132, -1214, -2132, -2132, -262, -1413, -2132, -2132, -2132,
+    -632, -2132, -1044, -2132, -2132, -1364, -2132, -2132, -2132, -2132,
+    -1320, -2132, -2132, -2132, -1184, -2132, -2132, -2132, -2132, -2132,
+    -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1473, -662, -1473, -623, -1473, -1473, -812, -1473,
+    -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473, -1473,
+    -1473, -1473, -1398, -1398, -1398, -1398, -480, -1398, -1398, -1398,
+    -1142, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1342, -1936, -1936, -1936, -602, -1936,
+    -1936, -291, -762, -1936, -1936, -1936, -1936, -1936, -1342, -1936,
+    -1936, -1680, -1936, -1936, -1936, -1936, -1342, -1936, -1936, -1936,
+    -1936, -1936, -1936, -1936, -1936, -1936, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1978, -1978,
+    -1978, -1978, -498, -1978, -1978, -1978, -1978, -1978, -1978, -1978,
+    -1978, -1978, -189, -1978, -1978, -1978, -1978, -1978, -1978, -1978,
+    -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978, -1978,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280, -1280,
+    -1280, -1280, -990, -1669, -760, -1876, -1726, -2132, -2388, -1170,
+    -1576, -2388, -2132, -1793, -1876, -2132, -1502, -2388, -2388, -824,
+    -282, -1246, -2132, -2388, -1300, -2388, -1576, -2388, -2388, -2388,
+    -2132, -2388, -1876, -2388, -2633, -2633, -2633, -2633, -2633, -2633,
+    -2633, -2633, -2633, -2633, -2633, -2633, -2377, -2633, -2377, -2633,
+    -2633, -2633, -2633, -2228, -2633, -2633, -2633, -2633, -2633, -2633,
+    -2633, -12, -2633, -2633, -1972, -2633, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398, -1398,
+    -1398, -1398, -1142, -1398, -736, -1142, -736, -1398, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422, -1422,
+    -1422, -1422, -1422, -1422, -447, -1016, -1422, -1422, -1422, -1422,
+    -1324, -1580, -1580, -1580, -1580, -1580, -1324, -1580, -1580, -1580,
+    -1580, -1580, -1324, -1580, -1580, -985, -1580, -1580, -1580, -985,
+    -1580, -1580, -1068, -1580, -1324, -1580, -985, -918, -1068, -1324,
+    -632, -1580, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595,
+    -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279,
+    -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769,
+    -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359,
+    -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113, -1069, -2433,
+    -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125, -1120, -990,
+    -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837, -2869, -1347,
+    -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492, -1555, -1113,
+    -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623, -2587, -1125,
+    -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445, -646, -1837,
+    -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266, -846, -1492,
+    -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071, -1046, -1623,
+    -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474, -1473, -2445,
+    -646, -1837, -2869, -1347, -1838, -2359, -1035, -1595, -1445, -1266,
+    -846, -1492, -1555, -1113, -1069, -2433, -1976, -1279, -1418, -1071,
+    -1046, -1623, -2587, -1125, -1120, -990, -1409, -1769, -1486, -2474,
+    -1473, -2445, -646, -1837, -2869, -1347, -1838, -2359, 0,
+};
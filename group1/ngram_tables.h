@@ -0,0 +1,42 @@
+/*
+ * ngram_tables.h
+ * English language n-gram statistics, trained from SampleText/ by
+ * ngram_tables.py. For bigrams, bytes are grouped into NGRAM_CLASSES
+ * classes: each letter in each case, space, digits, a few kinds of
+ * punctuation, line breaks, other printable characters, control characters
+ * and bytes above 127. Trigrams use TRIGRAM_CLASSES coarser classes, with
+ * case folded, so that their table fits in 64 KiB.
+ */
+
+#ifndef ___ngram_tables_h___
+#define ___ngram_tables_h___
+
+#include <stdint.h>
+
+#define NGRAM_CLASSES 64
+// Log probabilities are stored as round(NGRAM_LOG_SCALE * log2(p))
+#define NGRAM_LOG_SCALE 256
+
+#define TRIGRAM_CLASSES 32
+#define TRIGRAM_CLASS_BITS 5
+// Entries in english_trigram_log2, counting one of padding
+#define TRIGRAM_TABLE_SIZE (TRIGRAM_CLASSES * TRIGRAM_CLASSES * \
+        TRIGRAM_CLASSES + 1)
+
+// Class of each byte value
+extern const uint8_t english_byte_class[256];
+
+// english_bigram_log2[a][b] is the scaled log2 probability of a byte of
+// class b following one of class a
+extern const int16_t english_bigram_log2[NGRAM_CLASSES][NGRAM_CLASSES];
+
+// Trigram class of each byte value
+extern const uint8_t english_trigram_class[256];
+
+// english_trigram_log2[(a << 10) | (b << 5) | c] is the scaled log2
+// probability of a byte of trigram class c following ones of classes a and
+// b, so the entries for one context share cache lines. The last entry is
+// padding, so vector code can read 4 bytes from any real entry.
+extern const int16_t english_trigram_log2[TRIGRAM_TABLE_SIZE];
+
+#endif  // ___ngram_tables_h___
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+
+import glob
+import math
+import os
+
+CLASSES = 64
+TRIGRAM_CLASSES = 32
+# Trigram class of control characters and bytes above 127
+TRIGRAM_OTHER = 31
+LOG_SCALE = 256
+
+# Byte classes: letters keep their case, so that a key byte that flips case
+# scores worse than the right one
+SPACE = 52
+DIGIT = 53
+PERIOD = 54
+COMMA = 55
+QUOTE = 56
+PUNCTUATION = 57
+NEWLINE = 58
+OTHER_PRINTABLE = 59
+CONTROL = 60
+HIGH = 61
+
+def byte_class(b):
+  """Map a byte to its class"""
+  c = chr(b)
+  if b >= 128:
+    return HIGH
+  if 'a' <= c <= 'z':
+    return b - ord('a')
+  if 'A' <= c <= 'Z':
+    return 26 + b - ord('A')
+  if c == ' ':
+    return SPACE
+  if c.isdigit():
+    return DIGIT
+  if c == '.':
+    return PERIOD
+  if c == ',':
+    return COMMA
+  if c in '\'"':
+    return QUOTE
+  if c in '!?;:-()':
+    return PUNCTUATION
+  if c in '\n\r\t':
+    return NEWLINE
+  if b < 32 or b == 127:
+    return CONTROL
+  return OTHER_PRINTABLE
+
+def trigram_class(b):
+  """Map a byte to its class for the trigram model, which folds case and
+  has coarser classes than byte_class so that its table stays small"""
+  c = chr(b)
+  if b >= 128 or ((b < 32 or b == 127) and c not in '\n\r\t'):
+    return TRIGRAM_OTHER
+  if c.isalpha():
+    return ord(c.lower()) - ord('a')
+  if c == ' ':
+    return 26
+  if c in '\n\r\t':
+    return 27
+  if c.isdigit():
+    return 28
+  if c in '.,;:!?':
+    return 29
+  return 30
+
+def count_bigrams(data, counts):
+  """Add the class bigrams of some bytes to a CLASSES x CLASSES table"""
+  classes = [byte_class(b) for b in data]
+  for a, b in zip(classes, classes[1:]):
+    counts[a][b] += 1
+
+def count_trigrams(data, counts):
+  """Add the class trigrams of some bytes to a flat table indexed by
+  (a * TRIGRAM_CLASSES + b) * TRIGRAM_CLASSES + c. The text is taken to be
+  preceded by two spaces, as the C scorer does."""
+  space = trigram_class(ord(' '))
+  classes = [space, space] + [trigram_class(b) for b in data]
+  for a, b, c in zip(classes, classes[1:], classes[2:]):
+    counts[(a * TRIGRAM_CLASSES + b) * TRIGRAM_CLASSES + c] += 1
+
+def log_probabilities(counts):
+  """Turn rows of counts into scaled log2 P(column | row), with add-one
+  smoothing"""
+  table = []
+  for row in counts:
+    total = sum(row) + len(row)
+    table.append([int(round(LOG_SCALE * math.log2((n + 1) / total)))
+                  for n in row])
+  return table
+
+def format_rows(rows, per_line):
+  """Format a list of lists of ints as C initializer rows"""
+  lines = []
+  for row in rows:
+    cells = [str(v) for v in row]
+    lines.append("    {")
+    for i in range(0, len(cells), per_line):
+      lines.append("        " + ", ".join(cells[i:i + per_line]) + ",")
+    lines.append("    },")
+  return "\n".join(lines)
+
+def format_flat(values, per_line):
+  """Format a list of ints as C initializer lines"""
+  cells = [str(v) for v in values]
+  return "\n".join("    " + ", ".join(cells[i:i + per_line]) + ","
+                   for i in range(0, len(cells), per_line))
+
+def output_tables(classes, bigrams, trigram_classes, trigrams):
+  """Write the tables out as C source"""
+  with open("ngram_tables.c", 'w') as f:
+    f.write("/*\n * ngram_tables.c\n * Generated by ngram_tables.py from "
+            "SampleText/; do not edit.\n */\n\n")
+    f.write("#include \"ngram_tables.h\"\n\n")
+    f.write("const uint8_t english_byte_class[256] = {\n")
+    for i in range(0, 256, 16):
+      f.write("    " + ", ".join(str(c) for c in classes[i:i + 16]) + ",\n")
+    f.write("};\n\n")
+    f.write("const int16_t english_bigram_log2[NGRAM_CLASSES]"
+            "[NGRAM_CLASSES] = {\n")
+    f.write(format_rows(bigrams, 10) + "\n};\n\n")
+    f.write("const uint8_t english_trigram_class[256] = {\n")
+    f.write(format_flat(trigram_classes, 16) + "\n};\n\n")
+    f.write("const int16_t english_trigram_log2[TRIGRAM_TABLE_SIZE] = {\n")
+    # one entry of padding follows the table
+    f.write(format_flat(trigrams + [0], 10) + "\n};\n")
+
+def main():
+  os.chdir("./SampleText")
+  counts = [[0] * CLASSES for _ in range(CLASSES)]
+  trigram_counts = [0] * TRIGRAM_CLASSES ** 3
+  for name in sorted(glob.glob("*")):
+    with open(name, 'rb') as f:
+      data = f.read()
+      count_bigrams(data, counts)
+      count_trigrams(data, trigram_counts)
+  os.chdir("..")
+  contexts = [trigram_counts[i:i + TRIGRAM_CLASSES]
+              for i in range(0, len(trigram_counts), TRIGRAM_CLASSES)]
+  # In english, TRIGRAM_OTHER bytes come in runs that spell out multi-byte
+  # characters, so following one another they look likely; but most wrong
+  # keys turn text into just such a run. Contexts that hold one fall back on
+  # how common each class is on its own.
+  unigrams = [sum(contexts[i][c] for i in range(len(contexts)))
+              for c in range(TRIGRAM_CLASSES)]
+  for i in range(len(contexts)):
+    a, b = divmod(i, TRIGRAM_CLASSES)
+    if TRIGRAM_OTHER in (a, b):
+      contexts[i] = unigrams
+  trigrams = [v for row in log_probabilities(contexts) for v in row]
+  output_tables([byte_class(b) for b in range(256)],
+                log_probabilities(counts),
+                [trigram_class(b) for b in range(256)], trigrams)
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,161 @@
+/*
+ * oracle_bench.c
+ * Measures oracle query throughput at a range of client pipeline depths, and
+ * with queries packed into batch frames.
+ *
+ * usage: oracle_bench [socket path [queries]]
+ *
+ * With no socket path, a server is started on a temporary socket in a
+ * background thread, so the numbers include both ends of the connection.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "oracle_server.h"
+#include "oracle_client.h"
+
+#define DEFAULT_QUERIES 20000
+#define MAX_DEPTH 256
+#define BATCH_SIZE 64
+
+// Private functions
+static void *serve(void *server);
+static double now(void);
+static double run_pipelined(struct oracle_client *c, uint8_t op,
+        const uint8_t *query, size_t len, size_t depth, size_t queries);
+static double run_batched(struct oracle_client *c, uint8_t op,
+        const uint8_t *query, size_t len, size_t depth, size_t queries);
+
+int main(int argc, char **argv)
+{
+    char path[64];
+    size_t queries = argc > 2 ? strtoul(argv[2], NULL, 10) : DEFAULT_QUERIES;
+    struct oracle_server *server = NULL;
+    pthread_t thread;
+    if (argc > 1) {
+        snprintf(path, sizeof path, "%s", argv[1]);
+    } else {
+        struct oracle_server_config config;
+        memset(&config, 0, sizeof config);
+        memcpy(config.key, "YELLOW SUBMARINE", AES128_KEY_SIZE);
+        config.secret = (const uint8_t *) "an appended secret";
+        config.secret_len = 18;
+        snprintf(path, sizeof path, "/tmp/oracle_bench-%ld.sock",
+                (long) getpid());
+        server = oracle_server_create(path, &config);
+        if (!server || pthread_create(&thread, NULL, serve, server) != 0) {
+            fprintf(stderr, "cannot start server on %s\n", path);
+            return 1;
+        }
+    }
+    struct oracle_client *c = oracle_client_connect(path);
+    if (!c) {
+        fprintf(stderr, "cannot connect to %s\n", path);
+        return 1;
+    }
+
+    // one block of plaintext to encrypt; iv || one block for padding checks
+    uint8_t block[AES_BLOCK_SIZE] = { 0 };
+    uint8_t cbc[2 * AES_BLOCK_SIZE] = { 0 };
+    const struct {
+        const char *name;
+        uint8_t op;
+        const uint8_t *query;
+        size_t len;
+    } kinds[] = {
+        { "encrypt", ORACLE_OP_ENCRYPT, block, sizeof block },
+        { "padding-check", ORACLE_OP_PADDING_CHECK, cbc, sizeof cbc },
+    };
+    printf("%-14s %-9s %6s %14s\n", "query", "mode", "depth", "queries/s");
+    for (size_t k = 0; k < sizeof kinds / sizeof kinds[0]; ++k) {
+        for (size_t depth = 1; depth <= MAX_DEPTH; depth *= 2) {
+            double qps = run_pipelined(c, kinds[k].op, kinds[k].query,
+                    kinds[k].len, depth, queries);
+            printf("%-14s %-9s %6zu %14.0f\n", kinds[k].name, "pipeline",
+                    depth, qps);
+        }
+        for (size_t depth = 1; depth <= 16; depth *= 4) {
+            double qps = run_batched(c, kinds[k].op, kinds[k].query,
+                    kinds[k].len, depth, queries);
+            printf("%-14s %-9s %6zu %14.0f\n", kinds[k].name, "batch/64",
+                    depth, qps);
+        }
+    }
+
+    oracle_client_close(c);
+    if (server) {
+        oracle_server_stop(server);
+        pthread_join(thread, NULL);
+        oracle_server_destroy(server);
+    }
+    return 0;
+}
+
+/*
+ * Thread body running the in-process server
+ */
+static void *serve(void *server)
+{
+    oracle_server_run(server);
+    return NULL;
+}
+
+/*
+ * Monotonic time in seconds
+ */
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Send queries one per frame, keeping up to depth in flight
+ * @return queries per second
+ */
+static double run_pipelined(struct oracle_client *c, uint8_t op,
+        const uint8_t *query, size_t len, size_t depth, size_t queries)
+{
+    oracle_client_set_depth(c, depth);
+    double start = now();
+    for (size_t i = 0; i < queries; ++i)
+        if (oracle_client_submit(c, op, query, len, NULL, NULL) != 0)
+            return 0;
+    if (oracle_client_wait(c, 0) != 0)
+        return 0;
+    return queries / (now() - start);
+}
+
+/*
+ * Send queries BATCH_SIZE per frame, keeping up to depth frames in flight
+ * @return queries per second
+ */
+static double run_batched(struct oracle_client *c, uint8_t op,
+        const uint8_t *query, size_t len, size_t depth, size_t queries)
+{
+    const uint8_t *payloads[BATCH_SIZE];
+    size_t lens[BATCH_SIZE];
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        payloads[i] = query;
+        lens[i] = len;
+    }
+    size_t frames = (queries + BATCH_SIZE - 1) / BATCH_SIZE;
+    oracle_client_set_depth(c, depth);
+    double start = now();
+    for (size_t i = 0; i < frames; ++i)
+        if (oracle_client_submit_batch(c, op, payloads, lens, BATCH_SIZE,
+                    NULL, NULL) != 0)
+            return 0;
+    if (oracle_client_wait(c, 0) != 0)
+        return 0;
+    return frames * BATCH_SIZE / (now() - start);
+}
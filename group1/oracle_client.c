@@ -0,0 +1,513 @@
+/*
+ * oracle_client.c
+ * Client library for the local oracle server. Queries are pipelined: submit
+ * returns as soon as the request is queued, up to a configurable number of
+ * requests are kept in flight, and replies are delivered to callbacks from an
+ * epoll loop as they arrive.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+
+#include "oracle_client.h"
+#include "padding_oracle.h"
+
+#define READ_CHUNK 65536
+
+// A request waiting for its reply. The server answers in order, so these
+// form a FIFO.
+struct pending {
+    uint32_t tag;
+    oracle_reply_fn fn;
+    void *ctx;
+};
+
+struct oracle_client {
+    int fd;
+    int epoll_fd;
+    int failed;
+    int padding_failed;         // a padding batch got a bad answer
+    int want_out;
+    uint32_t next_tag;
+    size_t depth;
+    struct pending *pending;    // ring buffer
+    size_t pending_cap;
+    size_t pending_head;
+    size_t pending_count;
+    struct byte_buf out;
+    struct byte_buf in;
+    struct byte_buf batch;      // scratch for building batch payloads
+};
+
+// State for a synchronous call
+struct call_result {
+    uint8_t *out;
+    size_t out_size;
+    size_t len;
+    int status;
+};
+
+// Where the answers to a batch of padding checks go. Allocated per batch
+// and freed by its callback, or with the pending list if it never comes.
+struct padding_result {
+    struct oracle_client *client;
+    uint8_t *valid;
+    size_t num;
+};
+
+// Private functions
+static int push_pending(struct oracle_client *c, uint32_t tag,
+        oracle_reply_fn fn, void *ctx);
+static int queue_frame(struct oracle_client *c, uint8_t op,
+        const uint8_t *payload, size_t len, oracle_reply_fn fn, void *ctx);
+static int queue_padding_batch(struct oracle_client *c,
+        const uint8_t *queries, size_t num, oracle_reply_fn fn, void *ctx);
+static int flush_requests(struct oracle_client *c);
+static int read_replies(struct oracle_client *c);
+static int update_interest(struct oracle_client *c);
+static void store_call_result(void *ctx, const struct oracle_frame *reply);
+static void store_padding_result(void *ctx, const struct oracle_frame *reply);
+
+/*
+ * Connect to a server
+ * @param path filesystem path of the server's socket
+ * @return the client, or NULL on failure
+ */
+struct oracle_client *oracle_client_connect(const char *path)
+{
+    if (!path)
+        return NULL;
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof addr.sun_path)
+        return NULL;
+    struct oracle_client *c = calloc(1, sizeof *c);
+    if (!c)
+        return NULL;
+    c->depth = ORACLE_CLIENT_DEFAULT_DEPTH;
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    c->fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    c->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event ev = { .events = EPOLLIN };
+    if (c->fd < 0 || c->epoll_fd < 0 ||
+            connect(c->fd, (struct sockaddr *) &addr, sizeof addr) != 0 ||
+            epoll_ctl(c->epoll_fd, EPOLL_CTL_ADD, c->fd, &ev) != 0) {
+        oracle_client_close(c);
+        return NULL;
+    }
+    // the socket stays blocking for connect(); all later I/O passes
+    // MSG_DONTWAIT and waits in epoll instead
+    return c;
+}
+
+/*
+ * Close the connection, dropping any replies still outstanding
+ */
+void oracle_client_close(struct oracle_client *c)
+{
+    if (!c)
+        return;
+    if (c->fd >= 0)
+        close(c->fd);
+    if (c->epoll_fd >= 0)
+        close(c->epoll_fd);
+    for (size_t i = 0; i < c->pending_count; ++i) {
+        struct pending *p = &c->pending[(c->pending_head + i) %
+            c->pending_cap];
+        if (p->fn == store_padding_result)
+            free(p->ctx);
+    }
+    free(c->pending);
+    byte_buf_free(&c->out);
+    byte_buf_free(&c->in);
+    byte_buf_free(&c->batch);
+    free(c);
+}
+
+/*
+ * Set the maximum number of requests in flight. Submitting beyond this runs
+ * the event loop until a reply frees a slot.
+ * @param depth pipeline depth; 0 is treated as 1
+ */
+void oracle_client_set_depth(struct oracle_client *c, size_t depth)
+{
+    if (c)
+        c->depth = depth ? depth : 1;
+}
+
+/*
+ * Queue a query
+ * @param op ORACLE_OP_* other than ORACLE_OP_BATCH
+ * @param payload query payload
+ * @param len length of the payload
+ * @param fn callback for the reply; may be NULL
+ * @param ctx passed to fn
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_submit(struct oracle_client *c, uint8_t op,
+        const uint8_t *payload, size_t len, oracle_reply_fn fn, void *ctx)
+{
+    if (!c || op == ORACLE_OP_BATCH)
+        return -1;
+    return queue_frame(c, op, payload, len, fn, ctx);
+}
+
+/*
+ * Queue a batch of queries of the same kind as one frame
+ * @param op ORACLE_OP_* for every query in the batch
+ * @param payloads array of query payloads
+ * @param lens array of payload lengths
+ * @param num number of queries
+ *        precondition: length of payloads and lens arrays >= num
+ * @param fn callback for the batch reply; may be NULL
+ * @param ctx passed to fn
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_submit_batch(struct oracle_client *c, uint8_t op,
+        const uint8_t *const *payloads, const size_t *lens, size_t num,
+        oracle_reply_fn fn, void *ctx)
+{
+    if (!c || !payloads || !lens || op == ORACLE_OP_BATCH ||
+            num > UINT32_MAX)
+        return -1;
+    struct byte_buf *b = &c->batch;
+    b->off = b->len = 0;
+    if (byte_buf_reserve(b, 4) != 0)
+        return -1;
+    oracle_put_u32(b->data, (uint32_t) num);
+    b->len = 4;
+    for (size_t i = 0; i < num; ++i)
+        if (oracle_append_entry(b, op, payloads[i], lens[i]) != 0)
+            return -1;
+    return queue_frame(c, ORACLE_OP_BATCH, b->data, b->len, fn, ctx);
+}
+
+/*
+ * Run the event loop until at most max_outstanding requests are in flight
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_wait(struct oracle_client *c, size_t max_outstanding)
+{
+    if (!c)
+        return -1;
+    while (!c->failed && c->pending_count > max_outstanding) {
+        if (flush_requests(c) != 0 || update_interest(c) != 0)
+            break;
+        struct epoll_event ev;
+        int n = epoll_wait(c->epoll_fd, &ev, 1, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            c->failed = 1;
+            break;
+        }
+        if (n == 1 && (ev.events & (EPOLLIN | EPOLLHUP | EPOLLERR)))
+            read_replies(c);
+    }
+    return c->failed ? -1 : 0;
+}
+
+/*
+ * Number of requests submitted but not yet answered
+ */
+size_t oracle_client_outstanding(const struct oracle_client *c)
+{
+    return c ? c->pending_count : 0;
+}
+
+/*
+ * Send one query and wait for its reply
+ * @param out buffer to copy the reply payload to, if it fits
+ * @param out_size size of out
+ * @param out_len output for the full reply length, which may exceed out_size
+ * @return ORACLE_STATUS_* of the reply, or -1 if the connection has failed
+ */
+int oracle_client_call(struct oracle_client *c, uint8_t op,
+        const uint8_t *payload, size_t len, uint8_t *out, size_t out_size,
+        size_t *out_len)
+{
+    struct call_result result = { out, out_size, 0, -1 };
+    if (queue_frame(c, op, payload, len, store_call_result, &result) != 0 ||
+            oracle_client_wait(c, 0) != 0)
+        return -1;
+    if (out_len)
+        *out_len = result.len;
+    return result.status;
+}
+
+/*
+ * ecb_oracle_fn (see ecb_attack.h) that sends ORACLE_OP_ENCRYPT queries
+ * through a connected client, passed as ctx
+ */
+size_t oracle_client_ecb_encrypt(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size)
+{
+    size_t ct_len = 0;
+    int status = oracle_client_call(ctx, ORACLE_OP_ENCRYPT, input, len, out,
+            out_size, &ct_len);
+    return status == ORACLE_STATUS_OK ? ct_len : 0;
+}
+
+/*
+ * padding_oracle_fn (see padding_oracle.h) that sends each batch of guesses
+ * as one ORACLE_OP_BATCH of ORACLE_OP_PADDING_CHECK queries through a
+ * connected client, passed as ctx. A client is not thread-safe, so attacks
+ * through it must use a single worker.
+ */
+int oracle_client_padding_check(void *ctx, const uint8_t *queries, size_t num,
+        uint8_t *valid)
+{
+    if (oracle_client_padding_submit(ctx, queries, num, valid) != 0)
+        return -1;
+    return oracle_client_padding_wait(ctx);
+}
+
+/*
+ * padding_submit_fn (see padding_oracle.h): queue a batch of guesses like
+ * oracle_client_padding_check, without waiting for the reply
+ */
+int oracle_client_padding_submit(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid)
+{
+    struct oracle_client *c = ctx;
+    if (!c || !queries || !valid || num == 0)
+        return -1;
+    struct padding_result *result = malloc(sizeof *result);
+    if (!result)
+        return -1;
+    result->client = c;
+    result->valid = valid;
+    result->num = num;
+    if (queue_padding_batch(c, queries, num, store_padding_result,
+                result) != 0) {
+        free(result);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * padding_wait_fn (see padding_oracle.h): wait for the replies to every
+ * padding batch submitted
+ * @return 0 if they all came back whole, -1 if not
+ */
+int oracle_client_padding_wait(void *ctx)
+{
+    struct oracle_client *c = ctx;
+    if (!c)
+        return -1;
+    int status = oracle_client_wait(c, 0);
+    if (c->padding_failed)
+        status = -1;
+    c->padding_failed = 0;
+    return status;
+}
+
+/*
+ * Remember a request that is waiting for a reply
+ * @return 0 on success, -1 on allocation failure
+ */
+static int push_pending(struct oracle_client *c, uint32_t tag,
+        oracle_reply_fn fn, void *ctx)
+{
+    if (c->pending_count == c->pending_cap) {
+        size_t cap = c->pending_cap ? 2 * c->pending_cap : 64;
+        struct pending *p = malloc(cap * sizeof *p);
+        if (!p)
+            return -1;
+        // unroll the ring into the new array
+        for (size_t i = 0; i < c->pending_count; ++i)
+            p[i] = c->pending[(c->pending_head + i) % c->pending_cap];
+        free(c->pending);
+        c->pending = p;
+        c->pending_cap = cap;
+        c->pending_head = 0;
+    }
+    struct pending *slot = &c->pending[(c->pending_head + c->pending_count) %
+        c->pending_cap];
+    slot->tag = tag;
+    slot->fn = fn;
+    slot->ctx = ctx;
+    ++c->pending_count;
+    return 0;
+}
+
+/*
+ * Wait for room in the pipeline, then queue a frame and start sending it
+ * @return 0 once the frame is queued, or -1 if the connection had failed or
+ *         the frame couldn't be queued. A failure to send is left for the
+ *         next wait to report, since the request is pending by then.
+ */
+static int queue_frame(struct oracle_client *c, uint8_t op,
+        const uint8_t *payload, size_t len, oracle_reply_fn fn, void *ctx)
+{
+    if (!c || c->failed)
+        return -1;
+    if (c->pending_count >= c->depth &&
+            oracle_client_wait(c, c->depth - 1) != 0)
+        return -1;
+    uint32_t tag = c->next_tag++;
+    if (oracle_append_frame(&c->out, op, tag, payload, len) != 0 ||
+            push_pending(c, tag, fn, ctx) != 0) {
+        c->failed = 1;
+        return -1;
+    }
+    flush_requests(c);
+    return 0;
+}
+
+/*
+ * Queue padding checks of contiguous PADDING_QUERY_SIZE-byte queries as one
+ * ORACLE_OP_BATCH frame
+ * @return 0 on success, -1 if the connection has failed
+ */
+static int queue_padding_batch(struct oracle_client *c,
+        const uint8_t *queries, size_t num, oracle_reply_fn fn, void *ctx)
+{
+    if (!c || num > UINT32_MAX)
+        return -1;
+    struct byte_buf *b = &c->batch;
+    b->off = b->len = 0;
+    if (byte_buf_reserve(b, 4) != 0)
+        return -1;
+    oracle_put_u32(b->data, (uint32_t) num);
+    b->len = 4;
+    for (size_t i = 0; i < num; ++i)
+        if (oracle_append_entry(b, ORACLE_OP_PADDING_CHECK,
+                    queries + i * PADDING_QUERY_SIZE,
+                    PADDING_QUERY_SIZE) != 0)
+            return -1;
+    return queue_frame(c, ORACLE_OP_BATCH, b->data, b->len, fn, ctx);
+}
+
+/*
+ * Write as much queued output as the socket will take
+ * @return 0 on success, -1 if the connection has failed
+ */
+static int flush_requests(struct oracle_client *c)
+{
+    while (c->out.off < c->out.len) {
+        ssize_t n = send(c->fd, c->out.data + c->out.off,
+                c->out.len - c->out.off, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n > 0) {
+            byte_buf_consume(&c->out, (size_t) n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        c->failed = 1;
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Read everything available and hand each complete reply to its callback
+ * @return 0 on success, -1 if the connection has failed
+ */
+static int read_replies(struct oracle_client *c)
+{
+    for (;;) {
+        if (byte_buf_reserve(&c->in, READ_CHUNK) != 0) {
+            c->failed = 1;
+            return -1;
+        }
+        ssize_t n = recv(c->fd, c->in.data + c->in.len, READ_CHUNK,
+                MSG_DONTWAIT);
+        if (n > 0) {
+            c->in.len += (size_t) n;
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+            c->failed = 1;
+        break;
+    }
+    for (;;) {
+        struct oracle_frame reply;
+        size_t used = oracle_parse_frame(c->in.data + c->in.off,
+                c->in.len - c->in.off, &reply);
+        if (used == 0)
+            break;
+        if (used == SIZE_MAX || c->pending_count == 0 ||
+                c->pending[c->pending_head].tag != reply.tag) {
+            c->failed = 1;
+            return -1;
+        }
+        struct pending p = c->pending[c->pending_head];
+        c->pending_head = (c->pending_head + 1) % c->pending_cap;
+        --c->pending_count;
+        if (p.fn)
+            p.fn(p.ctx, &reply);
+        byte_buf_consume(&c->in, used);
+    }
+    return c->failed ? -1 : 0;
+}
+
+/*
+ * Watch for writability only while there is queued output
+ * @return 0 on success, -1 if the connection has failed
+ */
+static int update_interest(struct oracle_client *c)
+{
+    int want_out = c->out.off < c->out.len;
+    if (want_out == c->want_out)
+        return 0;
+    struct epoll_event ev = { .events = EPOLLIN };
+    if (want_out)
+        ev.events |= EPOLLOUT;
+    if (epoll_ctl(c->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev) != 0) {
+        c->failed = 1;
+        return -1;
+    }
+    c->want_out = want_out;
+    return 0;
+}
+
+/*
+ * oracle_reply_fn for oracle_client_call
+ */
+static void store_call_result(void *ctx, const struct oracle_frame *reply)
+{
+    struct call_result *result = ctx;
+    result->status = reply->code;
+    result->len = reply->len;
+    if (result->out && reply->len <= result->out_size)
+        memcpy(result->out, reply->payload, reply->len);
+}
+
+/*
+ * oracle_reply_fn for oracle_client_padding_submit
+ */
+static void store_padding_result(void *ctx, const struct oracle_frame *reply)
+{
+    struct padding_result *result = ctx;
+    int ok = reply->code == ORACLE_STATUS_OK && reply->len >= 4 &&
+        oracle_get_u32(reply->payload) == result->num;
+    size_t pos = 4;
+    for (size_t i = 0; ok && i < result->num; ++i) {
+        struct oracle_frame answer;
+        size_t used = oracle_parse_entry(reply->payload + pos,
+                reply->len - pos, &answer);
+        ok = used != SIZE_MAX && answer.code == ORACLE_STATUS_OK &&
+            answer.len == 1;
+        if (ok) {
+            result->valid[i] = answer.payload[0];
+            pos += used;
+        }
+    }
+    if (!ok)
+        result->client->padding_failed = 1;
+    free(result);
+}
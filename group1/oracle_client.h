@@ -0,0 +1,121 @@
+/*
+ * oracle_client.h
+ * Client library for the local oracle server. Queries are pipelined: submit
+ * returns as soon as the request is queued, up to a configurable number of
+ * requests are kept in flight, and replies are delivered to callbacks from an
+ * epoll loop as they arrive.
+ */
+
+#ifndef ___oracle_client_h___
+#define ___oracle_client_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "oracle_proto.h"
+
+#define ORACLE_CLIENT_DEFAULT_DEPTH 64
+
+struct oracle_client;
+
+/*
+ * Called once for each reply. The frame's payload is only valid for the
+ * duration of the call. For a batch, the payload is the packed batch of
+ * answers and can be walked with oracle_parse_entry.
+ */
+typedef void (*oracle_reply_fn)(void *ctx, const struct oracle_frame *reply);
+
+/*
+ * Connect to a server
+ * @param path filesystem path of the server's socket
+ * @return the client, or NULL on failure
+ */
+struct oracle_client *oracle_client_connect(const char *path);
+
+/*
+ * Close the connection, dropping any replies still outstanding
+ */
+void oracle_client_close(struct oracle_client *client);
+
+/*
+ * Set the maximum number of requests in flight. Submitting beyond this runs
+ * the event loop until a reply frees a slot.
+ * @param depth pipeline depth; 0 is treated as 1
+ */
+void oracle_client_set_depth(struct oracle_client *client, size_t depth);
+
+/*
+ * Queue a query
+ * @param op ORACLE_OP_* other than ORACLE_OP_BATCH
+ * @param payload query payload
+ * @param len length of the payload
+ * @param fn callback for the reply; may be NULL
+ * @param ctx passed to fn
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_submit(struct oracle_client *client, uint8_t op,
+        const uint8_t *payload, size_t len, oracle_reply_fn fn, void *ctx);
+
+/*
+ * Queue a batch of queries of the same kind as one frame
+ * @param op ORACLE_OP_* for every query in the batch
+ * @param payloads array of query payloads
+ * @param lens array of payload lengths
+ * @param num number of queries
+ *        precondition: length of payloads and lens arrays >= num
+ * @param fn callback for the batch reply; may be NULL
+ * @param ctx passed to fn
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_submit_batch(struct oracle_client *client, uint8_t op,
+        const uint8_t *const *payloads, const size_t *lens, size_t num,
+        oracle_reply_fn fn, void *ctx);
+
+/*
+ * Run the event loop until at most max_outstanding requests are in flight
+ * @return 0 on success, -1 if the connection has failed
+ */
+int oracle_client_wait(struct oracle_client *client, size_t max_outstanding);
+
+/*
+ * Number of requests submitted but not yet answered
+ */
+size_t oracle_client_outstanding(const struct oracle_client *client);
+
+/*
+ * Send one query and wait for its reply
+ * @param out buffer to copy the reply payload to, if it fits
+ * @param out_size size of out
+ * @param out_len output for the full reply length, which may exceed out_size
+ * @return ORACLE_STATUS_* of the reply, or -1 if the connection has failed
+ */
+int oracle_client_call(struct oracle_client *client, uint8_t op,
+        const uint8_t *payload, size_t len, uint8_t *out, size_t out_size,
+        size_t *out_len);
+
+/*
+ * ecb_oracle_fn (see ecb_attack.h) that sends ORACLE_OP_ENCRYPT queries
+ * through a connected client, passed as ctx
+ */
+size_t oracle_client_ecb_encrypt(void *ctx, const uint8_t *input, size_t len,
+        uint8_t *out, size_t out_size);
+
+/*
+ * padding_oracle_fn (see padding_oracle.h) that sends each batch of guesses
+ * as one ORACLE_OP_BATCH of ORACLE_OP_PADDING_CHECK queries through a
+ * connected client, passed as ctx. A client is not thread-safe, so attacks
+ * through it must use a single worker.
+ */
+int oracle_client_padding_check(void *ctx, const uint8_t *queries, size_t num,
+        uint8_t *valid);
+
+/*
+ * padding_submit_fn and padding_wait_fn (see padding_oracle.h) for the same
+ * batches: submit queues one without waiting for the reply, and wait runs
+ * the event loop until every reply is in
+ */
+int oracle_client_padding_submit(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid);
+int oracle_client_padding_wait(void *ctx);
+
+#endif  // ___oracle_client_h___
@@ -0,0 +1,164 @@
+/*
+ * oracle_proto.c
+ * Wire format shared by the local oracle server and its client library. See
+ * oracle_proto.h for the frame layout.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "oracle_proto.h"
+
+/*
+ * Make room for at least extra more bytes at the end of a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int byte_buf_reserve(struct byte_buf *b, size_t extra)
+{
+    if (b->cap - b->len >= extra)
+        return 0;
+    // reclaim consumed space before growing
+    if (b->off) {
+        memmove(b->data, b->data + b->off, b->len - b->off);
+        b->len -= b->off;
+        b->off = 0;
+        if (b->cap - b->len >= extra)
+            return 0;
+    }
+    size_t cap = b->cap ? b->cap : 4096;
+    while (cap - b->len < extra)
+        cap *= 2;
+    uint8_t *data = realloc(b->data, cap);
+    if (!data)
+        return -1;
+    b->data = data;
+    b->cap = cap;
+    return 0;
+}
+
+/*
+ * Drop n bytes from the front of a buffer
+ */
+void byte_buf_consume(struct byte_buf *b, size_t n)
+{
+    b->off += n;
+    if (b->off >= b->len)
+        b->off = b->len = 0;
+}
+
+/*
+ * Free a buffer's storage and reset it to empty
+ */
+void byte_buf_free(struct byte_buf *b)
+{
+    free(b->data);
+    memset(b, 0, sizeof *b);
+}
+
+/*
+ * Append a complete frame to a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int oracle_append_frame(struct byte_buf *b, uint8_t code, uint32_t tag,
+        const uint8_t *payload, size_t len)
+{
+    if (len > ORACLE_MAX_FRAME - ORACLE_FRAME_HEADER)
+        return -1;
+    if (byte_buf_reserve(b, ORACLE_FRAME_HEADER + len) != 0)
+        return -1;
+    uint8_t *p = b->data + b->len;
+    oracle_put_u32(p, (uint32_t) (len + ORACLE_FRAME_HEADER - 4));
+    p[4] = code;
+    oracle_put_u32(p + 5, tag);
+    if (len)
+        memcpy(p + ORACLE_FRAME_HEADER, payload, len);
+    b->len += ORACLE_FRAME_HEADER + len;
+    return 0;
+}
+
+/*
+ * Append one entry to the payload of a batch being built in a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int oracle_append_entry(struct byte_buf *b, uint8_t code,
+        const uint8_t *payload, size_t len)
+{
+    if (len > ORACLE_MAX_FRAME)
+        return -1;
+    if (byte_buf_reserve(b, ORACLE_ENTRY_HEADER + len) != 0)
+        return -1;
+    uint8_t *p = b->data + b->len;
+    oracle_put_u32(p, (uint32_t) (len + 1));
+    p[4] = code;
+    if (len)
+        memcpy(p + ORACLE_ENTRY_HEADER, payload, len);
+    b->len += ORACLE_ENTRY_HEADER + len;
+    return 0;
+}
+
+/*
+ * Parse one frame from the front of a buffer
+ * @param src start of the data
+ * @param len number of bytes available
+ * @param out pointer to frame to fill in
+ * @return number of bytes the frame occupies, 0 if more data is needed, or
+ *         SIZE_MAX if the data is malformed
+ */
+size_t oracle_parse_frame(const uint8_t *src, size_t len,
+        struct oracle_frame *out)
+{
+    if (len < 4)
+        return 0;
+    uint32_t frame_len = oracle_get_u32(src);
+    if (frame_len < ORACLE_FRAME_HEADER - 4 || frame_len > ORACLE_MAX_FRAME)
+        return SIZE_MAX;
+    if (len - 4 < frame_len)
+        return 0;
+    out->code = src[4];
+    out->tag = oracle_get_u32(src + 5);
+    out->payload = src + ORACLE_FRAME_HEADER;
+    out->len = frame_len - (ORACLE_FRAME_HEADER - 4);
+    return 4 + (size_t) frame_len;
+}
+
+/*
+ * Parse the next entry of a batch payload
+ * @param payload batch payload, after the count
+ * @param len remaining length of the batch payload
+ * @param out pointer to frame to fill in; the tag is left as 0
+ * @return number of bytes the entry occupies, or SIZE_MAX if it is truncated
+ */
+size_t oracle_parse_entry(const uint8_t *payload, size_t len,
+        struct oracle_frame *out)
+{
+    if (len < ORACLE_ENTRY_HEADER)
+        return SIZE_MAX;
+    uint32_t entry_len = oracle_get_u32(payload);
+    if (entry_len < 1 || len - 4 < entry_len)
+        return SIZE_MAX;
+    out->code = payload[4];
+    out->tag = 0;
+    out->payload = payload + ORACLE_ENTRY_HEADER;
+    out->len = entry_len - 1;
+    return 4 + (size_t) entry_len;
+}
+
+/*
+ * Read a big-endian u32
+ */
+uint32_t oracle_get_u32(const uint8_t *src)
+{
+    return ((uint32_t) src[0] << 24) | ((uint32_t) src[1] << 16) |
+        ((uint32_t) src[2] << 8) | (uint32_t) src[3];
+}
+
+/*
+ * Write a big-endian u32
+ */
+void oracle_put_u32(uint8_t *dest, uint32_t x)
+{
+    dest[0] = (uint8_t) (x >> 24);
+    dest[1] = (uint8_t) (x >> 16);
+    dest[2] = (uint8_t) (x >> 8);
+    dest[3] = (uint8_t) x;
+}
@@ -0,0 +1,114 @@
+/*
+ * oracle_proto.h
+ * Wire format shared by the local oracle server and its client library.
+ *
+ * Every message is a frame:
+ *     u32 length | u8 code | u32 tag | payload
+ * where length counts everything after the length field, integers are
+ * big-endian, code is an ORACLE_OP_* value in a request and an ORACLE_STATUS_*
+ * value in a response, and the response to a request carries the same tag.
+ *
+ * An ORACLE_OP_BATCH request packs many queries into one frame:
+ *     u32 count | count * (u32 length | u8 op | payload)
+ * and is answered by one frame whose payload packs the answers the same way,
+ * with a status in place of each op.
+ */
+
+#ifndef ___oracle_proto_h___
+#define ___oracle_proto_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ORACLE_FRAME_HEADER 9       // length, code and tag
+#define ORACLE_ENTRY_HEADER 5       // length and code of one batch entry
+#define ORACLE_MAX_FRAME (16u << 20)
+
+// Requests
+#define ORACLE_OP_ENCRYPT 1         // payload: plaintext
+                                    // answer: E_ecb(prefix || pt || secret)
+#define ORACLE_OP_DECRYPT 2         // payload: iv || cbc ciphertext
+                                    // answer: plaintext, padding removed
+#define ORACLE_OP_PADDING_CHECK 3   // payload: iv || cbc ciphertext
+                                    // answer: one byte, 1 if padding is valid
+#define ORACLE_OP_BATCH 4           // payload: packed queries, see above
+
+// Response statuses
+#define ORACLE_STATUS_OK 0
+#define ORACLE_STATUS_BAD_REQUEST 1
+#define ORACLE_STATUS_BAD_PADDING 2
+
+// A growable byte buffer with a read offset
+struct byte_buf {
+    uint8_t *data;
+    size_t off;     // start of unconsumed data
+    size_t len;     // end of data
+    size_t cap;
+};
+
+// A frame or batch entry parsed in place; payload points into the source
+struct oracle_frame {
+    uint8_t code;
+    uint32_t tag;
+    const uint8_t *payload;
+    size_t len;
+};
+
+/*
+ * Make room for at least extra more bytes at the end of a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int byte_buf_reserve(struct byte_buf *b, size_t extra);
+
+/*
+ * Drop n bytes from the front of a buffer
+ */
+void byte_buf_consume(struct byte_buf *b, size_t n);
+
+/*
+ * Free a buffer's storage and reset it to empty
+ */
+void byte_buf_free(struct byte_buf *b);
+
+/*
+ * Append a complete frame to a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int oracle_append_frame(struct byte_buf *b, uint8_t code, uint32_t tag,
+        const uint8_t *payload, size_t len);
+
+/*
+ * Append one entry to the payload of a batch being built in a buffer
+ * @return 0 on success, -1 on allocation failure
+ */
+int oracle_append_entry(struct byte_buf *b, uint8_t code,
+        const uint8_t *payload, size_t len);
+
+/*
+ * Parse one frame from the front of a buffer
+ * @param src start of the data
+ * @param len number of bytes available
+ * @param out pointer to frame to fill in
+ * @return number of bytes the frame occupies, 0 if more data is needed, or
+ *         SIZE_MAX if the data is malformed
+ */
+size_t oracle_parse_frame(const uint8_t *src, size_t len,
+        struct oracle_frame *out);
+
+/*
+ * Parse the next entry of a batch payload
+ * @param payload batch payload, after the count
+ * @param len remaining length of the batch payload
+ * @param out pointer to frame to fill in; the tag is left as 0
+ * @return number of bytes the entry occupies, or SIZE_MAX if it is truncated
+ */
+size_t oracle_parse_entry(const uint8_t *payload, size_t len,
+        struct oracle_frame *out);
+
+/*
+ * Read and write big-endian u32s
+ */
+uint32_t oracle_get_u32(const uint8_t *src);
+void oracle_put_u32(uint8_t *dest, uint32_t x);
+
+#endif  // ___oracle_proto_h___
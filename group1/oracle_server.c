@@ -0,0 +1,465 @@
+/*
+ * oracle_server.c
+ * A local stand-in for a remote encryption/decryption oracle. Listens on a
+ * UNIX-domain socket and answers ecb encryption, cbc decryption and cbc
+ * padding-check queries under a fixed secret key, using the framing in
+ * oracle_proto.h. A single thread serves every connection from an epoll loop;
+ * requests on one connection are answered in order.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "oracle_server.h"
+#include "oracle_proto.h"
+#include "ecb_attack.h"
+
+#define MAX_EVENTS 64
+#define READ_CHUNK 65536
+// Most unparsed input held for a connection: one frame of the largest size
+// oracle_parse_frame accepts
+#define MAX_INPUT (4 + (size_t) ORACLE_MAX_FRAME)
+
+struct connection {
+    struct connection *prev;
+    struct connection *next;
+    int fd;
+    int want_out;           // EPOLLOUT is registered
+    struct byte_buf in;
+    struct byte_buf out;
+};
+
+struct oracle_server {
+    int listen_fd;
+    int epoll_fd;
+    int wake_fd;
+    char *path;
+    struct connection *connections;
+    struct aes_ecb_oracle ecb;      // ORACLE_OP_ENCRYPT
+    struct aes128_schedule ks;      // cbc queries
+    struct byte_buf answer;         // scratch for one answer
+    struct byte_buf batch;          // scratch for a batch of answers
+};
+
+// Private functions
+static int remove_stale_socket(const char *path);
+static int set_nonblocking(int fd);
+static void accept_connections(struct oracle_server *s);
+static void close_connection(struct oracle_server *s, struct connection *c);
+static int read_requests(struct oracle_server *s, struct connection *c);
+static int flush_responses(struct oracle_server *s, struct connection *c);
+static int handle_frame(struct oracle_server *s, struct connection *c,
+        const struct oracle_frame *req);
+static uint8_t answer_query(struct oracle_server *s, uint8_t op,
+        const uint8_t *payload, size_t len);
+static uint8_t answer_batch(struct oracle_server *s, const uint8_t *payload,
+        size_t len);
+static uint8_t cbc_decrypt_query(struct oracle_server *s,
+        const uint8_t *payload, size_t len, size_t *plain_len);
+
+/*
+ * Create a server listening on a UNIX-domain socket. Any stale socket file at
+ * path is replaced; any other file there is left alone, and creation fails
+ * with errno set to EADDRINUSE.
+ * @param path filesystem path of the socket
+ * @param config key and ecb framing to serve
+ * @return the server, or NULL on failure
+ */
+struct oracle_server *oracle_server_create(const char *path,
+        const struct oracle_server_config *config)
+{
+    if (!path || !config)
+        return NULL;
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof addr.sun_path || remove_stale_socket(path) != 0)
+        return NULL;
+    struct oracle_server *s = calloc(1, sizeof *s);
+    if (!s)
+        return NULL;
+    s->listen_fd = s->epoll_fd = s->wake_fd = -1;
+    char *owned_path = strdup(path);
+    aes_ecb_oracle_init(&s->ecb, config->key, config->prefix,
+            config->prefix_len, config->secret, config->secret_len);
+    aes128_expand_key(&s->ks, config->key);
+
+    memset(&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    s->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    s->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (!owned_path || s->listen_fd < 0 || s->epoll_fd < 0 ||
+            s->wake_fd < 0 ||
+            bind(s->listen_fd, (struct sockaddr *) &addr, sizeof addr) != 0) {
+        free(owned_path);
+        oracle_server_destroy(s);
+        return NULL;
+    }
+    // the socket file is ours to remove from here on
+    s->path = owned_path;
+    if (listen(s->listen_fd, 128) != 0 ||
+            set_nonblocking(s->listen_fd) != 0) {
+        oracle_server_destroy(s);
+        return NULL;
+    }
+    // the listening socket is tagged with the server, the wakeup fd with
+    // the wakeup fd itself, and everything else with its connection
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = s };
+    struct epoll_event wake = { .events = EPOLLIN, .data.ptr = &s->wake_fd };
+    if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, s->listen_fd, &ev) != 0 ||
+            epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, s->wake_fd, &wake) != 0) {
+        oracle_server_destroy(s);
+        return NULL;
+    }
+    return s;
+}
+
+/*
+ * Serve queries until oracle_server_stop is called
+ * @return 0 once stopped, -1 on an unrecoverable error
+ */
+int oracle_server_run(struct oracle_server *s)
+{
+    if (!s)
+        return -1;
+    struct epoll_event events[MAX_EVENTS];
+    for (;;) {
+        int n = epoll_wait(s->epoll_fd, events, MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        for (int i = 0; i < n; ++i) {
+            void *tag = events[i].data.ptr;
+            if (tag == &s->wake_fd) {
+                uint64_t count;
+                while (read(s->wake_fd, &count, sizeof count) > 0)
+                    continue;
+                return 0;
+            }
+            if (tag == s) {
+                accept_connections(s);
+                continue;
+            }
+            struct connection *c = tag;
+            int ok = 0;
+            uint32_t readable = EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR;
+            if (events[i].events & readable)
+                ok = read_requests(s, c);
+            if (ok == 0 && (events[i].events & EPOLLOUT))
+                ok = flush_responses(s, c);
+            if (ok != 0)
+                close_connection(s, c);
+        }
+    }
+}
+
+/*
+ * Ask a running server to return from oracle_server_run. Safe to call from
+ * another thread or a signal handler.
+ */
+void oracle_server_stop(struct oracle_server *s)
+{
+    if (!s)
+        return;
+    uint64_t one = 1;
+    while (write(s->wake_fd, &one, sizeof one) < 0 && errno == EINTR)
+        continue;
+}
+
+/*
+ * Close all connections, remove the socket file and free the server
+ * @param server server to free; must not be running
+ */
+void oracle_server_destroy(struct oracle_server *s)
+{
+    if (!s)
+        return;
+    while (s->connections)
+        close_connection(s, s->connections);
+    if (s->epoll_fd >= 0)
+        close(s->epoll_fd);
+    if (s->listen_fd >= 0)
+        close(s->listen_fd);
+    if (s->wake_fd >= 0)
+        close(s->wake_fd);
+    if (s->path)
+        unlink(s->path);
+    free(s->path);
+    byte_buf_free(&s->answer);
+    byte_buf_free(&s->batch);
+    free(s);
+}
+
+/*
+ * Remove a socket file left behind by an earlier server
+ * @return 0 if path is now free, or -1 with errno set to EADDRINUSE if
+ *         something other than a socket is there
+ */
+static int remove_stale_socket(const char *path)
+{
+    struct stat st;
+    if (lstat(path, &st) != 0)
+        return errno == ENOENT ? 0 : -1;
+    if (!S_ISSOCK(st.st_mode)) {
+        errno = EADDRINUSE;
+        return -1;
+    }
+    return unlink(path) == 0 || errno == ENOENT ? 0 : -1;
+}
+
+/*
+ * Put a file descriptor in non-blocking mode
+ * @return 0 on success, -1 on failure
+ */
+static int set_nonblocking(int fd)
+{
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags < 0)
+        return -1;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+/*
+ * Accept every pending connection and register it with epoll
+ */
+static void accept_connections(struct oracle_server *s)
+{
+    for (;;) {
+        int fd = accept4(s->listen_fd, NULL, NULL,
+                SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+            return;
+        struct connection *c = calloc(1, sizeof *c);
+        struct epoll_event ev = { .events = EPOLLIN | EPOLLRDHUP };
+        ev.data.ptr = c;
+        if (!c || epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        c->next = s->connections;
+        if (s->connections)
+            s->connections->prev = c;
+        s->connections = c;
+    }
+}
+
+/*
+ * Unregister, close and free a connection
+ */
+static void close_connection(struct oracle_server *s, struct connection *c)
+{
+    if (c->prev)
+        c->prev->next = c->next;
+    else
+        s->connections = c->next;
+    if (c->next)
+        c->next->prev = c->prev;
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    byte_buf_free(&c->in);
+    byte_buf_free(&c->out);
+    free(c);
+}
+
+/*
+ * Read what is available on a connection, up to MAX_INPUT bytes of unparsed
+ * input, and answer every complete frame. Anything left over is read on the
+ * next wakeup, as epoll still reports the connection readable.
+ * @return 0 to keep the connection, -1 to close it
+ */
+static int read_requests(struct oracle_server *s, struct connection *c)
+{
+    int eof = 0;
+    while (c->in.len - c->in.off < MAX_INPUT) {
+        size_t room = MAX_INPUT - (c->in.len - c->in.off);
+        size_t want = room < READ_CHUNK ? room : READ_CHUNK;
+        if (byte_buf_reserve(&c->in, want) != 0)
+            return -1;
+        ssize_t n = read(c->fd, c->in.data + c->in.len, want);
+        if (n > 0) {
+            c->in.len += (size_t) n;
+            continue;
+        }
+        if (n == 0)
+            eof = 1;
+        else if (errno == EINTR)
+            continue;
+        else if (errno != EAGAIN && errno != EWOULDBLOCK)
+            return -1;
+        break;
+    }
+    for (;;) {
+        struct oracle_frame req;
+        size_t used = oracle_parse_frame(c->in.data + c->in.off,
+                c->in.len - c->in.off, &req);
+        if (used == SIZE_MAX)
+            return -1;
+        if (used == 0)
+            break;
+        if (handle_frame(s, c, &req) != 0)
+            return -1;
+        byte_buf_consume(&c->in, used);
+    }
+    // a frame that doesn't fit in MAX_INPUT would never complete
+    if (c->in.len - c->in.off >= MAX_INPUT)
+        return -1;
+    if (flush_responses(s, c) != 0)
+        return -1;
+    // let the peer half-close once it has everything it asked for
+    return eof && c->out.len == c->out.off ? -1 : 0;
+}
+
+/*
+ * Write as much pending output as the socket will take, and watch for
+ * writability only while some is left over. A peer that has gone away closes
+ * the connection rather than raising SIGPIPE in the embedding process.
+ * @return 0 to keep the connection, -1 to close it
+ */
+static int flush_responses(struct oracle_server *s, struct connection *c)
+{
+    while (c->out.off < c->out.len) {
+        ssize_t n = send(c->fd, c->out.data + c->out.off,
+                c->out.len - c->out.off, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n > 0) {
+            byte_buf_consume(&c->out, (size_t) n);
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        return -1;
+    }
+    int want_out = c->out.off < c->out.len;
+    if (want_out != c->want_out) {
+        struct epoll_event ev = { .events = EPOLLIN | EPOLLRDHUP };
+        if (want_out)
+            ev.events |= EPOLLOUT;
+        ev.data.ptr = c;
+        if (epoll_ctl(s->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev) != 0)
+            return -1;
+        c->want_out = want_out;
+    }
+    return 0;
+}
+
+/*
+ * Answer one request frame, queueing the response on the connection
+ * @return 0 on success, -1 on allocation failure
+ */
+static int handle_frame(struct oracle_server *s, struct connection *c,
+        const struct oracle_frame *req)
+{
+    if (req->code == ORACLE_OP_BATCH) {
+        uint8_t status = answer_batch(s, req->payload, req->len);
+        return oracle_append_frame(&c->out, status, req->tag,
+                s->batch.data, status == ORACLE_STATUS_OK ? s->batch.len : 0);
+    }
+    uint8_t status = answer_query(s, req->code, req->payload, req->len);
+    return oracle_append_frame(&c->out, status, req->tag, s->answer.data,
+            s->answer.len);
+}
+
+/*
+ * Answer a single (non-batch) query into the answer scratch buffer
+ * @return ORACLE_STATUS_* for the query
+ */
+static uint8_t answer_query(struct oracle_server *s, uint8_t op,
+        const uint8_t *payload, size_t len)
+{
+    struct byte_buf *a = &s->answer;
+    a->off = a->len = 0;
+    switch (op) {
+    case ORACLE_OP_ENCRYPT: {
+        size_t ct_len = aes_ecb_oracle_encrypt(&s->ecb, payload, len, NULL, 0);
+        if (byte_buf_reserve(a, ct_len) != 0)
+            return ORACLE_STATUS_BAD_REQUEST;
+        a->len = aes_ecb_oracle_encrypt(&s->ecb, payload, len, a->data,
+                a->cap);
+        return ORACLE_STATUS_OK;
+    }
+    case ORACLE_OP_DECRYPT: {
+        size_t plain_len;
+        uint8_t status = cbc_decrypt_query(s, payload, len, &plain_len);
+        a->len = status == ORACLE_STATUS_OK ? plain_len : 0;
+        return status;
+    }
+    case ORACLE_OP_PADDING_CHECK: {
+        size_t plain_len;
+        uint8_t status = cbc_decrypt_query(s, payload, len, &plain_len);
+        if (status == ORACLE_STATUS_BAD_REQUEST)
+            return status;
+        a->data[0] = status == ORACLE_STATUS_OK;
+        a->len = 1;
+        return ORACLE_STATUS_OK;
+    }
+    default:
+        return ORACLE_STATUS_BAD_REQUEST;
+    }
+}
+
+/*
+ * Answer every query of a batch into the batch scratch buffer
+ * @return ORACLE_STATUS_OK, or ORACLE_STATUS_BAD_REQUEST if the batch itself
+ *         is malformed
+ */
+static uint8_t answer_batch(struct oracle_server *s, const uint8_t *payload,
+        size_t len)
+{
+    struct byte_buf *b = &s->batch;
+    b->off = b->len = 0;
+    if (len < 4 || byte_buf_reserve(b, 4) != 0)
+        return ORACLE_STATUS_BAD_REQUEST;
+    uint32_t count = oracle_get_u32(payload);
+    oracle_put_u32(b->data, count);
+    b->len = 4;
+    size_t pos = 4;
+    for (uint32_t i = 0; i < count; ++i) {
+        struct oracle_frame q;
+        size_t used = oracle_parse_entry(payload + pos, len - pos, &q);
+        if (used == SIZE_MAX || q.code == ORACLE_OP_BATCH)
+            return ORACLE_STATUS_BAD_REQUEST;
+        uint8_t status = answer_query(s, q.code, q.payload, q.len);
+        if (oracle_append_entry(b, status, s->answer.data, s->answer.len) != 0)
+            return ORACLE_STATUS_BAD_REQUEST;
+        pos += used;
+    }
+    return ORACLE_STATUS_OK;
+}
+
+/*
+ * Decrypt an iv || ciphertext payload with cbc into the answer scratch buffer
+ * and strip its padding
+ * @param plain_len output for the length of the unpadded plaintext
+ * @return ORACLE_STATUS_OK, ORACLE_STATUS_BAD_PADDING, or
+ *         ORACLE_STATUS_BAD_REQUEST if the payload is not whole blocks
+ */
+static uint8_t cbc_decrypt_query(struct oracle_server *s,
+        const uint8_t *payload, size_t len, size_t *plain_len)
+{
+    if (len < 2 * AES_BLOCK_SIZE || len % AES_BLOCK_SIZE != 0)
+        return ORACLE_STATUS_BAD_REQUEST;
+    size_t ct_len = len - AES_BLOCK_SIZE;
+    if (byte_buf_reserve(&s->answer, ct_len) != 0)
+        return ORACLE_STATUS_BAD_REQUEST;
+    aes128_cbc_decrypt(&s->ks, payload, payload + AES_BLOCK_SIZE,
+            s->answer.data, ct_len);
+    *plain_len = pkcs7_unpad(s->answer.data, ct_len, AES_BLOCK_SIZE);
+    if (*plain_len == SIZE_MAX)
+        return ORACLE_STATUS_BAD_PADDING;
+    return ORACLE_STATUS_OK;
+}
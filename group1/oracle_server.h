@@ -0,0 +1,59 @@
+/*
+ * oracle_server.h
+ * A local stand-in for a remote encryption/decryption oracle. Listens on a
+ * UNIX-domain socket and answers ecb encryption, cbc decryption and cbc
+ * padding-check queries under a fixed secret key, using the framing in
+ * oracle_proto.h. A single thread serves every connection from an epoll loop;
+ * requests on one connection are answered in order.
+ */
+
+#ifndef ___oracle_server_h___
+#define ___oracle_server_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cipher.h"
+
+struct oracle_server;
+
+struct oracle_server_config {
+    uint8_t key[AES128_KEY_SIZE];
+    // bytes wrapped around the plaintext of ORACLE_OP_ENCRYPT queries; not
+    // copied, so they must outlive the server
+    const uint8_t *prefix;
+    size_t prefix_len;
+    const uint8_t *secret;
+    size_t secret_len;
+};
+
+/*
+ * Create a server listening on a UNIX-domain socket. Any stale socket file at
+ * path is replaced; any other file there is left alone, and creation fails
+ * with errno set to EADDRINUSE.
+ * @param path filesystem path of the socket
+ * @param config key and ecb framing to serve
+ * @return the server, or NULL on failure
+ */
+struct oracle_server *oracle_server_create(const char *path,
+        const struct oracle_server_config *config);
+
+/*
+ * Serve queries until oracle_server_stop is called
+ * @return 0 once stopped, -1 on an unrecoverable error
+ */
+int oracle_server_run(struct oracle_server *server);
+
+/*
+ * Ask a running server to return from oracle_server_run. Safe to call from
+ * another thread or a signal handler.
+ */
+void oracle_server_stop(struct oracle_server *server);
+
+/*
+ * Close all connections, remove the socket file and free the server
+ * @param server server to free; must not be running
+ */
+void oracle_server_destroy(struct oracle_server *server);
+
+#endif  // ___oracle_server_h___
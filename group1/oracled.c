@@ -0,0 +1,113 @@
+/*
+ * oracled.c
+ * Runs the local oracle server as a standalone daemon.
+ *
+ * usage: oracled <socket path> <32 hex digit key> [secret file [prefix file]]
+ *
+ * The secret and prefix files are read as raw bytes and wrapped around the
+ * plaintext of every encryption query. The server exits cleanly on SIGINT or
+ * SIGTERM.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+
+#include "convert.h"
+#include "oracle_server.h"
+
+static struct oracle_server *server;
+
+// Private functions
+static void handle_stop(int sig);
+static uint8_t *read_file(const char *path, size_t *len);
+
+int main(int argc, char **argv)
+{
+    if (argc < 3 || argc > 5 || strlen(argv[2]) != 2 * AES128_KEY_SIZE) {
+        fprintf(stderr, "usage: %s <socket> <32 hex digit key> "
+                "[secret file [prefix file]]\n", argv[0]);
+        return 2;
+    }
+    struct oracle_server_config config;
+    memset(&config, 0, sizeof config);
+    read_base16(config.key, argv[2], 2 * AES128_KEY_SIZE);
+    uint8_t *secret = NULL;
+    uint8_t *prefix = NULL;
+    if (argc > 3 && !(secret = read_file(argv[3], &config.secret_len))) {
+        perror(argv[3]);
+        return 1;
+    }
+    if (argc > 4 && !(prefix = read_file(argv[4], &config.prefix_len))) {
+        perror(argv[4]);
+        free(secret);
+        return 1;
+    }
+    config.secret = secret;
+    config.prefix = prefix;
+
+    server = oracle_server_create(argv[1], &config);
+    if (!server) {
+        fprintf(stderr, "%s: cannot listen on %s\n", argv[0], argv[1]);
+        free(secret);
+        free(prefix);
+        return 1;
+    }
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = handle_stop;
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    int status = oracle_server_run(server);
+    oracle_server_destroy(server);
+    free(secret);
+    free(prefix);
+    return status == 0 ? 0 : 1;
+}
+
+/*
+ * SIGINT/SIGTERM handler
+ */
+static void handle_stop(int sig)
+{
+    (void) sig;
+    oracle_server_stop(server);
+}
+
+/*
+ * Read a whole file into a malloc'd buffer
+ * @param len output for the file's length
+ * @return the contents, or NULL on failure
+ */
+static uint8_t *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return NULL;
+    size_t cap = 4096;
+    size_t n = 0;
+    uint8_t *data = malloc(cap);
+    while (data) {
+        n += fread(data + n, 1, cap - n, f);
+        if (n < cap)
+            break;
+        uint8_t *grown = realloc(data, 2 * cap);
+        if (!grown)
+            free(data);
+        data = grown;
+        cap *= 2;
+    }
+    if (data && ferror(f)) {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *len = n;
+    return data;
+}
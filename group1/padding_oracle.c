@@ -0,0 +1,327 @@
+/*
+ * padding_oracle.c
+ * Decryption of cbc ciphertexts through a padding oracle. Each block is
+ * recovered on its own from the block before it, so blocks are shared out
+ * over the thread pool; within a block, bytes are recovered last to first
+ * with guesses batched into few oracle calls, pipelined when the oracle can
+ * take several at once, and ordered by how likely each plaintext byte is.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "padding_oracle.h"
+#include "arena.h"
+#include "text_score.h"
+#include "thread_pool.h"
+
+// State shared by the workers of one attack
+struct attack {
+    const struct padding_oracle *oracle;
+    const uint8_t *iv;
+    const uint8_t *src;
+    uint8_t *dest;
+    size_t num_blocks;
+    size_t batch_size;
+    size_t depth;                   // batches per round trip
+    uint8_t order[256];             // guesses, most likely first
+    int failed;                     // set atomically once a block fails
+    pthread_mutex_t lock;           // guards stats
+    struct padding_attack_stats stats;
+};
+
+// Private functions
+static void attack_blocks(void *arg, size_t begin, size_t end);
+static int recover_block(struct attack *a, size_t block, uint8_t *queries,
+        uint8_t *valid, struct padding_attack_stats *stats);
+static int ask_oracle(const struct attack *a, const uint8_t *queries,
+        size_t num, uint8_t *valid, struct padding_attack_stats *stats);
+static void order_guesses(const struct attack *a, size_t block, size_t pos,
+        const uint8_t *plain, uint8_t *guesses);
+static int confirm_last_byte(struct attack *a, uint8_t *query,
+        struct padding_attack_stats *stats);
+
+/*
+ * Set up an in-process aes padding oracle
+ * @param o oracle to initialize
+ * @param key raw AES-128 key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ */
+void aes_cbc_padding_oracle_init(struct aes_cbc_padding_oracle *o,
+        const uint8_t *key)
+{
+    if (!o || !key)
+        return;
+    aes128_expand_key(&o->ks, key);
+}
+
+/*
+ * padding_oracle_fn for an aes_cbc_padding_oracle, passed as ctx
+ */
+int aes_cbc_padding_oracle_check(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid)
+{
+    struct aes_cbc_padding_oracle *o = ctx;
+    if (!o || !queries || !valid)
+        return -1;
+    for (size_t i = 0; i < num; ++i) {
+        const uint8_t *q = queries + i * PADDING_QUERY_SIZE;
+        uint8_t plain[AES_BLOCK_SIZE];
+        aes128_cbc_decrypt(&o->ks, q, q + AES_BLOCK_SIZE, plain,
+                AES_BLOCK_SIZE);
+        valid[i] = pkcs7_unpad(plain, AES_BLOCK_SIZE, AES_BLOCK_SIZE) !=
+            SIZE_MAX;
+    }
+    return 0;
+}
+
+/*
+ * Decrypt a cbc ciphertext one byte at a time through a padding oracle.
+ * Blocks are independent, so they are shared out among the threads of the
+ * default thread pool. For each byte, guesses are tried in order of how
+ * likely the plaintext byte is in english text, batch_size at a time, until
+ * the oracle accepts one. An oracle with submit and wait gets depth batches
+ * at a time, all in flight before the first answer is needed.
+ * @param oracle oracle to attack
+ * @param iv iv the ciphertext was encrypted with
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src ciphertext to decrypt
+ * @param dest buffer to write the plaintext to, padding removed
+ *        precondition: length of dest buffer >= len
+ * @param len length of the ciphertext; must be a non-zero multiple of
+ *        AES_BLOCK_SIZE
+ * @param workers most threads to use, including the caller; 0 or 1 runs on
+ *        the calling thread
+ * @param batch_size number of guesses per oracle call; 0 means
+ *        PADDING_DEFAULT_BATCH
+ * @param stats pointer to stats struct to fill in; may be NULL
+ * @return length of the unpadded plaintext, or SIZE_MAX if the oracle failed
+ *         or the recovered plaintext is not validly padded
+ */
+size_t cbc_padding_oracle_decrypt(const struct padding_oracle *oracle,
+        const uint8_t *iv, const uint8_t *src, uint8_t *dest, size_t len,
+        size_t workers, size_t batch_size,
+        struct padding_attack_stats *stats)
+{
+    if (!oracle || !oracle->check || !iv || !src || !dest || len == 0 ||
+            len % AES_BLOCK_SIZE != 0)
+        return SIZE_MAX;
+    struct attack a;
+    memset(&a, 0, sizeof a);
+    a.oracle = oracle;
+    a.iv = iv;
+    a.src = src;
+    a.dest = dest;
+    a.num_blocks = len / AES_BLOCK_SIZE;
+    a.batch_size = batch_size ? batch_size : PADDING_DEFAULT_BATCH;
+    if (a.batch_size > 256)
+        a.batch_size = 256;
+    a.depth = 1;
+    if (oracle->submit && oracle->wait)
+        a.depth = oracle->depth ? oracle->depth : PADDING_DEFAULT_DEPTH;
+    // no more batches than it takes to try every guess
+    if (a.depth > (256 + a.batch_size - 1) / a.batch_size)
+        a.depth = (256 + a.batch_size - 1) / a.batch_size;
+    rank_english_bytes(a.order);
+    if (pthread_mutex_init(&a.lock, NULL) != 0)
+        return SIZE_MAX;
+    thread_pool_parallel_for(NULL, 0, a.num_blocks, 1,
+            workers > 1 ? workers : 1, attack_blocks, &a);
+    pthread_mutex_destroy(&a.lock);
+
+    a.stats.blocks = a.num_blocks;
+    a.stats.bytes = len;
+    a.stats.queries_per_byte = (double) a.stats.oracle_queries / len;
+    if (stats)
+        *stats = a.stats;
+    if (a.failed)
+        return SIZE_MAX;
+    return pkcs7_unpad(dest, len, AES_BLOCK_SIZE);
+}
+
+/*
+ * Recover a range of blocks, stopping early once any block has failed, then
+ * merge the range's stats into the attack's
+ * @param arg the attack
+ */
+static void attack_blocks(void *arg, size_t begin, size_t end)
+{
+    struct attack *a = arg;
+    struct padding_attack_stats local;
+    memset(&local, 0, sizeof local);
+    size_t guesses = a->depth * a->batch_size;
+    struct arena *arena = arena_thread();
+    struct arena_mark mark;
+    uint8_t *queries = NULL;
+    uint8_t *valid = NULL;
+    if (arena) {
+        mark = arena_get_mark(arena);
+        queries = arena_alloc(arena, guesses * PADDING_QUERY_SIZE);
+        valid = arena_alloc(arena, guesses);
+    }
+    int failed = !queries || !valid;
+    for (size_t block = begin; block < end && !failed; ++block) {
+        if (__atomic_load_n(&a->failed, __ATOMIC_RELAXED))
+            break;
+        failed = recover_block(a, block, queries, valid, &local) != 0;
+    }
+    if (arena)
+        arena_reset(arena, mark);
+
+    pthread_mutex_lock(&a->lock);
+    if (failed)
+        __atomic_store_n(&a->failed, 1, __ATOMIC_RELAXED);
+    a->stats.oracle_queries += local.oracle_queries;
+    a->stats.oracle_batches += local.oracle_batches;
+    if (local.max_byte_queries > a->stats.max_byte_queries)
+        a->stats.max_byte_queries = local.max_byte_queries;
+    pthread_mutex_unlock(&a->lock);
+}
+
+/*
+ * Recover one plaintext block. With D the block cipher decryption of the
+ * target block, the oracle accepts prev' || target exactly when
+ * D ^ prev' ends in valid padding. Once the bytes after pos are known,
+ * setting them to give padding pad = 16 - pos leaves only byte pos to guess:
+ * prev'[pos] = prev[pos] ^ guess ^ pad is accepted when guess is the
+ * plaintext byte.
+ * @param queries scratch space for depth * batch_size queries
+ * @param valid scratch space for depth * batch_size answers
+ * @return 0 on success, -1 if the oracle failed or accepted no guess
+ */
+static int recover_block(struct attack *a, size_t block, uint8_t *queries,
+        uint8_t *valid, struct padding_attack_stats *stats)
+{
+    const uint8_t *prev = block ? a->src + (block - 1) * AES_BLOCK_SIZE :
+        a->iv;
+    const uint8_t *target = a->src + block * AES_BLOCK_SIZE;
+    uint8_t *plain = a->dest + block * AES_BLOCK_SIZE;
+    uint8_t forged[AES_BLOCK_SIZE];
+    memcpy(forged, prev, AES_BLOCK_SIZE);
+
+    for (size_t pos = AES_BLOCK_SIZE; pos-- > 0;) {
+        uint8_t pad = (uint8_t) (AES_BLOCK_SIZE - pos);
+        for (size_t k = pos + 1; k < AES_BLOCK_SIZE; ++k)
+            forged[k] = prev[k] ^ plain[k] ^ pad;
+        uint8_t guesses[256];
+        order_guesses(a, block, pos, plain, guesses);
+
+        size_t byte_queries = 0;
+        size_t round = a->depth * a->batch_size;
+        int found = 0;
+        for (size_t i = 0; i < 256 && !found; i += round) {
+            size_t n = 256 - i < round ? 256 - i : round;
+            for (size_t j = 0; j < n; ++j) {
+                uint8_t *q = queries + j * PADDING_QUERY_SIZE;
+                memcpy(q, forged, AES_BLOCK_SIZE);
+                q[pos] = prev[pos] ^ guesses[i + j] ^ pad;
+                memcpy(q + AES_BLOCK_SIZE, target, AES_BLOCK_SIZE);
+            }
+            if (ask_oracle(a, queries, n, valid, stats) != 0)
+                return -1;
+            byte_queries += n;
+            for (size_t j = 0; j < n && !found; ++j) {
+                if (!valid[j])
+                    continue;
+                uint8_t *q = queries + j * PADDING_QUERY_SIZE;
+                int confirmed = 1;
+                if (pos == AES_BLOCK_SIZE - 1) {
+                    confirmed = confirm_last_byte(a, q, stats);
+                    if (confirmed < 0)
+                        return -1;
+                    ++byte_queries;
+                }
+                if (confirmed) {
+                    plain[pos] = guesses[i + j];
+                    found = 1;
+                }
+            }
+        }
+        stats->oracle_queries += byte_queries;
+        if (byte_queries > stats->max_byte_queries)
+            stats->max_byte_queries = byte_queries;
+        if (!found)
+            return -1;
+    }
+    return 0;
+}
+
+/*
+ * Ask the oracle about one round of queries: a single batch through check,
+ * or batch_size at a time through submit, with every batch sent before
+ * waiting for the answers
+ * @return 0 on success, -1 if the oracle failed
+ */
+static int ask_oracle(const struct attack *a, const uint8_t *queries,
+        size_t num, uint8_t *valid, struct padding_attack_stats *stats)
+{
+    const struct padding_oracle *o = a->oracle;
+    if (a->depth == 1 || !o->submit || !o->wait) {
+        ++stats->oracle_batches;
+        return o->check(o->ctx, queries, num, valid);
+    }
+    int status = 0;
+    for (size_t i = 0; i < num && status == 0; i += a->batch_size) {
+        size_t n = num - i < a->batch_size ? num - i : a->batch_size;
+        status = o->submit(o->ctx, queries + i * PADDING_QUERY_SIZE, n,
+                valid + i);
+        ++stats->oracle_batches;
+    }
+    // wait even after a failed submit, so no answer lands in valid later
+    if (o->wait(o->ctx) != 0)
+        status = -1;
+    return status;
+}
+
+/*
+ * Order the guesses for one plaintext byte. Bytes of the final block that can
+ * still be padding try the padding values first: any byte for the last
+ * position, and the already-known padding value for the bytes it covers.
+ * Everything else follows in english likelihood order.
+ * @param plain the block's plaintext, known after pos
+ * @param guesses output array; receives each of the 256 byte values once
+ */
+static void order_guesses(const struct attack *a, size_t block, size_t pos,
+        const uint8_t *plain, uint8_t *guesses)
+{
+    uint8_t taken[256] = { 0 };
+    size_t n = 0;
+    if (block == a->num_blocks - 1) {
+        uint8_t last = plain[AES_BLOCK_SIZE - 1];
+        if (pos == AES_BLOCK_SIZE - 1) {
+            for (uint8_t v = 1; v <= AES_BLOCK_SIZE; ++v)
+                guesses[n++] = v;
+        } else if (last >= 1 && last <= AES_BLOCK_SIZE &&
+                pos >= (size_t) (AES_BLOCK_SIZE - last)) {
+            guesses[n++] = last;
+        }
+    }
+    for (size_t i = 0; i < n; ++i)
+        taken[guesses[i]] = 1;
+    for (size_t i = 0; i < 256; ++i)
+        if (!taken[a->order[i]])
+            guesses[n++] = a->order[i];
+}
+
+/*
+ * An accepted guess for the last byte of a block may have produced 02 02 (or
+ * a longer padding) rather than 01. Changing the second-to-last byte tells
+ * the two apart: only a true 01 stays valid.
+ * @param query the accepted query; restored before returning
+ * @return 1 if the guess is confirmed, 0 if not, -1 if the oracle failed
+ */
+static int confirm_last_byte(struct attack *a, uint8_t *query,
+        struct padding_attack_stats *stats)
+{
+    uint8_t valid;
+    query[AES_BLOCK_SIZE - 2] ^= 0xff;
+    int status = a->oracle->check(a->oracle->ctx, query, 1, &valid);
+    query[AES_BLOCK_SIZE - 2] ^= 0xff;
+    ++stats->oracle_batches;
+    if (status != 0)
+        return -1;
+    return valid;
+}
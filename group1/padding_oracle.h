@@ -0,0 +1,107 @@
+/*
+ * padding_oracle.h
+ * Decryption of cbc ciphertexts through a padding oracle: a service that
+ * reveals only whether a submitted iv || ciphertext decrypts to validly
+ * PKCS#7-padded plaintext.
+ */
+
+#ifndef ___padding_oracle_h___
+#define ___padding_oracle_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "cipher.h"
+
+#define PADDING_QUERY_SIZE (2 * AES_BLOCK_SIZE)
+#define PADDING_DEFAULT_BATCH 16
+#define PADDING_DEFAULT_DEPTH 4
+
+/*
+ * A batch padding oracle. Each query is a PADDING_QUERY_SIZE-byte iv || block
+ * pair; valid[i] is set to 1 if query i has valid padding, 0 if not. Returns 0
+ * on success and -1 if the oracle could not be consulted. With more than one
+ * worker, the function is called concurrently from several threads.
+ */
+typedef int (*padding_oracle_fn)(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid);
+
+/*
+ * The asynchronous form of a batch padding oracle, for oracles with a round
+ * trip worth hiding. submit queues a batch as padding_oracle_fn describes and
+ * returns 0 once it is sent; valid is filled in by the time the next wait
+ * returns 0. wait returns -1 if any batch since the last wait failed.
+ */
+typedef int (*padding_submit_fn)(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid);
+typedef int (*padding_wait_fn)(void *ctx);
+
+struct padding_oracle {
+    padding_oracle_fn check;
+    void *ctx;
+    padding_submit_fn submit;       // optional, along with wait
+    padding_wait_fn wait;
+    size_t depth;                   // batches in flight per block when
+                                    // submitting; 0 means
+                                    // PADDING_DEFAULT_DEPTH
+};
+
+// What an attack cost
+struct padding_attack_stats {
+    size_t blocks;
+    size_t bytes;                   // bytes recovered, including padding
+    size_t oracle_queries;
+    size_t oracle_batches;
+    size_t max_byte_queries;        // most queries spent on a single byte
+    double queries_per_byte;
+};
+
+// In-process stand-in for a remote oracle: AES-128-CBC with PKCS#7 padding
+struct aes_cbc_padding_oracle {
+    struct aes128_schedule ks;
+};
+
+/*
+ * Set up an in-process aes padding oracle
+ * @param o oracle to initialize
+ * @param key raw AES-128 key
+ *        precondition: length of key buffer >= AES128_KEY_SIZE
+ */
+void aes_cbc_padding_oracle_init(struct aes_cbc_padding_oracle *o,
+        const uint8_t *key);
+
+/*
+ * padding_oracle_fn for an aes_cbc_padding_oracle, passed as ctx
+ */
+int aes_cbc_padding_oracle_check(void *ctx, const uint8_t *queries,
+        size_t num, uint8_t *valid);
+
+/*
+ * Decrypt a cbc ciphertext one byte at a time through a padding oracle.
+ * Blocks are independent, so they are shared out among the threads of the
+ * default thread pool. For each byte, guesses are tried in order of how
+ * likely the plaintext byte is in english text, batch_size at a time, until
+ * the oracle accepts one. An oracle with submit and wait gets depth batches
+ * at a time, all in flight before the first answer is needed.
+ * @param oracle oracle to attack
+ * @param iv iv the ciphertext was encrypted with
+ *        precondition: length of iv buffer >= AES_BLOCK_SIZE
+ * @param src ciphertext to decrypt
+ * @param dest buffer to write the plaintext to, padding removed
+ *        precondition: length of dest buffer >= len
+ * @param len length of the ciphertext; must be a non-zero multiple of
+ *        AES_BLOCK_SIZE
+ * @param workers most threads to use, including the caller; 0 or 1 runs on
+ *        the calling thread
+ * @param batch_size number of guesses per oracle call; 0 means
+ *        PADDING_DEFAULT_BATCH
+ * @param stats pointer to stats struct to fill in; may be NULL
+ * @return length of the unpadded plaintext, or SIZE_MAX if the oracle failed
+ *         or the recovered plaintext is not validly padded
+ */
+size_t cbc_padding_oracle_decrypt(const struct padding_oracle *oracle,
+        const uint8_t *iv, const uint8_t *src, uint8_t *dest, size_t len,
+        size_t workers, size_t batch_size,
+        struct padding_attack_stats *stats);
+
+#endif  // ___padding_oracle_h___
@@ -0,0 +1,78 @@
+/*
+ * probes.h
+ * Static tracepoints (USDT) for attaching perf, bpftrace or SystemTap to a
+ * running process. Each probe is a single nop in the code, plus a
+ * .note.stapsdt entry, in the format sys/sdt.h emits, that tells the tracer
+ * where the nop is and where to find the probe's arguments. Nothing is
+ * linked in at run time and no semaphore guards the probes, so their
+ * arguments should be cheap to compute.
+ *
+ * All probes use the "matasano" provider, and every argument is passed as a
+ * 64-bit unsigned integer. Functions have a NAME__entry probe and a
+ * NAME__return probe; see bpftrace/ for example scripts.
+ *
+ * Define MATASANO_NO_PROBES to compile them out. They are also left out on
+ * targets other than x86-64 with a GNU-compatible compiler.
+ */
+
+#ifndef ___probes_h___
+#define ___probes_h___
+
+#include <stdint.h>
+
+#if !defined(MATASANO_NO_PROBES) && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+
+#define MATASANO_PROBES_ENABLED 1
+
+// The note holds the probe address, the address of .stapsdt.base (which
+// lets tools detect a relocated binary), a semaphore address (none), then the
+// provider, name and argument strings. Arguments are described as
+// "SIZE@OPERAND", with the operand printed by the assembler.
+#define PROBE_ASM_(name, args) \
+    "990: nop\n" \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n" \
+    ".balign 4\n" \
+    ".4byte 992f-991f, 994f-993f, 3\n" \
+    "991: .asciz \"stapsdt\"\n" \
+    "992: .balign 4\n" \
+    "993: .8byte 990b\n" \
+    ".8byte _.stapsdt.base\n" \
+    ".8byte 0\n" \
+    ".asciz \"matasano\"\n" \
+    ".asciz \"" #name "\"\n" \
+    ".asciz \"" args "\"\n" \
+    "994: .balign 4\n" \
+    ".popsection\n" \
+    ".ifndef _.stapsdt.base\n" \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+    ".weak _.stapsdt.base\n" \
+    ".hidden _.stapsdt.base\n" \
+    "_.stapsdt.base: .space 1\n" \
+    ".size _.stapsdt.base, 1\n" \
+    ".popsection\n" \
+    ".endif\n"
+
+#define PROBE0(name) \
+    __asm__ __volatile__(PROBE_ASM_(name, ""))
+#define PROBE1(name, a1) \
+    __asm__ __volatile__(PROBE_ASM_(name, "8@%0") \
+            :: "nor" ((uint64_t) (a1)))
+#define PROBE2(name, a1, a2) \
+    __asm__ __volatile__(PROBE_ASM_(name, "8@%0 8@%1") \
+            :: "nor" ((uint64_t) (a1)), "nor" ((uint64_t) (a2)))
+#define PROBE3(name, a1, a2, a3) \
+    __asm__ __volatile__(PROBE_ASM_(name, "8@%0 8@%1 8@%2") \
+            :: "nor" ((uint64_t) (a1)), "nor" ((uint64_t) (a2)), \
+            "nor" ((uint64_t) (a3)))
+
+#else
+
+#define PROBE0(name) ((void) 0)
+#define PROBE1(name, a1) ((void) 0)
+#define PROBE2(name, a1, a2) ((void) 0)
+#define PROBE3(name, a1, a2, a3) ((void) 0)
+
+#endif
+
+#endif  // ___probes_h___
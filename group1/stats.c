@@ -0,0 +1,488 @@
+/*
+ * stats.c
+ * Per-function counters and timing histograms. Each thread records into its
+ * own block of counters, found through a thread-local pointer, so recording
+ * needs no locks or atomic read-modify-writes. The blocks are linked into a
+ * global list that snapshots walk under a lock; a thread's counters are
+ * folded into a retired total when it exits.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "stats.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+static const char *const fn_names[STATS_NUM_FNS] = {
+    "read_base16",
+    "read_base64",
+    "detect_repeated_byte_xor",
+    "break_repeated_key_xor",
+    "find_likely_key_size",
+    "is_ecb_encrypted",
+    "find_ecb_alignment",
+};
+
+#ifdef MATASANO_STATS
+
+// A thread's counters. Calls, bytes and keys live in hot, and are bumped
+// inline by STATS_SCOPE; the rest are only written on sampled calls.
+struct thread_stats {
+    struct stats_hot hot[STATS_NUM_FNS];
+    struct stats_totals fns[STATS_NUM_FNS];
+    struct thread_stats *next;
+};
+
+// initial-exec keeps the lookup to one instruction in the shared library
+__thread struct stats_hot *stats_thread_hot
+    __attribute__((tls_model("initial-exec")));
+static __thread struct thread_stats *local
+    __attribute__((tls_model("initial-exec")));
+static pthread_once_t init_once = PTHREAD_ONCE_INIT;
+static pthread_key_t exit_key;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static struct thread_stats *threads;            // live threads
+static struct stats_totals retired[STATS_NUM_FNS];  // exited threads
+static struct stats_totals baseline[STATS_NUM_FNS]; // totals at last reset
+static pthread_mutex_t signal_lock = PTHREAD_MUTEX_INITIALIZER;
+static int signal_pipe[2] = { -1, -1 };         // guarded by signal_lock
+static char *signal_path;
+
+// Private functions
+static void init(void);
+static struct thread_stats *thread_stats(void);
+static void retire_thread(void *arg);
+static uint64_t read_clock(void);
+static size_t bucket_of(uint64_t cycles);
+static void bump(uint64_t *counter, uint64_t n);
+static void add_totals(struct stats_totals *dest,
+        const struct stats_totals *src, const struct stats_hot *hot);
+static void sum_locked(enum stats_fn fn, struct stats_totals *out);
+static uint64_t percentile(const struct stats_totals *t, double q);
+static void on_signal(int signo);
+static void *dump_thread(void *arg);
+
+#endif
+
+/*
+ * @return 1 if the library was built with MATASANO_STATS, otherwise 0
+ */
+int stats_enabled(void)
+{
+#ifdef MATASANO_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/*
+ * Name of an instrumented function, as used in the JSON output
+ */
+const char *stats_fn_name(enum stats_fn fn)
+{
+    if ((size_t) fn >= STATS_NUM_FNS)
+        return "unknown";
+    return fn_names[fn];
+}
+
+/*
+ * Lower bound, in cycles, of a histogram bucket
+ */
+uint64_t stats_bucket_floor(size_t bucket)
+{
+    if (bucket < 4)
+        return bucket;
+    size_t msb = bucket / 4 + 1;
+    return (uint64_t) (4 + bucket % 4) << (msb - 2);
+}
+
+#ifdef MATASANO_STATS
+
+/*
+ * Start timing a sampled call, setting up the thread's counters on its
+ * first call
+ * @return clock reading, or 0 if the counters couldn't be allocated
+ */
+uint64_t stats_sample_begin(void)
+{
+    if (!thread_stats())
+        return 0;
+    // the low bit is forced on so a clock reading of 0 still marks the call
+    // as timed; it's well below the clock's resolution
+    return read_clock() | 1;
+}
+
+/*
+ * Record a sampled call
+ */
+void stats_sample_end(const struct stats_scope *scope)
+{
+    uint64_t end = read_clock();
+    struct thread_stats *ts = local;
+    struct stats_hot *hot = &ts->hot[scope->fn];
+    struct stats_totals *t = &ts->fns[scope->fn];
+    uint64_t cycles = end > scope->start ? end - scope->start : 0;
+    bump(&hot->calls, 1);
+    bump(&hot->bytes, scope->bytes);
+    bump(&hot->keys, scope->keys);
+    bump(&t->timed, 1);
+    bump(&t->cycles, cycles);
+    bump(&t->hist[bucket_of(cycles)], 1);
+}
+
+/*
+ * Sum the counters for one function over every thread, since the last reset
+ * @param fn function to report
+ * @param out pointer to struct to write the totals to
+ */
+void stats_snapshot(enum stats_fn fn, struct stats_totals *out)
+{
+    if (!out)
+        return;
+    memset(out, 0, sizeof *out);
+    if ((size_t) fn >= STATS_NUM_FNS)
+        return;
+    pthread_mutex_lock(&lock);
+    sum_locked(fn, out);
+    const struct stats_totals *base = &baseline[fn];
+    out->calls -= base->calls;
+    out->bytes -= base->bytes;
+    out->keys -= base->keys;
+    out->timed -= base->timed;
+    out->cycles -= base->cycles;
+    for (size_t i = 0; i < STATS_BUCKETS; ++i)
+        out->hist[i] -= base->hist[i];
+    pthread_mutex_unlock(&lock);
+}
+
+/*
+ * Start counting from zero again. Calls in progress may be counted either
+ * side of the reset.
+ */
+void stats_reset(void)
+{
+    // counters are only ever written by their own thread, so rather than
+    // clearing them, remember where they were
+    pthread_mutex_lock(&lock);
+    for (size_t fn = 0; fn < STATS_NUM_FNS; ++fn)
+        sum_locked(fn, &baseline[fn]);
+    pthread_mutex_unlock(&lock);
+}
+
+/*
+ * Write every function's totals and percentiles as a JSON object
+ * @param out stream to write to
+ * @return 0 on success, or -1 on a write error
+ */
+int stats_dump_json(FILE *out)
+{
+    if (!out)
+        return -1;
+    fprintf(out, "{\n  \"enabled\": true,\n  \"clock\": \"%s\",\n"
+            "  \"sample_rate\": %d,\n  \"functions\": [",
+            HAVE_TSC ? "tsc" : "ns", STATS_SAMPLE_RATE);
+    for (size_t fn = 0; fn < STATS_NUM_FNS; ++fn) {
+        struct stats_totals t;
+        stats_snapshot(fn, &t);
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"calls\": %llu, "
+                "\"bytes\": %llu, \"keys\": %llu, \"timed\": %llu, "
+                "\"mean_cycles\": %.1f, \"p50_cycles\": %llu, "
+                "\"p99_cycles\": %llu, \"buckets\": [", fn ? "," : "",
+                fn_names[fn], (unsigned long long) t.calls,
+                (unsigned long long) t.bytes, (unsigned long long) t.keys,
+                (unsigned long long) t.timed,
+                t.timed ? (double) t.cycles / t.timed : 0.0,
+                (unsigned long long) percentile(&t, 0.5),
+                (unsigned long long) percentile(&t, 0.99));
+        int first = 1;
+        for (size_t i = 0; i < STATS_BUCKETS; ++i) {
+            if (!t.hist[i])
+                continue;
+            fprintf(out, "%s[%llu, %llu]", first ? "" : ", ",
+                    (unsigned long long) stats_bucket_floor(i),
+                    (unsigned long long) t.hist[i]);
+            first = 0;
+        }
+        fprintf(out, "]}");
+    }
+    fprintf(out, "\n  ]\n}\n");
+    return ferror(out) ? -1 : 0;
+}
+
+/*
+ * Dump stats as JSON whenever a signal arrives (e.g. SIGUSR1). The handler
+ * only wakes a background thread, which does the writing.
+ * @param signo signal to handle
+ * @param path file to (over)write on each signal, or NULL for stderr
+ * @return 0 on success, or -1 on error, if stats are disabled, or if a
+ *         handler is already installed
+ */
+int stats_dump_on_signal(int signo, const char *path)
+{
+    // held throughout, so concurrent calls install one handler between them
+    pthread_mutex_lock(&signal_lock);
+    if (signal_pipe[0] >= 0) {
+        pthread_mutex_unlock(&signal_lock);
+        return -1;
+    }
+    char *copy = NULL;
+    int fds[2] = { -1, -1 };
+    if ((path && !(copy = strdup(path))) || pipe2(fds, O_CLOEXEC) != 0) {
+        free(copy);
+        pthread_mutex_unlock(&signal_lock);
+        return -1;
+    }
+    // a burst of signals only needs one dump, so never block the handler
+    fcntl(fds[1], F_SETFL, O_NONBLOCK);
+    signal_pipe[0] = fds[0];
+    signal_pipe[1] = fds[1];
+    signal_path = copy;
+
+    pthread_t thread;
+    struct sigaction sa;
+    memset(&sa, 0, sizeof sa);
+    sa.sa_handler = on_signal;
+    sa.sa_flags = SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    int started = pthread_create(&thread, NULL, dump_thread, NULL) == 0;
+    if (started && sigaction(signo, &sa, NULL) == 0) {
+        pthread_detach(thread);
+        pthread_mutex_unlock(&signal_lock);
+        return 0;
+    }
+    // undo everything, so a later call can try again; closing the write end
+    // stops the thread
+    close(fds[1]);
+    if (started)
+        pthread_join(thread, NULL);
+    close(fds[0]);
+    signal_pipe[0] = signal_pipe[1] = -1;
+    signal_path = NULL;
+    free(copy);
+    pthread_mutex_unlock(&signal_lock);
+    return -1;
+}
+
+/*
+ * Set up the key whose destructor retires a thread's counters
+ */
+static void init(void)
+{
+    pthread_key_create(&exit_key, retire_thread);
+}
+
+/*
+ * Get the calling thread's counters, creating them on first use
+ * @return pointer to counters, or NULL on allocation failure
+ */
+static struct thread_stats *thread_stats(void)
+{
+    if (local)
+        return local;
+    pthread_once(&init_once, init);
+    struct thread_stats *ts = calloc(1, sizeof *ts);
+    if (!ts)
+        return NULL;
+    pthread_mutex_lock(&lock);
+    ts->next = threads;
+    threads = ts;
+    pthread_mutex_unlock(&lock);
+    pthread_setspecific(exit_key, ts);
+    local = ts;
+    stats_thread_hot = ts->hot;
+    return ts;
+}
+
+/*
+ * Fold an exiting thread's counters into the retired totals
+ */
+static void retire_thread(void *arg)
+{
+    struct thread_stats *ts = arg;
+    pthread_mutex_lock(&lock);
+    for (struct thread_stats **p = &threads; *p; p = &(*p)->next) {
+        if (*p == ts) {
+            *p = ts->next;
+            break;
+        }
+    }
+    for (size_t fn = 0; fn < STATS_NUM_FNS; ++fn)
+        add_totals(&retired[fn], &ts->fns[fn], &ts->hot[fn]);
+    pthread_mutex_unlock(&lock);
+    // later destructors on this thread may still make instrumented calls
+    stats_thread_hot = NULL;
+    local = NULL;
+    free(ts);
+}
+
+/*
+ * @return the cycle counter, or nanoseconds where there isn't one
+ */
+static uint64_t read_clock(void)
+{
+#if HAVE_TSC
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/*
+ * Histogram bucket for a duration: exact below 4, then 4 buckets for each
+ * power of two
+ */
+static size_t bucket_of(uint64_t cycles)
+{
+    if (cycles < 4)
+        return cycles;
+    size_t msb = 63 - __builtin_clzll(cycles);
+    return 4 * (msb - 1) + ((cycles >> (msb - 2)) & 3);
+}
+
+/*
+ * Add to a counter owned by the calling thread. Snapshots read counters
+ * from other threads, so the store must not tear; relaxed ordering keeps it
+ * an ordinary store.
+ */
+static void bump(uint64_t *counter, uint64_t n)
+{
+    __atomic_store_n(counter, *counter + n, __ATOMIC_RELAXED);
+}
+
+/*
+ * Add one thread's counters for a function, or a set of totals if hot is
+ * NULL, to another set of totals
+ */
+static void add_totals(struct stats_totals *dest,
+        const struct stats_totals *src, const struct stats_hot *hot)
+{
+    if (hot) {
+        dest->calls += __atomic_load_n(&hot->calls, __ATOMIC_RELAXED);
+        dest->bytes += __atomic_load_n(&hot->bytes, __ATOMIC_RELAXED);
+        dest->keys += __atomic_load_n(&hot->keys, __ATOMIC_RELAXED);
+    } else {
+        dest->calls += src->calls;
+        dest->bytes += src->bytes;
+        dest->keys += src->keys;
+    }
+    dest->timed += __atomic_load_n(&src->timed, __ATOMIC_RELAXED);
+    dest->cycles += __atomic_load_n(&src->cycles, __ATOMIC_RELAXED);
+    for (size_t i = 0; i < STATS_BUCKETS; ++i)
+        dest->hist[i] += __atomic_load_n(&src->hist[i], __ATOMIC_RELAXED);
+}
+
+/*
+ * Sum one function's counters over live and retired threads; the lock must
+ * be held
+ */
+static void sum_locked(enum stats_fn fn, struct stats_totals *out)
+{
+    *out = retired[fn];
+    for (struct thread_stats *ts = threads; ts; ts = ts->next)
+        add_totals(out, &ts->fns[fn], &ts->hot[fn]);
+}
+
+/*
+ * Lower bound of the bucket holding a given fraction of timed calls
+ */
+static uint64_t percentile(const struct stats_totals *t, double q)
+{
+    if (!t->timed)
+        return 0;
+    uint64_t rank = (uint64_t) (q * t->timed);
+    if (rank >= t->timed)
+        rank = t->timed - 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < STATS_BUCKETS; ++i) {
+        seen += t->hist[i];
+        if (seen > rank)
+            return stats_bucket_floor(i);
+    }
+    return stats_bucket_floor(STATS_BUCKETS - 1);
+}
+
+/*
+ * Signal handler: wake the dump thread. write() is async-signal-safe;
+ * nothing else here would be.
+ */
+static void on_signal(int signo)
+{
+    (void) signo;
+    int saved = errno;
+    char c = 0;
+    ssize_t unused = write(signal_pipe[1], &c, 1);
+    (void) unused;
+    errno = saved;
+}
+
+/*
+ * Write a dump each time the signal handler wakes us
+ */
+static void *dump_thread(void *arg)
+{
+    (void) arg;
+    char c;
+    for (;;) {
+        ssize_t n = read(signal_pipe[0], &c, 1);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            break;
+        FILE *out = signal_path ? fopen(signal_path, "w") : stderr;
+        if (!out)
+            continue;
+        stats_dump_json(out);
+        if (out == stderr)
+            fflush(out);
+        else
+            fclose(out);
+    }
+    return NULL;
+}
+
+#else
+
+void stats_snapshot(enum stats_fn fn, struct stats_totals *out)
+{
+    (void) fn;
+    if (out)
+        memset(out, 0, sizeof *out);
+}
+
+void stats_reset(void)
+{
+}
+
+int stats_dump_json(FILE *out)
+{
+    if (!out)
+        return -1;
+    fprintf(out, "{\n  \"enabled\": false\n}\n");
+    return ferror(out) ? -1 : 0;
+}
+
+int stats_dump_on_signal(int signo, const char *path)
+{
+    (void) signo;
+    (void) path;
+    return -1;
+}
+
+#endif  // MATASANO_STATS
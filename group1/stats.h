@@ -0,0 +1,183 @@
+/*
+ * stats.h
+ * Per-function counters and timing histograms for the library's hot paths:
+ * calls, bytes processed and keys (or key sizes) scored, plus a histogram of
+ * the time each call took in cycles. Counters are kept per thread, so
+ * recording never takes a lock, and are summed across threads on demand.
+ *
+ * Instrumentation is only compiled in when MATASANO_STATS is defined (make
+ * STATS=1). Otherwise the recording macros expand to nothing, and the API
+ * below reports that stats are disabled and returns empty totals.
+ *
+ * STATS_SCOPE, STATS_BYTES and STATS_KEYS are for use inside the library
+ * only.
+ *
+ * Only one call in STATS_SAMPLE_RATE is timed, per thread and function, to
+ * keep the cost of reading the clock off small inputs. Counters see every
+ * call.
+ */
+
+#ifndef ___stats_h___
+#define ___stats_h___
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifndef STATS_SAMPLE_RATE
+#define STATS_SAMPLE_RATE 16    // must be a power of two
+#endif
+
+// Log-linear histogram: 4 buckets per power of two of cycles, which bounds
+// the error of any reported percentile to 25%, up to 2^64
+#define STATS_BUCKETS 252
+
+enum stats_fn {
+    STATS_READ_BASE16,
+    STATS_READ_BASE64,
+    STATS_DETECT_REPEATED_BYTE_XOR,
+    STATS_BREAK_REPEATED_KEY_XOR,
+    STATS_FIND_LIKELY_KEY_SIZE,
+    STATS_IS_ECB_ENCRYPTED,
+    STATS_FIND_ECB_ALIGNMENT,
+    STATS_NUM_FNS
+};
+
+struct stats_totals {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t keys;              // keys or key sizes scored
+    uint64_t timed;             // calls sampled into the histogram
+    uint64_t cycles;            // total cycles of the timed calls
+    uint64_t hist[STATS_BUCKETS];
+};
+
+#ifdef MATASANO_STATS
+
+// Counters bumped inline on every call, one per function for each thread.
+// Everything else is only touched on sampled calls, in stats.c.
+struct stats_hot {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t keys;
+    uint32_t ticks;             // calls seen, for sampling
+};
+
+// The calling thread's counters, or NULL before its first sampled call
+extern __thread struct stats_hot *stats_thread_hot
+    __attribute__((tls_model("initial-exec")));
+
+// State for one instrumented call; recorded when it goes out of scope
+struct stats_scope {
+    enum stats_fn fn;
+    uint64_t bytes;
+    uint64_t keys;
+    uint64_t start;             // 0 if this call isn't timed
+};
+
+uint64_t stats_sample_begin(void);
+void stats_sample_end(const struct stats_scope *scope);
+
+/*
+ * Start recording a call; used through STATS_SCOPE
+ */
+static inline struct stats_scope stats_scope_begin(enum stats_fn fn,
+        uint64_t bytes)
+{
+    struct stats_scope scope = { fn, bytes, 0, 0 };
+    struct stats_hot *hot = stats_thread_hot;
+    if (__builtin_expect(!hot ||
+                (hot[fn].ticks++ & (STATS_SAMPLE_RATE - 1)) == 0, 0))
+        scope.start = stats_sample_begin();
+    return scope;
+}
+
+/*
+ * Finish recording a call; run by the compiler when a STATS_SCOPE ends.
+ * Counters are only written by their own thread, but snapshots read them
+ * from others, so stores must not tear; relaxed atomics are plain stores.
+ */
+static inline void stats_scope_end(struct stats_scope *scope)
+{
+    if (__builtin_expect(scope->start != 0, 0)) {
+        stats_sample_end(scope);
+        return;
+    }
+    struct stats_hot *hot = stats_thread_hot;
+    if (!hot)
+        return;
+    hot += scope->fn;
+    __atomic_store_n(&hot->calls, hot->calls + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&hot->bytes, hot->bytes + scope->bytes,
+            __ATOMIC_RELAXED);
+    if (scope->keys)
+        __atomic_store_n(&hot->keys, hot->keys + scope->keys,
+                __ATOMIC_RELAXED);
+}
+
+// Count a call to fn over a given number of bytes, timing it until the
+// enclosing block is left by any path
+#define STATS_SCOPE(fn, bytes) \
+    struct stats_scope stats_scope_ \
+        __attribute__((cleanup(stats_scope_end))) = \
+        stats_scope_begin((fn), (bytes))
+// Count bytes the call in the current STATS_SCOPE went on to process, for
+// calls that don't know how many they will at the start
+#define STATS_BYTES(n) (stats_scope_.bytes += (n))
+// Count keys scored by the call in the current STATS_SCOPE
+#define STATS_KEYS(n) (stats_scope_.keys += (n))
+
+#else
+
+#define STATS_SCOPE(fn, bytes) ((void) 0)
+#define STATS_BYTES(n) ((void) 0)
+#define STATS_KEYS(n) ((void) 0)
+
+#endif
+
+/*
+ * @return 1 if the library was built with MATASANO_STATS, otherwise 0
+ */
+int stats_enabled(void);
+
+/*
+ * Name of an instrumented function, as used in the JSON output
+ */
+const char *stats_fn_name(enum stats_fn fn);
+
+/*
+ * Lower bound, in cycles, of a histogram bucket
+ */
+uint64_t stats_bucket_floor(size_t bucket);
+
+/*
+ * Sum the counters for one function over every thread, since the last reset
+ * @param fn function to report
+ * @param out pointer to struct to write the totals to
+ */
+void stats_snapshot(enum stats_fn fn, struct stats_totals *out);
+
+/*
+ * Start counting from zero again. Calls in progress may be counted either
+ * side of the reset.
+ */
+void stats_reset(void);
+
+/*
+ * Write every function's totals and percentiles as a JSON object
+ * @param out stream to write to
+ * @return 0 on success, or -1 on a write error
+ */
+int stats_dump_json(FILE *out);
+
+/*
+ * Dump stats as JSON whenever a signal arrives (e.g. SIGUSR1). The handler
+ * only wakes a background thread, which does the writing.
+ * @param signo signal to handle
+ * @param path file to (over)write on each signal, or NULL for stderr
+ * @return 0 on success, or -1 on error, if stats are disabled, or if a
+ *         handler is already installed
+ */
+int stats_dump_on_signal(int signo, const char *path);
+
+#endif  // ___stats_h___
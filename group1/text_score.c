@@ -7,11 +7,36 @@
 #include <stdlib.h>
 
 #include "text_score.h"
+#include "cpu_dispatch.h"
+#include "ngram_tables.h"
+
+#define SCALED_COUNT_TABLE 512   // texts shorter than this use a lookup table
+#define KEYS_PER_PASS 16
+#define TRIGRAM_BLOCK 4096      // bytes classified per pass of the kernel
 
 // private functions
 static uint32_t differing_bits(uint8_t x, uint8_t y);
 static double dot_product(const struct letter_frequencies *a,
         const struct letter_frequencies *b);
+static int compare_likelihood(const void *a, const void *b);
+static double xor_byte_weight(uint8_t c);
+static double score_letter_frequencies(const uint8_t *text, size_t len);
+static void score_letter_frequency_keys(const uint8_t *text, size_t len,
+        double scores[256]);
+static double score_trigrams_xor(const uint8_t *text, size_t len,
+        uint8_t key);
+static void score_trigram_keys(const uint8_t *text, size_t len,
+        double scores[256]);
+static int64_t sum_trigrams(const uint8_t *classes, size_t len);
+
+static const struct text_scorer letter_frequency = {
+    "letter-frequency", score_letter_frequencies,
+    score_letter_frequency_keys
+};
+
+static const struct text_scorer trigram = {
+    "trigram", score_trigrams, score_trigram_keys
+};
 
 const static struct letter_frequencies english_language = {
     .freqs = {
@@ -92,6 +117,149 @@ double compare_to_english(const struct letter_frequencies *src)
     return dot_product(src, &english_language);
 }
 
+/*
+ * Count the bytes of a buffer. Four tables are used so that runs of the same
+ * byte don't make each increment wait on the previous one.
+ * @param hist counts to add to, one per byte value
+ * @param src buffer to count
+ * @param len number of bytes to count
+ *        precondition: length of src buffer >= len
+ */
+void byte_histogram(uint32_t hist[256], const uint8_t *src, size_t len)
+{
+    if (!hist || !src)
+        return;
+    uint32_t sub[3][256];
+    memset(sub, 0, sizeof sub);
+    size_t i = 0;
+    for (; i + 4 <= len; i += 4) {
+        ++hist[src[i]];
+        ++sub[0][src[i + 1]];
+        ++sub[1][src[i + 2]];
+        ++sub[2][src[i + 3]];
+    }
+    for (; i < len; ++i)
+        ++hist[src[i]];
+    for (size_t b = 0; b < 256; ++b)
+        hist[b] += sub[0][b] + sub[1][b] + sub[2][b];
+}
+
+/*
+ * Score every single-byte xor key against a byte histogram. scores[key] is
+ * exactly compare_to_english of the letter frequencies of the text xor'd
+ * with key, without needing the text itself.
+ * @param hist count of each byte value in the text
+ * @param len number of bytes in the text
+ * @param scores output for the score of each key
+ */
+void score_xor_keys(const uint32_t hist[256], size_t len, double scores[256])
+{
+    if (!hist || !scores)
+        return;
+    // counts are normalized as in calculate_letter_frequencies and summed in
+    // the same order as compare_to_english, so the scores match exactly;
+    // short texts look the normalized counts up rather than dividing
+    double scaled[SCALED_COUNT_TABLE];
+    int use_table = len != 0 && len < SCALED_COUNT_TABLE;
+    if (use_table)
+        for (size_t c = 0; c <= len; ++c)
+            scaled[c] = (c * 100.0) / (double) len;
+    // a letter's count under key k is folded[letter ^ k], as flipping 0x20
+    // switches case
+    uint32_t folded[256];
+    for (size_t b = 0; b < 256; ++b)
+        folded[b] = hist[b] + hist[b ^ 0x20];
+    // each key's sum is a chain of dependent adds, so run several keys'
+    // chains side by side
+    for (size_t base = 0; base < 256; base += KEYS_PER_PASS) {
+        double sums[KEYS_PER_PASS] = { 0 };
+        for (size_t j = 0; j < FREQS_LEN; ++j) {
+            double weight = english_language.freqs[j];
+            uint8_t letter = j == LF_SPACE_INDEX ? ' ' : 'a' + j;
+            const uint32_t *counts = j == LF_SPACE_INDEX ? hist : folded;
+            if (use_table) {
+                for (size_t k = 0; k < KEYS_PER_PASS; ++k)
+                    sums[k] += scaled[counts[letter ^ (base + k)]] * weight;
+                continue;
+            }
+            for (size_t k = 0; k < KEYS_PER_PASS; ++k) {
+                double freq = counts[letter ^ (base + k)];
+                if (len != 0)
+                    freq = (freq * 100.0) / (double) len;
+                sums[k] += freq * weight;
+            }
+        }
+        memcpy(scores + base, sums, sizeof sums);
+    }
+}
+
+
+/*
+ * Test whether one key's score_xor_keys score is surely above every other
+ * key's. Squares are compared, so that no square root is needed.
+ * @param hist count of each byte value in the text
+ * @param len number of bytes in the text
+ * @param key key to test
+ * @param z how many standard errors key must lead every other key by
+ * @return 1 if key leads every other key by z standard errors, else 0
+ */
+int xor_key_leads_by(const uint32_t hist[256], size_t len, uint8_t key,
+        double z)
+{
+    if (!hist || len == 0)
+        return 0;
+    double weight[256];
+    for (size_t b = 0; b < 256; ++b)
+        weight[b] = xor_byte_weight((uint8_t) b);
+    double own[256];
+    for (size_t b = 0; b < 256; ++b)
+        own[b] = weight[b ^ key];
+    for (size_t rival = 0; rival < 256; ++rival) {
+        if (rival == key)
+            continue;
+        double sum = 0, sum_squares = 0;
+        for (size_t b = 0; b < 256; ++b) {
+            double d = own[b] - weight[b ^ rival];
+            sum += hist[b] * d;
+            sum_squares += hist[b] * d * d;
+        }
+        double mean = sum / len;
+        double variance = sum_squares / len - mean * mean;
+        // mean / sqrt(variance / len) >= z
+        if (mean <= 0 || mean * mean * len < z * z * variance)
+            return 0;
+    }
+    return 1;
+}
+
+/*
+ * Score a text with the trigram model of english
+ * @param text text to score
+ * @param len number of bytes in text
+ * @return mean log2 probability of each byte given the two before it, or 0
+ *         for an empty text
+ */
+double score_trigrams(const uint8_t *text, size_t len)
+{
+    return score_trigrams_xor(text, len, 0);
+}
+
+/*
+ * @return the scorer built on letter frequencies
+ */
+const struct text_scorer *letter_frequency_scorer(void)
+{
+    return &letter_frequency;
+}
+
+/*
+ * @return the scorer built on score_trigrams
+ */
+const struct text_scorer *trigram_scorer(void)
+{
+    return &trigram;
+}
+
 /*
  * Print a letter frequency struct
  * @param src pointer to frequencies to print
@@ -136,6 +304,9 @@ uint32_t hamming_distance(const uint8_t *src1, const uint8_t *src2, size_t len)
 {
     if (!src1 || !src2)
         return UINT32_MAX;
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->popcount_xor)
+        return (uint32_t) k->popcount_xor(src1, src2, len);
     uint32_t distance = 0;
     for (size_t i = 0; i < len; ++i)
         distance += differing_bits(src1[i], src2[i]);
@@ -161,3 +332,145 @@ static uint32_t differing_bits(uint8_t x, uint8_t y)
     return diff;
 }
 
+
+/*
+ * Estimate how likely a byte is to appear in english text, using the same
+ * letter frequencies as compare_to_english
+ * @param c byte to score
+ * @return a non-negative score, where a higher score is more likely; bytes
+ *         that are never printable score 0
+ */
+double english_byte_likelihood(uint8_t c)
+{
+    if (c >= 'a' && c <= 'z')
+        return english_language.freqs[c - 'a'];
+    if (c >= 'A' && c <= 'Z')
+        return english_language.freqs[c - 'A'] / 10;
+    if (c == ' ')
+        return english_language.freqs[LF_SPACE_INDEX];
+    // rough guesses below the rarest letters, in decreasing order of
+    // how often they turn up in prose
+    if (c == '.' || c == ',' || c == '\n')
+        return 0.1;
+    if (c == '\'' || c == '"' || c == '-' || c == '?' || c == '!')
+        return 0.05;
+    if (c >= '0' && c <= '9')
+        return 0.03;
+    if (c >= 0x20 && c < 0x7f)
+        return 0.01;
+    if (c == '\t' || c == '\r')
+        return 0.005;
+    return 0;
+}
+
+/*
+ * Order every byte value from most to least likely to appear in english text
+ * @param order output array; receives each of the 256 byte values once
+ */
+void rank_english_bytes(uint8_t order[256])
+{
+    if (!order)
+        return;
+    for (size_t i = 0; i < 256; ++i)
+        order[i] = (uint8_t) i;
+    qsort(order, 256, sizeof order[0], compare_likelihood);
+}
+
+/*
+ * qsort comparator putting more likely bytes first; ties keep byte order so
+ * the ranking is deterministic
+ */
+static int compare_likelihood(const void *a, const void *b)
+{
+    uint8_t x = *(const uint8_t *) a;
+    uint8_t y = *(const uint8_t *) b;
+    double lx = english_byte_likelihood(x);
+    double ly = english_byte_likelihood(y);
+    if (lx != ly)
+        return lx > ly ? -1 : 1;
+    return (int) x - (int) y;
+}
+
+/*
+ * What one byte of a text adds to score_xor_keys' score, times the length
+ * of the text
+ */
+static double xor_byte_weight(uint8_t c)
+{
+    if (c == ' ')
+        return 100.0 * english_language.freqs[LF_SPACE_INDEX];
+    uint8_t lower = c | 0x20;
+    if (lower >= 'a' && lower <= 'z')
+        return 100.0 * english_language.freqs[lower - 'a'];
+    return 0;
+}
+
+/*
+ * The letter frequency scorer's score function
+ */
+static double score_letter_frequencies(const uint8_t *text, size_t len)
+{
+    struct letter_frequencies freqs;
+    calculate_letter_frequencies((const char *) text, len, &freqs);
+    return compare_to_english(&freqs);
+}
+
+/*
+ * The letter frequency scorer's score_keys function, from one histogram
+ */
+static void score_letter_frequency_keys(const uint8_t *text, size_t len,
+        double scores[256])
+{
+    uint32_t hist[256] = { 0 };
+    byte_histogram(hist, text, len);
+    score_xor_keys(hist, len, scores);
+}
+
+/*
+ * Score a text xor'd with a key byte with the trigram model. The text is
+ * classified a block at a time into a buffer that stays in L1, with the last
+ * two classes of each block carried over to start the next.
+ */
+static double score_trigrams_xor(const uint8_t *text, size_t len,
+        uint8_t key)
+{
+    if (!text || len == 0)
+        return 0;
+    uint8_t classes[TRIGRAM_BLOCK + 2];
+    classes[0] = classes[1] = english_trigram_class[' '];
+    int64_t sum = 0;
+    for (size_t off = 0; off < len; off += TRIGRAM_BLOCK) {
+        size_t n = len - off < TRIGRAM_BLOCK ? len - off : TRIGRAM_BLOCK;
+        for (size_t i = 0; i < n; ++i)
+            classes[i + 2] = english_trigram_class[text[off + i] ^ key];
+        sum += sum_trigrams(classes, n + 2);
+        classes[0] = classes[n];
+        classes[1] = classes[n + 1];
+    }
+    return (double) sum / ((double) NGRAM_LOG_SCALE * (double) len);
+}
+
+/*
+ * The trigram scorer's score_keys function
+ */
+static void score_trigram_keys(const uint8_t *text, size_t len,
+        double scores[256])
+{
+    for (size_t key = 0; key < 256; ++key)
+        scores[key] = score_trigrams_xor(text, len, (uint8_t) key);
+}
+
+/*
+ * Sum the trigram table entries of a run of classes
+ */
+static int64_t sum_trigrams(const uint8_t *classes, size_t len)
+{
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->trigram_sum)
+        return k->trigram_sum(classes, len, english_trigram_log2);
+    int64_t sum = 0;
+    for (size_t i = 0; i + 2 < len; ++i)
+        sum += english_trigram_log2[(classes[i] << (2 * TRIGRAM_CLASS_BITS)) |
+            (classes[i + 1] << TRIGRAM_CLASS_BITS) | classes[i + 2]];
+    return sum;
+}
@@ -13,6 +13,17 @@ struct letter_frequencies {
 };
 #define LF_SPACE_INDEX 26
 
+// A model of english text, for ranking candidate plaintexts. Scores are
+// higher the more a text looks like english, and are comparable between
+// texts of the same length.
+struct text_scorer {
+    const char *name;
+    // score a text
+    double (*score)(const uint8_t *text, size_t len);
+    // score the text xor'd with each single-byte key
+    void (*score_keys)(const uint8_t *text, size_t len, double scores[256]);
+};
+
 
 /*
  * Calculate the frequency of each letter in a string
@@ -32,6 +43,62 @@ void calculate_letter_frequencies(const char *src, size_t len,
  */
 double compare_to_english(const struct letter_frequencies *src);
 
+/*
+ * Count the bytes of a buffer
+ * @param hist counts to add to, one per byte value
+ * @param src buffer to count
+ * @param len number of bytes to count
+ *        precondition: length of src buffer >= len
+ */
+void byte_histogram(uint32_t hist[256], const uint8_t *src, size_t len);
+
+/*
+ * Score every single-byte xor key against a byte histogram. scores[key] is
+ * exactly compare_to_english of the letter frequencies of the text xor'd
+ * with key, without needing the text itself.
+ * @param hist count of each byte value in the text
+ * @param len number of bytes in the text
+ * @param scores output for the score of each key
+ */
+void score_xor_keys(const uint32_t hist[256], size_t len, double scores[256]);
+
+/*
+ * Test whether one key's score_xor_keys score is surely above every other
+ * key's, or just ahead by chance. A key's score is the mean, over the text's
+ * bytes, of a weight for each byte; so for each rival key, the mean of the
+ * per-byte differences in weight is tested against its standard error, as
+ * if the bytes were drawn independently.
+ * @param hist count of each byte value in the text
+ * @param len number of bytes in the text
+ * @param key key to test, usually the best scoring one
+ * @param z how many standard errors key must lead every other key by
+ * @return 1 if key leads every other key by z standard errors, else 0
+ */
+int xor_key_leads_by(const uint32_t hist[256], size_t len, uint8_t key,
+        double z);
+
+/*
+ * Score a text with the trigram model of english in ngram_tables.h. The
+ * text is taken to be preceded by two spaces, so that every byte ends a
+ * trigram, and the table lookups use the best vector kernel available.
+ * @param text text to score
+ * @param len number of bytes in text
+ * @return mean log2 probability of each byte given the two before it, or 0
+ *         for an empty text
+ */
+double score_trigrams(const uint8_t *text, size_t len);
+
+/*
+ * @return the scorer built on letter frequencies, as compare_to_english
+ */
+const struct text_scorer *letter_frequency_scorer(void);
+
+/*
+ * @return the scorer built on score_trigrams, which tells english from
+ *         noise on much shorter texts than letter frequencies can
+ */
+const struct text_scorer *trigram_scorer(void);
+
 /*
  * Print a letter frequency struct
  * @param src pointer to frequencies to print
@@ -49,4 +116,19 @@ void print_frequencies(const struct letter_frequencies *src);
  */
 uint32_t hamming_distance(const uint8_t *src1, const uint8_t *src2, size_t len);
 
+/*
+ * Estimate how likely a byte is to appear in english text, using the same
+ * letter frequencies as compare_to_english
+ * @param c byte to score
+ * @return a non-negative score, where a higher score is more likely; bytes
+ *         that are never printable score 0
+ */
+double english_byte_likelihood(uint8_t c);
+
+/*
+ * Order every byte value from most to least likely to appear in english text
+ * @param order output array; receives each of the 256 byte values once
+ */
+void rank_english_bytes(uint8_t order[256]);
+
 #endif  // ___text_score_h___
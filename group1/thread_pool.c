@@ -0,0 +1,711 @@
+/*
+ * thread_pool.c
+ * A work-stealing thread pool. Each worker owns a Chase-Lev deque (see "Correct
+ * and Efficient Work-Stealing for Weak Memory Models", Lê et al., 2013): the
+ * owner pushes and pops at the bottom without locking, and thieves take from
+ * the top with a compare-and-swap. Threads outside the pool submit to a
+ * locked injection queue. Idle workers sleep on a condition variable, and an
+ * epoch counter bumped by every submit keeps wakeups from being lost; threads
+ * waiting on a group that find nothing to run sleep the same way, until the
+ * group finishes or more work is submitted. Task structs are recycled through
+ * a free list per submitting thread, and go back to that list from whichever
+ * thread ran them.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "thread_pool.h"
+
+#define DEQUE_INITIAL_SIZE 256
+#define CACHE_LINE 64
+// Times a waiting thread looks for a task to run before it sleeps
+#define WAIT_SPINS 64
+
+struct task_cache;
+
+struct task {
+    thread_pool_task_fn fn;
+    void *arg;
+    struct thread_pool_group *group;
+    struct task *next;      // link in the injection queue or a free list
+    struct task_cache *owner;
+};
+
+// A thread's free task structs. Tasks run by other threads are pushed back
+// onto returned without locking. The cache is freed once its thread has
+// exited and every task taken from it is back.
+struct task_cache {
+    struct task *local;     // owner thread only
+    struct task *returned;
+    size_t refs;            // the owner thread, plus tasks taken from here
+};
+
+// A deque's ring of tasks. Arrays replaced by a larger one stay allocated
+// until the deque is freed, since a thief may still be reading them.
+struct deque_array {
+    struct deque_array *retired;
+    int64_t size;           // a power of two
+    struct task *tasks[];
+};
+
+struct deque {
+    int64_t top __attribute__((aligned(CACHE_LINE)));
+    int64_t bottom __attribute__((aligned(CACHE_LINE)));
+    struct deque_array *array;
+};
+
+struct worker {
+    struct deque deque;
+    struct thread_pool *pool;
+    pthread_t thread;
+    size_t index;
+};
+
+struct thread_pool {
+    struct worker *workers;
+    size_t num_workers;
+    int pin;
+    int first_cpu;
+    pthread_mutex_t lock;   // guards the injection queue and sleeping
+    pthread_cond_t wake;
+    pthread_cond_t done;    // a group finished, for threads in wait
+    size_t waiters;         // threads sleeping in thread_pool_wait
+    struct task *inject_head;
+    struct task *inject_tail;
+    size_t injected;        // tasks in the injection queue
+    uint64_t epoch;         // bumped by every submit
+    size_t sleepers;
+    int stop;
+};
+
+// Shared state for one thread_pool_parallel_for call
+struct range_job {
+    thread_pool_range_fn fn;
+    void *arg;
+    size_t next;            // first unclaimed index
+    size_t end;
+    size_t grain;
+    size_t runners;
+};
+
+static __thread struct worker *self;
+static __thread struct task_cache *free_tasks;
+static __thread uint64_t steal_seed;
+static pthread_once_t free_list_once = PTHREAD_ONCE_INIT;
+static pthread_key_t free_list_key;
+static pthread_once_t default_once = PTHREAD_ONCE_INIT;
+static struct thread_pool *default_pool;
+static size_t batch_limit;
+
+// Private functions
+static int deque_init(struct deque *d);
+static void deque_free(struct deque *d);
+static int deque_push(struct deque *d, struct task *t);
+static struct task *deque_pop(struct deque *d);
+static struct task *deque_steal(struct deque *d);
+static struct task *find_task(struct thread_pool *pool);
+static void run_task(struct thread_pool *pool, struct task *t);
+static struct task *acquire_task(void);
+static void release_task(struct task *t);
+static void put_task_cache(struct task_cache *c);
+static void free_tasks_at_exit(void *cache);
+static void init_free_list_key(void);
+static void notify(struct thread_pool *pool);
+static void *worker_main(void *arg);
+static void create_default_pool(void);
+static void range_runner(void *arg);
+
+/*
+ * Start a pool
+ * @param opts options, or NULL for one worker per online cpu besides the
+ *        caller, unpinned
+ * @return pointer to the new pool, or NULL on error
+ */
+struct thread_pool *thread_pool_create(const struct thread_pool_options *opts)
+{
+    struct thread_pool_options defaults = { 0, 0, 0 };
+    if (!opts) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        defaults.workers = cpus > 1 ? (size_t) cpus - 1 : 0;
+        opts = &defaults;
+    }
+    struct thread_pool *pool = calloc(1, sizeof *pool);
+    if (!pool)
+        return NULL;
+    pool->pin = opts->pin;
+    pool->first_cpu = opts->first_cpu;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    if (opts->workers) {
+        pool->workers = calloc(opts->workers, sizeof *pool->workers);
+        if (!pool->workers) {
+            thread_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    // num_workers only counts started workers, so destroy can clean up
+    // after a partial start
+    for (size_t i = 0; i < opts->workers; ++i) {
+        struct worker *w = &pool->workers[i];
+        w->pool = pool;
+        w->index = i;
+        if (deque_init(&w->deque) != 0)
+            break;
+        if (pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+            deque_free(&w->deque);
+            break;
+        }
+        // running workers read this to find deques to steal from
+        __atomic_store_n(&pool->num_workers, i + 1, __ATOMIC_RELEASE);
+    }
+    if (pool->num_workers != opts->workers) {
+        thread_pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/*
+ * Stop a pool's workers and free it
+ *        precondition: no tasks are queued or running
+ */
+void thread_pool_destroy(struct thread_pool *pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->num_workers; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+        deque_free(&pool->workers[i].deque);
+    }
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+/*
+ * @return number of worker threads in a pool
+ */
+size_t thread_pool_size(const struct thread_pool *pool)
+{
+    return pool ? pool->num_workers : 0;
+}
+
+/*
+ * Get the pool used by the library's batch functions, starting it on first
+ * use. Its size is one worker per online cpu besides the caller, or
+ * MATASANO_THREADS - 1 if that is set.
+ * @return pointer to the pool, or NULL if it could not be started
+ */
+struct thread_pool *thread_pool_default(void)
+{
+    pthread_once(&default_once, create_default_pool);
+    return default_pool;
+}
+
+/*
+ * Set the most threads, including the caller, that each call to one of the
+ * library's batch functions may use
+ * @param limit thread count, 1 to run batches on the calling thread only, or
+ *        0 for as many as the default pool has
+ * @return the previous limit
+ */
+size_t thread_pool_set_batch_limit(size_t limit)
+{
+    return __atomic_exchange_n(&batch_limit, limit, __ATOMIC_RELAXED);
+}
+
+/*
+ * @return the limit set by thread_pool_set_batch_limit
+ */
+size_t thread_pool_batch_limit(void)
+{
+    return __atomic_load_n(&batch_limit, __ATOMIC_RELAXED);
+}
+
+/*
+ * Queue a task
+ * @param pool pool to run it on
+ * @param group group to count the task in
+ * @param fn function to run
+ * @param arg argument to pass to fn
+ * @return 0 on success, or -1 if the task could not be allocated, in which
+ *         case it has not been run
+ */
+int thread_pool_submit(struct thread_pool *pool,
+        struct thread_pool_group *group, thread_pool_task_fn fn, void *arg)
+{
+    if (!pool || !group || !fn)
+        return -1;
+    struct task *t = acquire_task();
+    if (!t)
+        return -1;
+    t->fn = fn;
+    t->arg = arg;
+    t->group = group;
+    t->next = NULL;
+    __atomic_add_fetch(&group->pending, 1, __ATOMIC_ACQ_REL);
+    if (!self || self->pool != pool || deque_push(&self->deque, t) != 0) {
+        pthread_mutex_lock(&pool->lock);
+        if (pool->inject_tail)
+            pool->inject_tail->next = t;
+        else
+            pool->inject_head = t;
+        pool->inject_tail = t;
+        __atomic_add_fetch(&pool->injected, 1, __ATOMIC_RELEASE);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    notify(pool);
+    return 0;
+}
+
+/*
+ * Wait for every task in a group to finish, running queued tasks meanwhile,
+ * and sleeping once there are none to run
+ * @param pool pool the tasks were submitted to
+ * @param group group to wait for
+ */
+void thread_pool_wait(struct thread_pool *pool,
+        struct thread_pool_group *group)
+{
+    if (!pool || !group)
+        return;
+    size_t misses = 0;
+    while (__atomic_load_n(&group->pending, __ATOMIC_SEQ_CST)) {
+        // read before looking, so a submit made while looking is noticed
+        uint64_t epoch = __atomic_load_n(&pool->epoch, __ATOMIC_SEQ_CST);
+        struct task *t = find_task(pool);
+        if (t) {
+            run_task(pool, t);
+            misses = 0;
+            continue;
+        }
+        if (++misses < WAIT_SPINS) {
+            sched_yield();
+            continue;
+        }
+        // the last tasks are running elsewhere; sleep until a group
+        // finishes or something new is submitted
+        pthread_mutex_lock(&pool->lock);
+        __atomic_add_fetch(&pool->waiters, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&group->pending, __ATOMIC_SEQ_CST) &&
+                __atomic_load_n(&pool->epoch, __ATOMIC_SEQ_CST) == epoch)
+            pthread_cond_wait(&pool->done, &pool->lock);
+        __atomic_sub_fetch(&pool->waiters, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&pool->lock);
+        misses = 0;
+    }
+}
+
+/*
+ * Run fn over the index range [begin, end) in chunks, on up to limit
+ * threads including the caller, and wait for it to finish. Each thread
+ * claims chunks from a shared position, sized to a fraction of what is left,
+ * so chunks start large and shrink towards grain as the range runs out.
+ * @param pool pool to run on, or NULL for the default pool
+ * @param begin first index
+ * @param end one past the last index
+ * @param grain smallest chunk worth handing out, or 0 for 1
+ * @param limit most threads to use, or 0 for the pool's size plus one
+ * @param fn function to run on each chunk
+ * @param arg argument to pass to fn
+ */
+void thread_pool_parallel_for(struct thread_pool *pool, size_t begin,
+        size_t end, size_t grain, size_t limit, thread_pool_range_fn fn,
+        void *arg)
+{
+    if (!fn || begin >= end)
+        return;
+    if (!pool && limit != 1)
+        pool = thread_pool_default();
+    if (grain == 0)
+        grain = 1;
+    size_t runners = pool ? pool->num_workers + 1 : 1;
+    if (limit && limit < runners)
+        runners = limit;
+    size_t chunks = (end - begin) / grain + ((end - begin) % grain != 0);
+    if (chunks < runners)
+        runners = chunks;
+    if (runners <= 1) {
+        fn(arg, begin, end);
+        return;
+    }
+    struct range_job job = { fn, arg, begin, end, grain, runners };
+    struct thread_pool_group group = { 0 };
+    // if a runner can't be queued, the others just take more of the range
+    for (size_t i = 1; i < runners; ++i)
+        if (thread_pool_submit(pool, &group, range_runner, &job) != 0)
+            break;
+    range_runner(&job);
+    thread_pool_wait(pool, &group);
+}
+
+/*
+ * Set up an empty deque
+ * @return 0 on success, or -1 on allocation failure
+ */
+static int deque_init(struct deque *d)
+{
+    d->top = 0;
+    d->bottom = 0;
+    d->array = malloc(sizeof *d->array +
+            DEQUE_INITIAL_SIZE * sizeof d->array->tasks[0]);
+    if (!d->array)
+        return -1;
+    d->array->retired = NULL;
+    d->array->size = DEQUE_INITIAL_SIZE;
+    return 0;
+}
+
+/*
+ * Free a deque's arrays, current and retired
+ */
+static void deque_free(struct deque *d)
+{
+    struct deque_array *a = d->array;
+    while (a) {
+        struct deque_array *retired = a->retired;
+        free(a);
+        a = retired;
+    }
+    d->array = NULL;
+}
+
+/*
+ * Push a task onto the bottom of a deque; owner only
+ * @return 0 on success, or -1 if the deque was full and couldn't grow
+ */
+static int deque_push(struct deque *d, struct task *t)
+{
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    struct deque_array *a = __atomic_load_n(&d->array, __ATOMIC_RELAXED);
+    if (b - top > a->size - 1) {
+        struct deque_array *grown = malloc(sizeof *grown +
+                2 * a->size * sizeof grown->tasks[0]);
+        if (!grown)
+            return -1;
+        grown->retired = a;
+        grown->size = 2 * a->size;
+        for (int64_t i = top; i < b; ++i)
+            grown->tasks[i & (grown->size - 1)] = __atomic_load_n(
+                    &a->tasks[i & (a->size - 1)], __ATOMIC_RELAXED);
+        __atomic_store_n(&d->array, grown, __ATOMIC_RELEASE);
+        a = grown;
+    }
+    __atomic_store_n(&a->tasks[b & (a->size - 1)], t, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+    return 0;
+}
+
+/*
+ * Pop the most recently pushed task from a deque; owner only
+ * @return the task, or NULL if the deque is empty
+ */
+static struct task *deque_pop(struct deque *d)
+{
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_RELAXED) - 1;
+    struct deque_array *a = __atomic_load_n(&d->array, __ATOMIC_RELAXED);
+    __atomic_store_n(&d->bottom, b, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&d->top, __ATOMIC_RELAXED);
+    struct task *t = NULL;
+    if (top <= b) {
+        t = __atomic_load_n(&a->tasks[b & (a->size - 1)], __ATOMIC_RELAXED);
+        if (top == b) {
+            // last task: race any thief for it
+            if (!__atomic_compare_exchange_n(&d->top, &top, top + 1, 0,
+                        __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                t = NULL;
+            __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+        }
+    } else {
+        __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELAXED);
+    }
+    return t;
+}
+
+/*
+ * Take the oldest task from another thread's deque
+ * @return the task, or NULL if the deque is empty or another thread won
+ *         the race for the task
+ */
+static struct task *deque_steal(struct deque *d)
+{
+    int64_t top = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    if (top >= b)
+        return NULL;
+    struct deque_array *a = __atomic_load_n(&d->array, __ATOMIC_ACQUIRE);
+    struct task *t = __atomic_load_n(&a->tasks[top & (a->size - 1)],
+            __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&d->top, &top, top + 1, 0,
+                __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        return NULL;
+    return t;
+}
+
+/*
+ * Find a task to run: the caller's own deque first if it is a worker of
+ * this pool, then the injection queue, then the other workers' deques
+ * starting from a random one
+ * @return a task, or NULL if none was found
+ */
+static struct task *find_task(struct thread_pool *pool)
+{
+    struct worker *w = self && self->pool == pool ? self : NULL;
+    struct task *t;
+    if (w && (t = deque_pop(&w->deque)))
+        return t;
+    if (__atomic_load_n(&pool->injected, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&pool->lock);
+        t = pool->inject_head;
+        if (t) {
+            pool->inject_head = t->next;
+            if (!pool->inject_head)
+                pool->inject_tail = NULL;
+            __atomic_sub_fetch(&pool->injected, 1, __ATOMIC_RELEASE);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        if (t)
+            return t;
+    }
+    size_t n = __atomic_load_n(&pool->num_workers, __ATOMIC_ACQUIRE);
+    if (n == 0)
+        return NULL;
+    // xorshift, seeded per thread
+    if (!steal_seed)
+        steal_seed = (uintptr_t) &steal_seed | 1;
+    steal_seed ^= steal_seed << 13;
+    steal_seed ^= steal_seed >> 7;
+    steal_seed ^= steal_seed << 17;
+    size_t start = steal_seed % n;
+    for (size_t i = 0; i < n; ++i) {
+        struct worker *victim = &pool->workers[(start + i) % n];
+        if (victim != w && (t = deque_steal(&victim->deque)))
+            return t;
+    }
+    return NULL;
+}
+
+/*
+ * Run a task, recycle it and count it as done in its group, waking threads
+ * sleeping in thread_pool_wait if that finishes the group
+ */
+static void run_task(struct thread_pool *pool, struct task *t)
+{
+    struct thread_pool_group *group = t->group;
+    t->fn(t->arg);
+    release_task(t);
+    // the group may be freed as soon as its count reaches zero
+    if (__atomic_sub_fetch(&group->pending, 1, __ATOMIC_SEQ_CST) == 0 &&
+            __atomic_load_n(&pool->waiters, __ATOMIC_SEQ_CST)) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/*
+ * Get a task struct from the calling thread's free list, topped up from the
+ * tasks other threads have returned to it, or from the heap
+ * @return the task, or NULL on allocation failure
+ */
+static struct task *acquire_task(void)
+{
+    struct task_cache *c = free_tasks;
+    if (!c) {
+        pthread_once(&free_list_once, init_free_list_key);
+        c = calloc(1, sizeof *c);
+        if (!c)
+            return NULL;
+        c->refs = 1;
+        pthread_setspecific(free_list_key, c);
+        free_tasks = c;
+    }
+    struct task *t = c->local;
+    if (!t)
+        t = __atomic_exchange_n(&c->returned, NULL, __ATOMIC_ACQUIRE);
+    if (t) {
+        c->local = t->next;
+    } else {
+        t = malloc(sizeof *t);
+        if (!t)
+            return NULL;
+        t->owner = c;
+    }
+    __atomic_add_fetch(&c->refs, 1, __ATOMIC_RELAXED);
+    return t;
+}
+
+/*
+ * Give a task struct back to the free list it came from
+ */
+static void release_task(struct task *t)
+{
+    struct task_cache *c = t->owner;
+    if (c == free_tasks) {
+        t->next = c->local;
+        c->local = t;
+    } else {
+        struct task *head = __atomic_load_n(&c->returned, __ATOMIC_RELAXED);
+        do
+            t->next = head;
+        while (!__atomic_compare_exchange_n(&c->returned, &head, t, 1,
+                    __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    }
+    put_task_cache(c);
+}
+
+/*
+ * Drop a reference to a free list, freeing it and its tasks with the last
+ */
+static void put_task_cache(struct task_cache *c)
+{
+    if (__atomic_sub_fetch(&c->refs, 1, __ATOMIC_ACQ_REL) != 0)
+        return;
+    struct task *lists[] = { c->local, c->returned };
+    for (size_t i = 0; i < 2; ++i) {
+        struct task *t = lists[i];
+        while (t) {
+            struct task *next = t->next;
+            free(t);
+            t = next;
+        }
+    }
+    free(c);
+}
+
+/*
+ * Thread exit destructor for a free list: the list lives on until the
+ * tasks still out on loan come back
+ */
+static void free_tasks_at_exit(void *cache)
+{
+    free_tasks = NULL;
+    put_task_cache(cache);
+}
+
+/*
+ * Create the key whose destructor frees each thread's task free list
+ */
+static void init_free_list_key(void)
+{
+    pthread_key_create(&free_list_key, free_tasks_at_exit);
+}
+
+/*
+ * Wake a sleeping worker, if there is one, after a submit
+ */
+static void notify(struct thread_pool *pool)
+{
+    __atomic_add_fetch(&pool->epoch, 1, __ATOMIC_SEQ_CST);
+    int sleepers = __atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST) != 0;
+    int waiters = __atomic_load_n(&pool->waiters, __ATOMIC_SEQ_CST) != 0;
+    if (sleepers || waiters) {
+        pthread_mutex_lock(&pool->lock);
+        if (sleepers)
+            pthread_cond_signal(&pool->wake);
+        // a waiter may be the only thread able to run the new task
+        if (waiters)
+            pthread_cond_broadcast(&pool->done);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+/*
+ * Worker thread: run tasks until the pool is stopped, sleeping when there
+ * are none
+ */
+static void *worker_main(void *arg)
+{
+    struct worker *w = arg;
+    struct thread_pool *pool = w->pool;
+    self = w;
+    if (pool->pin) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        if (cpus > 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET((size_t) (pool->first_cpu + w->index) % cpus, &set);
+            pthread_setaffinity_np(pthread_self(), sizeof set, &set);
+        }
+    }
+    for (;;) {
+        // read before looking, so a submit made while looking is noticed
+        uint64_t epoch = __atomic_load_n(&pool->epoch, __ATOMIC_SEQ_CST);
+        struct task *t = find_task(pool);
+        if (t) {
+            run_task(pool, t);
+            continue;
+        }
+        pthread_mutex_lock(&pool->lock);
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        __atomic_add_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+        while (!pool->stop &&
+                __atomic_load_n(&pool->epoch, __ATOMIC_SEQ_CST) == epoch)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        __atomic_sub_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return NULL;
+}
+
+/*
+ * Start the default pool, sized from MATASANO_THREADS if it is set
+ */
+static void create_default_pool(void)
+{
+    const char *env = getenv(THREAD_POOL_ENV);
+    if (env && *env) {
+        char *end;
+        unsigned long threads = strtoul(env, &end, 10);
+        if (*end == '\0' && threads > 0) {
+            struct thread_pool_options opts = { threads - 1, 0, 0 };
+            default_pool = thread_pool_create(&opts);
+            return;
+        }
+    }
+    default_pool = thread_pool_create(NULL);
+}
+
+/*
+ * Claim and run chunks of a parallel_for range until none are left
+ */
+static void range_runner(void *arg)
+{
+    struct range_job *job = arg;
+    for (;;) {
+        size_t cur = __atomic_load_n(&job->next, __ATOMIC_RELAXED);
+        size_t chunk;
+        do {
+            if (cur >= job->end)
+                return;
+            size_t remaining = job->end - cur;
+            chunk = remaining / (2 * job->runners);
+            if (chunk < job->grain)
+                chunk = job->grain;
+            if (chunk > remaining)
+                chunk = remaining;
+        } while (!__atomic_compare_exchange_n(&job->next, &cur, cur + chunk,
+                    1, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+        job->fn(job->arg, cur, cur + chunk);
+    }
+}
@@ -0,0 +1,118 @@
+/*
+ * thread_pool.h
+ * A work-stealing thread pool shared by the library's batch functions. Each
+ * worker owns a Chase-Lev deque: it pushes and pops tasks at one end, and
+ * idle workers steal from the other. Threads outside the pool submit through
+ * a shared queue. Waiting on a group of tasks runs queued tasks, only
+ * sleeping once there are none left to run, so tasks may themselves submit
+ * and wait, e.g. for nested parallel loops.
+ */
+
+#ifndef ___thread_pool_h___
+#define ___thread_pool_h___
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define THREAD_POOL_ENV "MATASANO_THREADS"
+
+struct thread_pool;
+
+struct thread_pool_options {
+    size_t workers;         // threads to start; callers also run tasks while
+                            // they wait, so 0 is valid and runs everything
+                            // on the calling thread
+    int pin;                // pin worker i to cpu (first_cpu + i) modulo the
+                            // number of online cpus
+    int first_cpu;
+};
+
+// A set of tasks to wait for. Must be zeroed before the first submit.
+struct thread_pool_group {
+    size_t pending;
+};
+
+typedef void (*thread_pool_task_fn)(void *arg);
+// Process the indices [begin, end)
+typedef void (*thread_pool_range_fn)(void *arg, size_t begin, size_t end);
+
+/*
+ * Start a pool
+ * @param opts options, or NULL for one worker per online cpu besides the
+ *        caller, unpinned
+ * @return pointer to the new pool, or NULL on error
+ */
+struct thread_pool *thread_pool_create(const struct thread_pool_options *opts);
+
+/*
+ * Stop a pool's workers and free it
+ *        precondition: no tasks are queued or running
+ */
+void thread_pool_destroy(struct thread_pool *pool);
+
+/*
+ * @return number of worker threads in a pool
+ */
+size_t thread_pool_size(const struct thread_pool *pool);
+
+/*
+ * Get the pool used by the library's batch functions, starting it on first
+ * use. Its size is one worker per online cpu besides the caller, or
+ * MATASANO_THREADS - 1 if that is set.
+ * @return pointer to the pool, or NULL if it could not be started
+ */
+struct thread_pool *thread_pool_default(void);
+
+/*
+ * Set the most threads, including the caller, that each call to one of the
+ * library's batch functions may use
+ * @param limit thread count, 1 to run batches on the calling thread only, or
+ *        0 for as many as the default pool has
+ * @return the previous limit
+ */
+size_t thread_pool_set_batch_limit(size_t limit);
+
+/*
+ * @return the limit set by thread_pool_set_batch_limit
+ */
+size_t thread_pool_batch_limit(void);
+
+/*
+ * Queue a task
+ * @param pool pool to run it on
+ * @param group group to count the task in
+ * @param fn function to run
+ * @param arg argument to pass to fn
+ * @return 0 on success, or -1 if the task could not be allocated, in which
+ *         case it has not been run
+ */
+int thread_pool_submit(struct thread_pool *pool,
+        struct thread_pool_group *group, thread_pool_task_fn fn, void *arg);
+
+/*
+ * Wait for every task in a group to finish, running queued tasks meanwhile,
+ * and sleeping once there are none to run
+ * @param pool pool the tasks were submitted to
+ * @param group group to wait for
+ */
+void thread_pool_wait(struct thread_pool *pool,
+        struct thread_pool_group *group);
+
+/*
+ * Run fn over the index range [begin, end) in chunks, on up to limit
+ * threads including the caller, and wait for it to finish. Each thread
+ * claims chunks from a shared position, sized to a fraction of what is left,
+ * so chunks start large and shrink towards grain as the range runs out.
+ * @param pool pool to run on, or NULL for the default pool
+ * @param begin first index
+ * @param end one past the last index
+ * @param grain smallest chunk worth handing out, or 0 for 1
+ * @param limit most threads to use, or 0 for the pool's size plus one
+ * @param fn function to run on each chunk
+ * @param arg argument to pass to fn
+ */
+void thread_pool_parallel_for(struct thread_pool *pool, size_t begin,
+        size_t end, size_t grain, size_t limit, thread_pool_range_fn fn,
+        void *arg);
+
+#endif  // ___thread_pool_h___
@@ -10,18 +10,119 @@
  *  6) Braking a repeating-key xor cipher
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdlib.h>
 #include <float.h>
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
 #include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include "xor.h"
 #include "text_score.h"
 #include "convert.h"
+#include "cpu_dispatch.h"
+#include "stats.h"
+#include "probes.h"
+#include "arena.h"
+#include "thread_pool.h"
+#include "memo_cache.h"
+#include "ngram_tables.h"
+
+// Bytes decoded per pass of a base64_xor_stream; a multiple of 3
+#define STREAM_BLOCK (12 * 1024)
+
+struct base64_xor_stream {
+    struct base64_decoder decoder;
+    xor_stream_sink sink;
+    void *arg;
+    size_t key_size;
+    size_t phase;               // position in the key of the next byte
+    uint8_t block[STREAM_BLOCK];
+    uint8_t tile[];             // the key repeated, so that the key from any
+                                // phase lines up with a whole block
+};
+
+// Operations whose results are kept in an xor_context's memo cache
+enum memo_op {
+    MEMO_DETECT_REPEATED_BYTE_XOR = 1,
+    MEMO_BREAK_REPEATED_KEY_XOR,
+};
+
+// Shared state for find_repeated_byte_xor_ctx run over the thread pool
+struct find_job {
+    const char **candidates;
+    double *scores;
+    double z;
+    size_t *used;       // bytes scored for each candidate if sampling
+};
+
+// Shared state for break_repeated_key_xor_ctx run over the thread pool
+struct break_job {
+    const uint8_t *transposed;
+    size_t block_size;
+    uint8_t *key;
+};
+
+// Shared state for search_short_xor_keys run over the thread pool
+struct short_key_job {
+    double (*columns)[256];             // score of each byte in each column
+    double column_max[SHORT_XOR_KEY_MAX];
+    size_t key_size;
+    size_t top;
+    pthread_mutex_t lock;
+    struct xor_key_candidate *best;     // min-heap of the best keys found
+    size_t num_best;
+    int failed;                         // set atomically if a range fails
+};
+
+// A partial key in beam_search_repeated_key
+struct beam_state {
+    int64_t score;      // summed bigram log probabilities so far
+    size_t last;        // candidate index of the newest key byte
+    uint8_t *key;
+};
 
 // Private functions
+static struct arena *context_arena(const struct xor_context *ctx);
+static const struct text_scorer *context_scorer(
+        const struct xor_context *ctx);
+static void score_candidates(void *arg, size_t begin, size_t end);
+static uint8_t best_key_for_histogram(const uint32_t hist[256], size_t len,
+        double *score);
+static uint8_t best_scored_key(const double scores[256], double *score);
+static const char *find_most_likely(struct xor_context *ctx,
+        const char **candidates, size_t num, double z, size_t *used);
+static int count_raw_bytes(uint32_t hist[256], const void *src, size_t from,
+        size_t to);
+static int count_base16_bytes(uint32_t hist[256], const void *src,
+        size_t from, size_t to);
+static int sample_best_key(int (*count)(uint32_t hist[256], const void *src,
+            size_t from, size_t to), const void *src, size_t len, double z,
+        uint8_t *key, double *score, size_t *used);
+static void break_columns(void *arg, size_t begin, size_t end);
+static int tiled_key_xor(const uint8_t *key, size_t key_size,
+        const uint8_t *src, uint8_t *dest, size_t len);
+static void top_column_keys(const double scores[256], size_t num,
+        uint8_t *out);
+static int64_t straddle_score(const uint8_t *cipher_text, size_t len,
+        size_t key_size, size_t column, uint8_t a, uint8_t b);
+static void keep_state(struct beam_state *beam, size_t *num, size_t width,
+        int64_t score, size_t last, const uint8_t *prefix, size_t prefix_len,
+        uint8_t next);
+static void search_first_bytes(void *arg, size_t begin, size_t end);
+static void search_last_byte(const struct short_key_job *job,
+        struct xor_key_candidate *heap, size_t *num, uint8_t *key,
+        double prefix_score);
+static int better_candidate(const struct xor_key_candidate *a,
+        const struct xor_key_candidate *b);
+static int compare_candidates(const void *a, const void *b);
+static void offer_candidate(struct xor_key_candidate *heap, size_t *num,
+        size_t top, const struct xor_key_candidate *c);
 static uint8_t find_likely_key_size(const uint8_t *cipher_text, size_t len,
         size_t max_key_size);
 
@@ -38,7 +139,11 @@ void fixed_xor(uint8_t *dest, const uint8_t *src1, const uint8_t *src2,
 {
     if (!src1 || !src2)
         return;
-    // TODO: possible use of the restrict keyword?
+    const struct cpu_kernels *k = cpu_kernels();
+    if (k->xor_bytes) {
+        k->xor_bytes(dest, src1, src2, len);
+        return;
+    }
     size_t i;
     for (i = 0; i < len; ++i)
         dest[i] = src1[i] ^ src2[i];
@@ -57,6 +162,8 @@ void repeated_byte_xor(uint8_t key, const uint8_t *src, uint8_t *dest,
 {
     if (!src || !dest)
         return;
+    if (tiled_key_xor(&key, 1, src, dest, len))
+        return;
     for (size_t i = 0; i < len; ++i)
         dest[i] = src[i] ^ key;
 }
@@ -74,6 +181,14 @@ void repeated_byte_xor(uint8_t key, const uint8_t *src, uint8_t *dest,
 void repeated_key_xor(const uint8_t *key, size_t key_size, const uint8_t *src,
         uint8_t *dest, size_t len)
 {
+    size_t slot = key_xor_slot(key_size);
+    const struct cpu_kernels *k = cpu_kernels();
+    if (slot < KEY_XOR_KERNELS && k->key_xor[slot]) {
+        k->key_xor[slot](key, src, dest, len);
+        return;
+    }
+    if (tiled_key_xor(key, key_size, src, dest, len))
+        return;
     size_t i, j, block;
     for (i = 0; i < len / key_size; ++i) {
         block = i * key_size;
@@ -86,41 +201,211 @@ void repeated_key_xor(const uint8_t *key, size_t key_size, const uint8_t *src,
         dest[block + j] = key[j] ^ src[block + j];
 }
 
+/*
+ * Start decrypting a base 64, repeating-key xor'd stream
+ * @param key buffer that serves as the key
+ * @param key_size length of the key
+ * @param sink function to receive the decrypted bytes
+ * @param arg argument to pass to sink
+ * @return pointer to the new stream, or NULL on error
+ */
+struct base64_xor_stream *base64_xor_stream_create(const uint8_t *key,
+        size_t key_size, xor_stream_sink sink, void *arg)
+{
+    if (!key || key_size == 0 || !sink ||
+            key_size > SIZE_MAX - sizeof(struct base64_xor_stream) -
+            STREAM_BLOCK)
+        return NULL;
+    struct base64_xor_stream *s = malloc(sizeof *s + STREAM_BLOCK + key_size);
+    if (!s)
+        return NULL;
+    memset(&s->decoder, 0, sizeof s->decoder);
+    s->sink = sink;
+    s->arg = arg;
+    s->key_size = key_size;
+    s->phase = 0;
+    for (size_t i = 0; i < STREAM_BLOCK + key_size; i += key_size) {
+        size_t n = STREAM_BLOCK + key_size - i;
+        memcpy(s->tile + i, key, n < key_size ? n : key_size);
+    }
+    return s;
+}
+
+/*
+ * Decrypt the next piece of a stream
+ * @param s stream
+ * @param src next piece of base 64 text
+ * @param len number of characters in src
+ * @return 0 on success, or -1 if src isn't base 64 or the sink failed
+ */
+int base64_xor_stream_update(struct base64_xor_stream *s, const char *src,
+        size_t len)
+{
+    if (!s || (!src && len != 0))
+        return -1;
+    // the most characters that can't decode to more than a block, counting
+    // a group left unfinished by the last piece
+    const size_t piece_max = (STREAM_BLOCK / 3 - 1) * 4;
+    for (size_t off = 0; off < len; off += piece_max) {
+        size_t piece = len - off < piece_max ? len - off : piece_max;
+        size_t n = base64_decode_update(&s->decoder, s->block, src + off,
+                piece);
+        if (n == SIZE_MAX)
+            return -1;
+        if (n == 0)
+            continue;
+        fixed_xor(s->block, s->block, s->tile + s->phase, n);
+        s->phase = (s->phase + n) % s->key_size;
+        if (s->sink(s->arg, s->block, n) != 0)
+            return -1;
+    }
+    return 0;
+}
+
+/*
+ * Check that a stream ended on a whole base 64 group
+ * @return 0 if so, or -1 if characters were left over
+ */
+int base64_xor_stream_final(const struct base64_xor_stream *s)
+{
+    if (!s)
+        return -1;
+    return base64_decode_final(&s->decoder);
+}
+
+/*
+ * Free a stream
+ */
+void base64_xor_stream_destroy(struct base64_xor_stream *s)
+{
+    free(s);
+}
+
+/*
+ * A sink that writes to a file descriptor, retrying short writes
+ * @param fd pointer to the int file descriptor to write to
+ * @return 0 on success, or -1 if a write failed
+ */
+int xor_stream_write_fd(void *fd, const uint8_t *buf, size_t len)
+{
+    int out = *(const int *) fd;
+    while (len > 0) {
+        ssize_t n = write(out, buf, len);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        buf += n;
+        len -= n;
+    }
+    return 0;
+}
+
 /*
  * Break a repeated key xor by decypting with each possible key and analyzing
  * the letter frequencies of each text. Look for the key that produces text
  * that most closely resembles the letter frequencies of the english language.
+ * The text's bytes are counted once, and each key is scored from the counts.
  * @param src pointer to encrpyted (english language) string
  * @param len length of src buffer
  *        precondition: length of src buffer >= len
  * @return best guess for the key that src has been repeat-key-encrypted with
  */
 uint8_t detect_repeated_byte_xor(const uint8_t *src, size_t len)
+{
+    return detect_repeated_byte_xor_ctx(NULL, src, len);
+}
+
+/*
+ * As detect_repeated_byte_xor, using a context's result cache
+ * @param ctx context, or NULL
+ * @return best guess for the key
+ */
+uint8_t detect_repeated_byte_xor_ctx(struct xor_context *ctx,
+        const uint8_t *src, size_t len)
 {
     if (!src)
         return 0;
-    char decrypted[len];
-    uint8_t best_guess = 0;
-    double highest_score = DBL_MIN;
-    struct letter_frequencies lfs;
-    for (size_t i = 0; i <= UINT8_MAX; ++i) {
-        uint8_t key = i;
-        repeated_byte_xor(key, src, (uint8_t *) decrypted, len);
-        struct letter_frequencies freqs = { {0} };
-        calculate_letter_frequencies(decrypted, len, &freqs);
-        double score = compare_to_english(&freqs);
-        if (score > highest_score) {
-            lfs = freqs;
-            highest_score = score;
-            best_guess = key;
-        }
+    struct memo_cache *memo = ctx ? ctx->memo : NULL;
+    const struct text_scorer *scorer = context_scorer(ctx);
+    struct memo_key memo_id;
+    uint8_t cached[MEMO_VALUE_MAX];
+    if (memo) {
+        // results found with different scorers are kept apart
+        memo_id = memo_key(MEMO_DETECT_REPEATED_BYTE_XOR,
+                (uintptr_t) scorer, src, len);
+        if (memo_cache_get(memo, &memo_id, cached) == 1)
+            return cached[0];
     }
+    PROBE1(detect_repeated_byte_xor__entry, len);
+    STATS_SCOPE(STATS_DETECT_REPEATED_BYTE_XOR, len);
+    STATS_KEYS(UINT8_MAX + 1);
+    double scores[256];
+    scorer->score_keys(src, len, scores);
+    double score;
+    uint8_t best_guess = best_scored_key(scores, &score);
+    if (memo)
+        memo_cache_put(memo, &memo_id, &best_guess, 1);
+    PROBE2(detect_repeated_byte_xor__return, len, best_guess);
     return best_guess;
 }
 
+/*
+ * As detect_repeated_byte_xor, scoring only as much of the text as it takes
+ * to be sure of the key
+ * @param src pointer to encrypted (english language) string
+ * @param len length of src buffer
+ * @param z how many standard errors the best key must lead by
+ * @param used output for the number of bytes scored, or NULL
+ * @return best guess for the key
+ */
+uint8_t detect_repeated_byte_xor_sampled(const uint8_t *src, size_t len,
+        double z, size_t *used)
+{
+    uint8_t key = 0;
+    double score;
+    size_t scored = 0;
+    if (src) {
+        PROBE1(detect_repeated_byte_xor__entry, len);
+        sample_best_key(count_raw_bytes, src, len, z, &key, &score, &scored);
+        PROBE2(detect_repeated_byte_xor__return, scored, key);
+    }
+    if (used)
+        *used = scored;
+    return key;
+}
+
+/*
+ * As detect_repeated_byte_xor, on base 16 text. The byte histogram is built
+ * while the text is parsed, so the raw bytes are never written out.
+ * @param src base 16 string
+ * @param len number of characters in src; a trailing odd digit is ignored
+ * @param key output for the best guess for the key
+ * @param score output for the english score of the text under that key
+ * @return 0 on success, or -1 if src isn't base 16
+ */
+int detect_repeated_byte_xor_base16(const char *src, size_t len,
+        uint8_t *key, double *score)
+{
+    if (!src || !key || !score)
+        return -1;
+    PROBE1(detect_repeated_byte_xor__entry, len / 2);
+    STATS_SCOPE(STATS_DETECT_REPEATED_BYTE_XOR, len / 2);
+    STATS_KEYS(UINT8_MAX + 1);
+    uint32_t hist[256];
+    size_t raw_len = base16_histogram(hist, src, len);
+    if (raw_len == SIZE_MAX)
+        return -1;
+    *key = best_key_for_histogram(hist, raw_len, score);
+    PROBE2(detect_repeated_byte_xor__return, raw_len, *key);
+    return 0;
+}
+
 /*
  * Take an array of strings and return the one that is most likely to have
- * been encrpyted with repeated-byte xor
+ * been encrpyted with repeated-byte xor. Each candidate is scored from byte
+ * counts taken while parsing its hex, without decoding it.
  * @param candidadtes array of pointers to strings
  * @param num number of candidates
  *        precondition: num >= length of candidates array
@@ -128,25 +413,39 @@ uint8_t detect_repeated_byte_xor(const uint8_t *src, size_t len)
  */
 const char *find_repeated_byte_xor(const char **candidates, size_t num)
 {
-    size_t index_of_most_likely = 0;
-    double best_score = DBL_MIN;
-    uint8_t best_key = 0;
-    for (size_t i = 0; i < num; i++) {
-        size_t raw_size = strlen(candidates[i]) / 2;
-        uint8_t raw[raw_size];
-        read_base16(raw, candidates[i], raw_size * 2);
-        uint8_t key = detect_repeated_byte_xor(raw, raw_size);
-        repeated_byte_xor(key, raw, raw, raw_size);
-        struct letter_frequencies lfs;
-        calculate_letter_frequencies((char *) raw, raw_size, &lfs);
-        double score = compare_to_english(&lfs);
-        if (score > best_score) {
-            best_score = score;
-            index_of_most_likely = i;
-            best_key = key;
-        }
-    }
-    return candidates[index_of_most_likely];
+    return find_repeated_byte_xor_ctx(NULL, candidates, num);
+}
+
+/*
+ * As find_repeated_byte_xor, taking scratch space from a context
+ * @param ctx context, or NULL to use the calling thread's arena
+ * @return pointer to the most likely candidate, or NULL if scratch space ran
+ *         out
+ */
+const char *find_repeated_byte_xor_ctx(struct xor_context *ctx,
+        const char **candidates, size_t num)
+{
+    return find_most_likely(ctx, candidates, num, 0, NULL);
+}
+
+/*
+ * As find_repeated_byte_xor, scoring each candidate only as far as it takes
+ * to be sure of its key
+ * @param candidates array of pointers to base 16 strings
+ * @param num number of candidates
+ * @param z how many standard errors each candidate's key must lead by
+ * @param used output for the number of bytes scored, or NULL
+ * @return pointer to the most likely candidate, or NULL if scratch space ran
+ *         out
+ */
+const char *find_repeated_byte_xor_sampled(const char **candidates,
+        size_t num, double z, size_t *used)
+{
+    size_t scored = 0;
+    const char *best = find_most_likely(NULL, candidates, num, z, &scored);
+    if (used)
+        *used = scored;
+    return best;
 }
 
 /*
@@ -157,23 +456,62 @@ const char *find_repeated_byte_xor(const char **candidates, size_t num)
  * @param key buffer to output the key that is found for the ciphertext
  * @param max_key_size maximum key length to search for
  *        precondition: length of key buffer >= max_key_size
- *        precondition: length of cipher_text >= 6 * max_key_size
+ *        precondition: length of cipher_text >= 12 * max_key_size
  * @return size of the found key
  */
 size_t break_repeated_key_xor(const uint8_t *cipher_text, size_t len,
         uint8_t *key, size_t max_key_size)
+{
+    return break_repeated_key_xor_ctx(NULL, cipher_text, len, key,
+            max_key_size);
+}
+
+/*
+ * As break_repeated_key_xor, taking scratch space from a context and using
+ * its result cache. Keys longer than MEMO_VALUE_MAX are not cached.
+ * @param ctx context, or NULL to use the calling thread's arena
+ * @return size of the found key, or 0 if scratch space ran out
+ */
+size_t break_repeated_key_xor_ctx(struct xor_context *ctx,
+        const uint8_t *cipher_text, size_t len, uint8_t *key,
+        size_t max_key_size)
 {
     if (!cipher_text || !key)
         return 0;
+    struct memo_cache *memo = ctx ? ctx->memo : NULL;
+    struct memo_key memo_id;
+    if (memo) {
+        uint8_t cached[MEMO_VALUE_MAX];
+        memo_id = memo_key(MEMO_BREAK_REPEATED_KEY_XOR, max_key_size,
+                cipher_text, len);
+        size_t size = memo_cache_get(memo, &memo_id, cached);
+        if (size != SIZE_MAX && size != 0) {
+            memcpy(key, cached, size);
+            return size;
+        }
+    }
+    struct arena *arena = context_arena(ctx);
+    if (!arena)
+        return 0;
+    PROBE2(break_repeated_key_xor__entry, len, max_key_size);
+    STATS_SCOPE(STATS_BREAK_REPEATED_KEY_XOR, len);
     size_t likely_key_size = find_likely_key_size(cipher_text, len,
             max_key_size);
-    uint8_t transposed[len];
+    struct arena_mark mark = arena_get_mark(arena);
+    uint8_t *transposed = arena_alloc(arena, len);
+    if (!transposed) {
+        arena_reset(arena, mark);
+        return 0;
+    }
     size_t block_size = len / likely_key_size;
     transpose(transposed, cipher_text, len, block_size);
-    for (size_t j = 0; j < likely_key_size; j++) {
-        key[j] = detect_repeated_byte_xor(transposed + block_size * j,
-                block_size);
-    }
+    struct break_job job = { transposed, block_size, key };
+    thread_pool_parallel_for(NULL, 0, likely_key_size, 1,
+            thread_pool_batch_limit(), break_columns, &job);
+    arena_reset(arena, mark);
+    if (memo)
+        memo_cache_put(memo, &memo_id, key, likely_key_size);
+    PROBE2(break_repeated_key_xor__return, len, likely_key_size);
     return likely_key_size;
 }
 
@@ -184,8 +522,8 @@ size_t break_repeated_key_xor(const uint8_t *cipher_text, size_t len,
  * @param cipher_text pointer to cipher text
  * @param len length of cipher text
  *        precondition: length of cipher text >= len
- *        currently, also require that len >= 6 * max_key_size because that's
- *        how many blocks it's taking to get accurate results
+ *        currently, also require that len >= 12 * max_key_size, because it
+ *        compares 6 pairs of blocks of each size to get accurate results
  * @param max_key_size largest key size to check
  * @return most likely key size for the given cipher text
  */
@@ -194,7 +532,10 @@ static uint8_t find_likely_key_size(const uint8_t *cipher_text, size_t len,
 {
     if (!cipher_text)
         return 0;
-    assert(len >= 6 * max_key_size);    // TODO - handle this
+    assert(len >= 12 * max_key_size);   // TODO - handle this
+    PROBE2(find_likely_key_size__entry, len, max_key_size);
+    STATS_SCOPE(STATS_FIND_LIKELY_KEY_SIZE, len);
+    STATS_KEYS(max_key_size);
     size_t likely_key_size = 0;
     uint32_t min_hamming = UINT32_MAX;
     for (size_t key_size = 1; key_size <= max_key_size; ++key_size) {
@@ -210,9 +551,144 @@ static uint8_t find_likely_key_size(const uint8_t *cipher_text, size_t len,
             likely_key_size = key_size;
         }
     }
+    PROBE2(find_likely_key_size__return, len, likely_key_size);
     return likely_key_size;
 }
 
+/*
+ * Recover a repeating xor key of known size by beam search
+ * @param cipher_text
+ * @param len length of cipher text buffer
+ * @param key_size size of the key
+ * @param beam_width candidates kept per column, and partial keys kept
+ * @param key buffer to output the key to
+ * @return 0 on success, or -1 on error
+ */
+int beam_search_repeated_key(const uint8_t *cipher_text, size_t len,
+        size_t key_size, size_t beam_width, uint8_t *key)
+{
+    struct arena *arena = arena_thread();
+    if (!cipher_text || !key || key_size == 0 || len < key_size ||
+            beam_width == 0 || !arena)
+        return -1;
+    size_t width = beam_width < 256 ? beam_width : 256;
+    struct arena_mark mark = arena_get_mark(arena);
+    uint8_t *candidates = arena_alloc(arena, key_size * width);
+    int64_t *pairs = arena_alloc(arena, width * width * sizeof *pairs);
+    struct beam_state *beams[2];
+    beams[0] = arena_alloc(arena, 2 * width * sizeof **beams);
+    uint8_t *keys = arena_alloc(arena, 2 * width * key_size);
+    if (!candidates || !pairs || !beams[0] || !keys) {
+        arena_reset(arena, mark);
+        return -1;
+    }
+    beams[1] = beams[0] + width;
+    for (size_t i = 0; i < 2 * width; ++i)
+        beams[0][i].key = keys + i * key_size;
+
+    for (size_t c = 0; c < key_size; ++c) {
+        uint32_t hist[256] = { 0 };
+        size_t column_len = 0;
+        for (size_t i = c; i < len; i += key_size, ++column_len)
+            ++hist[cipher_text[i]];
+        double scores[256];
+        score_xor_keys(hist, column_len, scores);
+        top_column_keys(scores, width, candidates + c * width);
+    }
+
+    struct beam_state *beam = beams[0];
+    size_t num = 0;
+    for (size_t i = 0; i < width; ++i)
+        keep_state(beam, &num, width, 0, i, NULL, 0, candidates[i]);
+    for (size_t c = 0; c + 1 < key_size; ++c) {
+        const uint8_t *from = candidates + c * width;
+        const uint8_t *to = from + width;
+        for (size_t a = 0; a < width; ++a)
+            for (size_t b = 0; b < width; ++b)
+                pairs[a * width + b] = straddle_score(cipher_text, len,
+                        key_size, c, from[a], to[b]);
+        struct beam_state *next = beams[(c + 1) % 2];
+        size_t num_next = 0;
+        for (size_t s = 0; s < num; ++s)
+            for (size_t b = 0; b < width; ++b)
+                keep_state(next, &num_next, width,
+                        beam[s].score + pairs[beam[s].last * width + b], b,
+                        beam[s].key, c + 1, to[b]);
+        beam = next;
+        num = num_next;
+    }
+    // the last column runs on into the first column of the next row
+    size_t best = 0;
+    int64_t best_score = INT64_MIN;
+    for (size_t s = 0; s < num; ++s) {
+        int64_t score = beam[s].score + straddle_score(cipher_text, len,
+                key_size, key_size - 1, beam[s].key[key_size - 1],
+                beam[s].key[0]);
+        if (score > best_score) {
+            best_score = score;
+            best = s;
+        }
+    }
+    memcpy(key, beam[best].key, key_size);
+    arena_reset(arena, mark);
+    return 0;
+}
+
+/*
+ * Try every repeating xor key of a given size
+ * @param src cipher text
+ * @param len length of src buffer
+ * @param key_size key length to try, 1 to SHORT_XOR_KEY_MAX
+ * @param out output for the best keys, best first
+ * @param top number of keys wanted
+ * @return number of keys written to out, or 0 on error
+ */
+size_t search_short_xor_keys(const uint8_t *src, size_t len,
+        size_t key_size, struct xor_key_candidate *out, size_t top)
+{
+    if (!src || !out || key_size == 0 || key_size > SHORT_XOR_KEY_MAX ||
+            len < key_size || top == 0)
+        return 0;
+    size_t keys = (size_t) 1 << (8 * key_size);
+    if (top > keys)
+        top = keys;
+    double columns[SHORT_XOR_KEY_MAX][256];
+    struct short_key_job job;
+    job.columns = columns;
+    job.key_size = key_size;
+    job.top = top;
+    job.num_best = 0;
+    job.failed = 0;
+    job.best = malloc(top * sizeof *job.best);
+    if (!job.best)
+        return 0;
+    // normalizing every column by the whole text's length makes the column
+    // scores add up to the score of the whole text
+    for (size_t c = 0; c < key_size; ++c) {
+        uint32_t hist[256] = { 0 };
+        for (size_t i = c; i < len; i += key_size)
+            ++hist[src[i]];
+        score_xor_keys(hist, len, columns[c]);
+        double max = columns[c][0];
+        for (size_t b = 1; b < 256; ++b)
+            max = columns[c][b] > max ? columns[c][b] : max;
+        job.column_max[c] = max;
+    }
+    pthread_mutex_init(&job.lock, NULL);
+    thread_pool_parallel_for(NULL, 0, 256, 1, thread_pool_batch_limit(),
+            search_first_bytes, &job);
+    pthread_mutex_destroy(&job.lock);
+    if (job.failed) {
+        free(job.best);
+        return 0;
+    }
+    qsort(job.best, job.num_best, sizeof *job.best, compare_candidates);
+    memcpy(out, job.best, job.num_best * sizeof *job.best);
+    size_t found = job.num_best;
+    free(job.best);
+    return found;
+}
+
 /*
  * Transpose a buffer of equal-length blocks, making block N of the destination
  * the N'th byte of each block of the source. The block size of the destination
@@ -240,3 +716,446 @@ void transpose(uint8_t *dest, const uint8_t *src, size_t len,
             dest[transp_cols * i + j] = src[src_cols * j + i];
 }
 
+/*
+ * Repeated key xor through the vector xor kernel: the key is tiled into a
+ * buffer a whole number of keys long, which is then xored against the input
+ * one chunk at a time
+ * @return 1 if the xor was done, or 0 if there is no kernel or the key is too
+ *         long to tile, in which case the caller should fall back
+ */
+static int tiled_key_xor(const uint8_t *key, size_t key_size,
+        const uint8_t *src, uint8_t *dest, size_t len)
+{
+    enum { TILE_SIZE = 1024 };
+    const struct cpu_kernels *k = cpu_kernels();
+    if (!k->xor_bytes || key_size == 0 || key_size > TILE_SIZE / 4 ||
+            len < 2 * key_size)
+        return 0;
+    uint8_t tile[TILE_SIZE];
+    size_t tile_len = TILE_SIZE / key_size * key_size;
+    for (size_t i = 0; i < tile_len; i += key_size)
+        memcpy(tile + i, key, key_size);
+    for (size_t i = 0; i < len; i += tile_len) {
+        size_t chunk = len - i < tile_len ? len - i : tile_len;
+        k->xor_bytes(dest + i, src + i, tile, chunk);
+    }
+    return 1;
+}
+
+/*
+ * Score every candidate and pick the best, for find_repeated_byte_xor_ctx
+ * and find_repeated_byte_xor_sampled
+ * @param z how sure to be of each key when sampling
+ * @param used NULL to score whole candidates, else output for the number of
+ *        bytes sampled
+ * @return pointer to the most likely candidate, or NULL if scratch space ran
+ *         out
+ */
+static const char *find_most_likely(struct xor_context *ctx,
+        const char **candidates, size_t num, double z, size_t *used)
+{
+    struct arena *arena = context_arena(ctx);
+    if (!arena)
+        return NULL;
+    struct arena_mark mark = arena_get_mark(arena);
+    struct find_job job = { candidates, NULL, z, NULL };
+    job.scores = arena_alloc(arena, num * sizeof *job.scores);
+    if (num && !job.scores) {
+        arena_reset(arena, mark);
+        return NULL;
+    }
+    if (used) {
+        job.used = arena_alloc(arena, num * sizeof *job.used);
+        if (num && !job.used) {
+            arena_reset(arena, mark);
+            return NULL;
+        }
+    }
+    thread_pool_parallel_for(NULL, 0, num, 16, thread_pool_batch_limit(),
+            score_candidates, &job);
+    // pick the winner in order, so ties go the same way however the
+    // candidates were split up
+    size_t index_of_most_likely = 0;
+    double best_score = DBL_MIN;
+    for (size_t i = 0; i < num; i++) {
+        if (job.scores[i] > best_score) {
+            best_score = job.scores[i];
+            index_of_most_likely = i;
+        }
+    }
+    if (used) {
+        *used = 0;
+        for (size_t i = 0; i < num; i++)
+            *used += job.used[i];
+    }
+    arena_reset(arena, mark);
+    return candidates[index_of_most_likely];
+}
+
+/*
+ * Score candidates [begin, end) for find_most_likely
+ */
+static void score_candidates(void *arg, size_t begin, size_t end)
+{
+    struct find_job *job = arg;
+    for (size_t i = begin; i < end; i++) {
+        const char *hex = job->candidates[i];
+        uint8_t key;
+        int failed;
+        if (job->used) {
+            failed = sample_best_key(count_base16_bytes, hex, strlen(hex) / 2,
+                    job->z, &key, &job->scores[i], &job->used[i]);
+        } else {
+            failed = detect_repeated_byte_xor_base16(hex, strlen(hex), &key,
+                    &job->scores[i]);
+        }
+        // a line that isn't hex scores 0, below any real candidate's
+        if (failed)
+            job->scores[i] = 0;
+    }
+}
+
+/*
+ * Add the counts of bytes [from, to) of a raw text to a histogram
+ * @return 0
+ */
+static int count_raw_bytes(uint32_t hist[256], const void *src, size_t from,
+        size_t to)
+{
+    byte_histogram(hist, (const uint8_t *) src + from, to - from);
+    return 0;
+}
+
+/*
+ * Add the counts of bytes [from, to) of a base 16 text to a histogram
+ * @return 0, or -1 if that part of the text isn't base 16
+ */
+static int count_base16_bytes(uint32_t hist[256], const void *src,
+        size_t from, size_t to)
+{
+    uint32_t part[256];
+    if (base16_histogram(part, (const char *) src + 2 * from,
+                2 * (to - from)) == SIZE_MAX)
+        return -1;
+    for (size_t b = 0; b < 256; ++b)
+        hist[b] += part[b];
+    return 0;
+}
+
+/*
+ * Find the best single-byte key for a growing prefix of a text, stopping
+ * once it leads every other key by z standard errors
+ * @param count adds the counts of bytes [from, to) of the text to a
+ *        histogram, returning 0, or -1 on error
+ * @param src text to pass to count
+ * @param len number of bytes in the text
+ * @param z how many standard errors the best key must lead by
+ * @param key output for the best key
+ * @param score output for the best key's score on the prefix
+ * @param used output for the length of the prefix
+ * @return 0 on success, or -1 if count failed
+ */
+static int sample_best_key(int (*count)(uint32_t hist[256], const void *src,
+            size_t from, size_t to), const void *src, size_t len, double z,
+        uint8_t *key, double *score, size_t *used)
+{
+    STATS_SCOPE(STATS_DETECT_REPEATED_BYTE_XOR, 0);
+    uint32_t hist[256] = { 0 };
+    size_t done = 0;
+    size_t next = XOR_SAMPLE_FIRST;
+    for (;;) {
+        if (next > len)
+            next = len;
+        if (count(hist, src, done, next) != 0) {
+            *used = next;
+            return -1;
+        }
+        STATS_BYTES(next - done);
+        STATS_KEYS(UINT8_MAX + 1);
+        done = next;
+        *key = best_key_for_histogram(hist, done, score);
+        if (done == len || xor_key_leads_by(hist, done, *key, z))
+            break;
+        next = done * XOR_SAMPLE_GROWTH;
+    }
+    *used = done;
+    return 0;
+}
+
+/*
+ * Find the key bytes for columns [begin, end) for break_repeated_key_xor_ctx
+ */
+static void break_columns(void *arg, size_t begin, size_t end)
+{
+    struct break_job *job = arg;
+    for (size_t j = begin; j < end; j++) {
+        job->key[j] = detect_repeated_byte_xor(
+                job->transposed + job->block_size * j, job->block_size);
+    }
+}
+
+/*
+ * Pick the best scoring key bytes, best first; equal scores keep the lower
+ * byte first
+ * @param scores score of each key byte
+ * @param num number of bytes to pick
+ *        precondition: num <= 256
+ * @param out output for the picked bytes
+ */
+static void top_column_keys(const double scores[256], size_t num,
+        uint8_t *out)
+{
+    size_t kept = 0;
+    for (size_t b = 0; b < 256; ++b) {
+        if (kept == num && scores[b] <= scores[out[num - 1]])
+            continue;
+        size_t i = kept < num ? kept++ : num - 1;
+        for (; i > 0 && scores[out[i - 1]] < scores[b]; --i)
+            out[i] = out[i - 1];
+        out[i] = (uint8_t) b;
+    }
+}
+
+/*
+ * Sum the bigram log probabilities of the plaintext byte pairs that start in
+ * a key column
+ * @param column column the pairs start in; the pairs end in the next column,
+ *        or the first column of the next row for the last one
+ * @param a key byte of column
+ * @param b key byte of the column the pairs end in
+ * @return summed scaled log probabilities
+ */
+static int64_t straddle_score(const uint8_t *cipher_text, size_t len,
+        size_t key_size, size_t column, uint8_t a, uint8_t b)
+{
+    int64_t score = 0;
+    for (size_t i = column; i + 1 < len; i += key_size) {
+        uint8_t first = english_byte_class[cipher_text[i] ^ a];
+        uint8_t second = english_byte_class[cipher_text[i + 1] ^ b];
+        score += english_bigram_log2[first][second];
+    }
+    return score;
+}
+
+/*
+ * Add a partial key to a beam if it is among the width best, keeping the
+ * beam sorted best first. Equal scores keep the earlier state first.
+ * @param prefix key bytes of the state it grows from
+ * @param prefix_len number of bytes in prefix
+ * @param next byte to add to the prefix
+ */
+static void keep_state(struct beam_state *beam, size_t *num, size_t width,
+        int64_t score, size_t last, const uint8_t *prefix, size_t prefix_len,
+        uint8_t next)
+{
+    if (*num == width && score <= beam[width - 1].score)
+        return;
+    size_t i = *num < width ? (*num)++ : width - 1;
+    // reuse the key buffer of the state that drops off the end
+    uint8_t *key_buf = beam[i].key;
+    for (; i > 0 && beam[i - 1].score < score; --i)
+        beam[i] = beam[i - 1];
+    beam[i].score = score;
+    beam[i].last = last;
+    beam[i].key = key_buf;
+    if (prefix_len)
+        memcpy(key_buf, prefix, prefix_len);
+    key_buf[prefix_len] = next;
+}
+
+/*
+ * Search the keys starting with bytes [begin, end) for search_short_xor_keys,
+ * keeping the best in a heap of our own and then merging it into the job's.
+ * Marks the job failed if the heap can't be allocated, since the keys in the
+ * range would otherwise be silently missing from the results
+ */
+static void search_first_bytes(void *arg, size_t begin, size_t end)
+{
+    struct short_key_job *job = arg;
+    if (__atomic_load_n(&job->failed, __ATOMIC_RELAXED))
+        return;
+    struct xor_key_candidate *heap = malloc(job->top * sizeof *heap);
+    size_t num = 0;
+    if (!heap) {
+        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    // the most the bytes after the first and second can add
+    double rest_max = 0;
+    for (size_t c = 1; c < job->key_size; ++c)
+        rest_max += job->column_max[c];
+    double last_max = job->column_max[job->key_size - 1];
+    uint8_t key[SHORT_XOR_KEY_MAX] = { 0 };
+    for (size_t b0 = begin; b0 < end; ++b0) {
+        key[0] = (uint8_t) b0;
+        double s0 = job->columns[0][b0];
+        if (num == job->top && s0 + rest_max < heap[0].score)
+            continue;
+        if (job->key_size == 1) {
+            struct xor_key_candidate c = { { key[0] }, s0 };
+            offer_candidate(heap, &num, job->top, &c);
+            continue;
+        }
+        if (job->key_size == 2) {
+            search_last_byte(job, heap, &num, key, s0);
+            continue;
+        }
+        for (size_t b1 = 0; b1 < 256; ++b1) {
+            double s1 = s0 + job->columns[1][b1];
+            if (num == job->top && s1 + last_max < heap[0].score)
+                continue;
+            key[1] = (uint8_t) b1;
+            search_last_byte(job, heap, &num, key, s1);
+        }
+    }
+    pthread_mutex_lock(&job->lock);
+    for (size_t i = 0; i < num; ++i)
+        offer_candidate(job->best, &job->num_best, job->top, &heap[i]);
+    pthread_mutex_unlock(&job->lock);
+    free(heap);
+}
+
+/*
+ * Offer every key that completes a prefix to a heap
+ * @param key the prefix; its last byte is overwritten
+ * @param prefix_score sum of the prefix bytes' column scores
+ */
+static void search_last_byte(const struct short_key_job *job,
+        struct xor_key_candidate *heap, size_t *num, uint8_t *key,
+        double prefix_score)
+{
+    size_t last = job->key_size - 1;
+    const double *column = job->columns[last];
+    // add the whole row at once, which vectorizes, and only look at the
+    // keys that beat the worst kept so far one at a time
+    double sums[256];
+    for (size_t b = 0; b < 256; ++b)
+        sums[b] = prefix_score + column[b];
+    double floor = *num == job->top ? heap[0].score : -DBL_MAX;
+    for (size_t b = 0; b < 256; ++b) {
+        if (sums[b] < floor)
+            continue;
+        struct xor_key_candidate c;
+        memcpy(c.key, key, sizeof c.key);
+        c.key[last] = (uint8_t) b;
+        c.score = sums[b];
+        offer_candidate(heap, num, job->top, &c);
+        if (*num == job->top)
+            floor = heap[0].score;
+    }
+}
+
+/*
+ * Order candidates by score, and equal scores by key
+ * @return nonzero if a is a better candidate than b
+ */
+static int better_candidate(const struct xor_key_candidate *a,
+        const struct xor_key_candidate *b)
+{
+    if (a->score != b->score)
+        return a->score > b->score;
+    return memcmp(a->key, b->key, sizeof a->key) < 0;
+}
+
+/*
+ * qsort comparator putting the best candidates first
+ */
+static int compare_candidates(const void *a, const void *b)
+{
+    if (better_candidate(a, b))
+        return -1;
+    return better_candidate(b, a);
+}
+
+/*
+ * Keep a candidate if it is among the top best seen, in a min-heap whose
+ * root is the worst candidate kept
+ */
+static void offer_candidate(struct xor_key_candidate *heap, size_t *num,
+        size_t top, const struct xor_key_candidate *c)
+{
+    size_t i;
+    if (*num < top) {
+        // sift up from the new leaf
+        i = (*num)++;
+        while (i > 0 && better_candidate(&heap[(i - 1) / 2], c)) {
+            heap[i] = heap[(i - 1) / 2];
+            i = (i - 1) / 2;
+        }
+        heap[i] = *c;
+        return;
+    }
+    if (!better_candidate(c, &heap[0]))
+        return;
+    // sift down from the root
+    i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= top)
+            break;
+        if (child + 1 < top && better_candidate(&heap[child],
+                    &heap[child + 1]))
+            ++child;
+        if (!better_candidate(c, &heap[child]))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = *c;
+}
+
+/*
+ * Score every single-byte key against a histogram of the cipher text
+ * @param hist count of each byte value in the cipher text
+ * @param len length of the cipher text
+ * @param score output for the best key's score
+ * @return the key whose decryption looks most like english
+ */
+static uint8_t best_key_for_histogram(const uint32_t hist[256], size_t len,
+        double *score)
+{
+    double scores[256];
+    score_xor_keys(hist, len, scores);
+    return best_scored_key(scores, score);
+}
+
+/*
+ * Pick the best scoring key byte; equal scores keep the lower byte
+ * @param scores score of each key byte
+ * @param score output for the best key's score
+ * @return the best key
+ */
+static uint8_t best_scored_key(const double scores[256], double *score)
+{
+    uint8_t best_guess = 0;
+    double highest_score = -DBL_MAX;
+    for (size_t i = 0; i <= UINT8_MAX; ++i) {
+        if (scores[i] > highest_score) {
+            highest_score = scores[i];
+            best_guess = i;
+        }
+    }
+    *score = highest_score;
+    return best_guess;
+}
+
+/*
+ * Arena to take scratch space from: the context's, or the thread's own
+ */
+static struct arena *context_arena(const struct xor_context *ctx)
+{
+    if (ctx && ctx->arena)
+        return ctx->arena;
+    return arena_thread();
+}
+
+/*
+ * Scorer to rank keys with: the context's, or letter frequencies
+ */
+static const struct text_scorer *context_scorer(
+        const struct xor_context *ctx)
+{
+    if (ctx && ctx->scorer)
+        return ctx->scorer;
+    return letter_frequency_scorer();
+}
@@ -16,6 +16,50 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "arena.h"
+#include "memo_cache.h"
+#include "text_score.h"
+
+// Optional context for the analysis functions below. Their scratch buffers,
+// which are as large as the input, come from arena; if it is NULL, or no
+// context is given, they come from the calling thread's arena instead.
+// find_repeated_byte_xor_ctx and break_repeated_key_xor_ctx spread their work
+// over the default thread pool (see thread_pool_set_batch_limit); arena is
+// only used on the calling thread. If memo is set, detect_repeated_byte_xor_ctx
+// and break_repeated_key_xor_ctx look their results up there first, and
+// store them there after a search. scorer is the model of english that
+// detect_repeated_byte_xor_ctx ranks keys with; if it is NULL, letter
+// frequencies are used. break_repeated_key_xor_ctx always uses letter
+// frequencies, as the columns it scores are not running text.
+struct xor_context {
+    struct arena *arena;
+    struct memo_cache *memo;
+    const struct text_scorer *scorer;
+};
+
+// Bytes in the first prefix the sampled searches score; each prefix after
+// is XOR_SAMPLE_GROWTH times as long
+#define XOR_SAMPLE_FIRST 256
+#define XOR_SAMPLE_GROWTH 4
+// A z for the sampled searches that has given the same keys as the full
+// searches on every english text we've tried
+#define XOR_SAMPLE_CONFIDENCE 8.0
+
+// The longest key search_short_xor_keys tries
+#define SHORT_XOR_KEY_MAX 3
+
+// A key found by search_short_xor_keys
+struct xor_key_candidate {
+    uint8_t key[SHORT_XOR_KEY_MAX];     // bytes past the key size are 0
+    double score;                       // english score of the decryption
+};
+
+// Receives output from a stream, such as base64_xor_stream; returns 0 to
+// carry on, or -1 to stop the stream with an error
+typedef int (*xor_stream_sink)(void *arg, const uint8_t *buf, size_t len);
+
+struct base64_xor_stream;
+
 /*
  * Compute the xor of two equal-length buffers
  * @param dest pointer to buffer to write the output to
@@ -51,10 +95,55 @@ void repeated_byte_xor(uint8_t key, const uint8_t *src, uint8_t *dest,
 void repeated_key_xor(const uint8_t *key, size_t key_size, const uint8_t *src,
         uint8_t *dest, size_t len);
 
+/*
+ * Start decrypting a base 64, repeating-key xor'd stream. Each piece of
+ * text is decoded a block at a time into a buffer that stays in cache, xor'd
+ * there with the key, and handed to sink, so memory use doesn't grow with
+ * the stream. The key's position carries over between pieces.
+ * @param key buffer that serves as the key
+ * @param key_size length of the key
+ *        precondition: length of key buffer >= key_size
+ * @param sink function to receive the decrypted bytes
+ * @param arg argument to pass to sink
+ * @return pointer to the new stream, or NULL on error
+ */
+struct base64_xor_stream *base64_xor_stream_create(const uint8_t *key,
+        size_t key_size, xor_stream_sink sink, void *arg);
+
+/*
+ * Decrypt the next piece of a stream. Whitespace is skipped, as by
+ * base64_decode_update.
+ * @param s stream
+ * @param src next piece of base 64 text
+ * @param len number of characters in src
+ * @return 0 on success, or -1 if src isn't base 64 or the sink failed
+ */
+int base64_xor_stream_update(struct base64_xor_stream *s, const char *src,
+        size_t len);
+
+/*
+ * Check that a stream ended on a whole base 64 group
+ * @return 0 if so, or -1 if characters were left over
+ */
+int base64_xor_stream_final(const struct base64_xor_stream *s);
+
+/*
+ * Free a stream
+ */
+void base64_xor_stream_destroy(struct base64_xor_stream *s);
+
+/*
+ * A sink that writes to a file descriptor, retrying short writes
+ * @param fd pointer to the int file descriptor to write to
+ * @return 0 on success, or -1 if a write failed
+ */
+int xor_stream_write_fd(void *fd, const uint8_t *buf, size_t len);
+
 /*
  * Break a repeated key xor by decypting with each possible key and analyzing
  * the letter frequencies of each text. Look for the key that produces text
  * that most closely resembles the letter frequencies of the english language.
+ * The text's bytes are counted once, and each key is scored from the counts.
  * @param src pointer to encrpyted (english language) string
  * @param len length of src buffer
  *        precondition: length of src buffer >= len
@@ -62,9 +151,46 @@ void repeated_key_xor(const uint8_t *key, size_t key_size, const uint8_t *src,
  */
 uint8_t detect_repeated_byte_xor(const uint8_t *src, size_t len);
 
+/*
+ * As detect_repeated_byte_xor, using a context's result cache. Scoring from
+ * byte counts needs no scratch space, so the context's arena is unused.
+ * @param ctx context, or NULL
+ * @return best guess for the key
+ */
+uint8_t detect_repeated_byte_xor_ctx(struct xor_context *ctx,
+        const uint8_t *src, size_t len);
+
+/*
+ * As detect_repeated_byte_xor, scoring only as much of the text as it takes
+ * to be sure of the key. Keys are scored on a growing prefix, XOR_SAMPLE_FIRST
+ * bytes first, until the best leads every other by z standard errors (see
+ * xor_key_leads_by) or the text runs out. On long english texts the key is
+ * usually sure within a few KiB.
+ * @param src pointer to encrypted (english language) string
+ * @param len length of src buffer
+ * @param z how sure to be; XOR_SAMPLE_CONFIDENCE suits most uses
+ * @param used output for the number of bytes scored, or NULL
+ * @return best guess for the key
+ */
+uint8_t detect_repeated_byte_xor_sampled(const uint8_t *src, size_t len,
+        double z, size_t *used);
+
+/*
+ * As detect_repeated_byte_xor, on base 16 text. The byte histogram is built
+ * while the text is parsed, so the raw bytes are never written out.
+ * @param src base 16 string
+ * @param len number of characters in src; a trailing odd digit is ignored
+ * @param key output for the best guess for the key
+ * @param score output for the english score of the text under that key
+ * @return 0 on success, or -1 if src isn't base 16
+ */
+int detect_repeated_byte_xor_base16(const char *src, size_t len,
+        uint8_t *key, double *score);
+
 /*
  * Take an array of strings and return the one that is most likely to have
- * been encrpyted with repeated-byte xor
+ * been encrpyted with repeated-byte xor. Each candidate is scored from byte
+ * counts taken while parsing its hex, without decoding it.
  * @param candidadtes array of pointers to strings
  * @param num number of candidates
  *        precondition: num >= length of candidates array
@@ -72,6 +198,30 @@ uint8_t detect_repeated_byte_xor(const uint8_t *src, size_t len);
  */
 const char *find_repeated_byte_xor(const char **candidates, size_t num);
 
+/*
+ * As find_repeated_byte_xor, taking scratch space from a context
+ * @param ctx context, or NULL to use the calling thread's arena
+ * @return pointer to the most likely candidate, or NULL if scratch space ran
+ *         out
+ */
+const char *find_repeated_byte_xor_ctx(struct xor_context *ctx,
+        const char **candidates, size_t num);
+
+/*
+ * As find_repeated_byte_xor, scoring each candidate only as far as it takes
+ * to be sure of its key, as detect_repeated_byte_xor_sampled does. The
+ * candidates are then ranked by the scores of the prefixes read.
+ * @param candidates array of pointers to base 16 strings
+ * @param num number of candidates
+ * @param z how sure to be of each candidate's key
+ * @param used output for the number of bytes scored over all candidates, or
+ *        NULL
+ * @return pointer to the most likely candidate, or NULL if scratch space ran
+ *         out
+ */
+const char *find_repeated_byte_xor_sampled(const char **candidates,
+        size_t num, double z, size_t *used);
+
 /*
  * Break cipher text that has been encrpyted with repeated-key xoring
  * @param cipher_text
@@ -80,12 +230,63 @@ const char *find_repeated_byte_xor(const char **candidates, size_t num);
  * @param key buffer to output the key that is found for the ciphertext
  * @param max_key_size maximum key length to search for
  *        precondition: length of key buffer >= max_key_size
- *        precondition: length of cipher_text >= 2 * max_key_size
+ *        precondition: length of cipher_text >= 12 * max_key_size
  * @return size of the found key
  */
 size_t break_repeated_key_xor(const uint8_t *cipher_text, size_t len,
         uint8_t *key, size_t max_key_size);
 
+/*
+ * As break_repeated_key_xor, taking scratch space from a context
+ * @param ctx context, or NULL to use the calling thread's arena
+ * @return size of the found key, or 0 if scratch space ran out
+ */
+size_t break_repeated_key_xor_ctx(struct xor_context *ctx,
+        const uint8_t *cipher_text, size_t len, uint8_t *key,
+        size_t max_key_size);
+
+/*
+ * Recover a repeating xor key of known size by beam search. The beam_width
+ * best bytes for each key column are taken from letter frequencies, as
+ * break_repeated_key_xor picks one; then partial keys are grown a column at
+ * a time, scoring each pair of neighbouring columns by the english bigram
+ * log probability of the plaintext byte pairs that straddle them, and only
+ * the beam_width best partial keys are kept. The key returned is the one
+ * whose whole plaintext has the most likely bigrams, which catches wrong
+ * bytes that letter frequencies alone can't on short texts. The work is
+ * about beam_width * beam_width times the length of the text.
+ * @param cipher_text
+ * @param len length of cipher text buffer
+ *        precondition: length of cipher text buffer >= len
+ * @param key_size size of the key, e.g. from break_repeated_key_xor
+ * @param beam_width candidates kept per column, and partial keys kept
+ * @param key buffer to output the key to
+ *        precondition: length of key buffer >= key_size
+ * @return 0 on success, or -1 on error
+ */
+int beam_search_repeated_key(const uint8_t *cipher_text, size_t len,
+        size_t key_size, size_t beam_width, uint8_t *key);
+
+/*
+ * Try every repeating xor key of a given size, for texts too short for
+ * break_repeated_key_xor to split reliably into columns. The english score
+ * of a text is a sum over its bytes, so each column of the text is scored
+ * once under each of its 256 possible key bytes, and a key's score is the
+ * sum of its bytes' column scores; the whole key space is then searched by
+ * adding up those tables, skipping branches that can't reach the best so
+ * far. The search is spread over the default thread pool.
+ * @param src cipher text
+ * @param len length of src buffer
+ *        precondition: len >= key_size
+ * @param key_size key length to try, 1 to SHORT_XOR_KEY_MAX
+ * @param out output for the best keys, best first; ties are ordered by key
+ * @param top number of keys wanted
+ *        precondition: length of out >= top
+ * @return number of keys written to out, or 0 on error
+ */
+size_t search_short_xor_keys(const uint8_t *src, size_t len,
+        size_t key_size, struct xor_key_candidate *out, size_t top);
+
 /*
  * Transpose a buffer of equal-length blocks, making block N of the destination
  * the N'th byte of each block of the source. The block size of the destination